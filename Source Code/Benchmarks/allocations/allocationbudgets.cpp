@@ -0,0 +1,311 @@
+/*!
+ * \file    allocationbudgets.cpp
+ * \brief   Runs every tracked operation on a synthetic document and checks its heap allocations against a budget.
+ *
+ * The operations are loading the document through AllShapes, painting it on the canvas, sorting the shape vector
+ * by ID, perimeter, and area, editing shapes, and saving the document sequentially.
+ * The budget of an operation is the most allocations one call may make, given as a number per shape in the document
+ * plus a fixed number, so the same budgets hold for documents of any size.
+ * The counts of every operation are written as JSON; the program exits with status 1 when any call exceeded its budget,
+ * so it can guard against allocation regressions in a build script.
+ *
+ * Usage: allocationbudgets [--shapes N] [--repetitions N] [--budget OPERATION=PER_SHAPE,FIXED]... [--output FILE]
+ *
+ * The program works in a temporary directory, since AllShapes reads and writes shapes.txt in the working directory.
+ * It needs no display: it selects Qt's offscreen platform and the canvas paints into a QImage.
+*/
+
+#include "allocationtracker.h"
+#include "allshapes.h"
+#include "canvas.h"
+#include "scenegenerator.h"
+#include "selectionsort.h"
+#include <QApplication>
+#include <QDir>
+#include <QImage>
+#include <QTemporaryDir>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    const int CANVAS_WIDTH = 1000;      /*!< the width of the canvas, matching canvas::canvas() */
+    const int CANVAS_HEIGHT = 500;      /*!< the height of the canvas, matching canvas::canvas() */
+    const int MAX_EXTENT = 60;          /*!< the largest width, height, side, or radius of a generated shape */
+    const int NUM_EDITS = 100;          /*!< the number of shapes moved, and removed and restored, per repetition */
+
+    /*! \struct ScaledBudget
+     * \brief The most allocations one call of an operation may make in a document of some size.
+     */
+    struct ScaledBudget
+    {
+        double perShape;    /*!< the allocations allowed per shape in the document */
+        long long fixed;    /*!< the allocations allowed whatever the size */
+    };
+
+    /*! \struct Options
+     * \brief The command line settings.
+     */
+    struct Options
+    {
+        int shapes{2000};                                   /*!< the number of shapes in the document */
+        int repetitions{3};                                 /*!< the calls of every operation but loading */
+        std::string output{"allocationbudgets.json"};       /*!< the path of the JSON output, or "-" for standard output */
+
+        /*! The default budgets, indexed by alloc::eOperation. Loading creates every shape and its storage; painting
+         * allocates painter states; sorting swaps pointers in place; an edit changes a shape in place and records one
+         * command in the undo log; and saving
+         * reuses its buffer, so only the file stream and the rebuild of the shape batches after edits allocate. */
+        ScaledBudget budgets[alloc::NUM_OPERATIONS]
+        {
+            {8.0, 256},     // load
+            {0.0, 256},     // save
+            {0.0, 0},       // sort
+            {4.0, 256},     // paint
+            {0.0, 4}        // edit
+        };
+    };
+
+    //! Reads a budget given as "operation=perShape,fixed".
+    bool readBudget(const char *text, Options &options)
+    {
+        const char *equals = std::strchr(text, '=');
+        const char *comma = equals != nullptr ? std::strchr(equals, ',') : nullptr;
+
+        if(comma == nullptr)
+        {
+            return false;
+        }
+
+        std::string name(text, equals);
+
+        for(int i = 0; i < alloc::NUM_OPERATIONS; ++i)
+        {
+            if(name == alloc::operationName(alloc::eOperation(i)))
+            {
+                options.budgets[i].perShape = std::atof(equals + 1);
+                options.budgets[i].fixed = std::atoll(comma + 1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! Reads the command line.
+    bool readOptions(int argc, char *argv[], Options &options)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const char *option = argv[i];
+
+            if(i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *value = argv[++i];
+
+            if(std::strcmp(option, "--shapes") == 0)
+            {
+                options.shapes = std::atoi(value);
+            }
+            else if(std::strcmp(option, "--repetitions") == 0)
+            {
+                options.repetitions = std::max(1, std::atoi(value));
+            }
+            else if(std::strcmp(option, "--budget") == 0)
+            {
+                if(!readBudget(value, options))
+                {
+                    return false;
+                }
+            }
+            else if(std::strcmp(option, "--output") == 0)
+            {
+                options.output = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return options.shapes > 0;
+    }
+
+    //! Prints the counts of one operation.
+    void print(alloc::eOperation operation)
+    {
+        alloc::OperationStats stats = alloc::getOperation(operation);
+        alloc::Budget budget = alloc::getBudget(operation);
+
+        std::printf("%-8s %6lld %14lld %14lld %14lld %10lld\n", alloc::operationName(operation), stats.calls,
+                    stats.largest.allocations, stats.largest.bytes, budget.allocations, stats.budgetViolations);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+
+    if(!readOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "usage: %s [--shapes N] [--repetitions N] [--budget OPERATION=PER_SHAPE,FIXED]... [--output FILE]\n", argv[0]);
+        return 1;
+    }
+
+    if(!alloc::ENABLED)
+    {
+        std::fprintf(stderr, "built without SHAPE_ALLOC_TRACKING; no allocations are counted\n");
+        return 1;
+    }
+
+    /*! The offscreen platform lets the canvas be created and painted without a display */
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    std::string outputPath = options.output == "-" ? options.output : QDir::current().absoluteFilePath(QString::fromStdString(options.output)).toStdString();
+
+    QTemporaryDir workDir;
+
+    if(!workDir.isValid() || !QDir::setCurrent(workDir.path()))
+    {
+        std::fprintf(stderr, "cannot create a temporary directory\n");
+        return 1;
+    }
+
+    SceneSpec spec;
+    spec.shapeCount = options.shapes;
+    spec.width = CANVAS_WIDTH - MAX_EXTENT;
+    spec.height = CANVAS_HEIGHT - MAX_EXTENT;
+    spec.maxExtent = MAX_EXTENT;
+
+    if(SceneGenerator(spec).save("shapes.txt") < 0)
+    {
+        std::fprintf(stderr, "cannot write shapes.txt\n");
+        return 1;
+    }
+
+    for(int i = 0; i < alloc::NUM_OPERATIONS; ++i)
+    {
+        alloc::Budget budget;
+        budget.allocations = (long long)(std::ceil(options.budgets[i].perShape * options.shapes)) + options.budgets[i].fixed;
+
+        alloc::setBudget(alloc::eOperation(i), budget);
+    }
+
+    QImage image(CANVAS_WIDTH, CANVAS_HEIGHT, QImage::Format_ARGB32_Premultiplied);
+    AllShapes allShapes(&image);
+    allShapes.setParallelSave(false);
+
+    /*! Load */
+    allShapes.addShapesFromFile();
+
+    if(!allShapes.getParseReport().isClean() || allShapes.getShapeCount() != options.shapes)
+    {
+        std::fprintf(stderr, "the generated document did not load cleanly\n");
+        return 1;
+    }
+
+    myVector::vector<Shape*> &shapes = allShapes.getVector();
+
+    /*! Paint; the first frame also pays for the painter's one-time setup, which the fixed budget covers */
+    canvas area;
+    area.getShapes(shapes);
+
+    for(int i = 0; i < options.repetitions; ++i)
+    {
+        image.fill(Qt::white);
+        area.render(&image);
+    }
+
+    /*! Sort */
+    for(int i = 0; i < options.repetitions; ++i)
+    {
+        {
+            ALLOC_SCOPE(SORT);
+            selectionSort(shapes.begin(), shapes.end(), perimeterCompare);
+        }
+        {
+            ALLOC_SCOPE(SORT);
+            selectionSort(shapes.begin(), shapes.end(), areaCompare);
+        }
+        {
+            ALLOC_SCOPE(SORT);
+            selectionSort(shapes.begin(), shapes.end(), idCompare);
+        }
+    }
+
+    /*! Edit: shapes are moved, then removed and restored by undoing the removal, so the vector keeps its size */
+    int numEdits = std::min(NUM_EDITS, options.shapes);
+
+    for(int i = 0; i < options.repetitions; ++i)
+    {
+        for(int j = 0; j < numEdits; ++j)
+        {
+            allShapes.moveShape(shapes[j] -> getID(), QPoint(1, 1));
+        }
+
+        for(int j = 0; j < numEdits; ++j)
+        {
+            Shape *p_Shape = shapes[shapes.size() - 1];
+
+            allShapes.deleteShape(p_Shape -> getID());
+            allShapes.undo();
+        }
+    }
+
+    /*! Save */
+    for(int i = 0; i < options.repetitions; ++i)
+    {
+        allShapes.printAll();
+    }
+
+    std::printf("%-8s %6s %14s %14s %14s %10s\n", "Op", "Calls", "Most allocs", "Most bytes", "Budget", "Exceeded");
+
+    long long violations{0};
+
+    for(int i = 0; i < alloc::NUM_OPERATIONS; ++i)
+    {
+        print(alloc::eOperation(i));
+        violations += alloc::getOperation(alloc::eOperation(i)).budgetViolations;
+    }
+
+    std::string json = alloc::toJson();
+
+    if(outputPath == "-")
+    {
+        std::fputs(json.c_str(), stdout);
+    }
+    else
+    {
+        std::ofstream out(outputPath, std::ios::out | std::ios::trunc);
+        out << json;
+
+        if(!out)
+        {
+            std::fprintf(stderr, "cannot write %s\n", outputPath.c_str());
+            return 1;
+        }
+
+        std::printf("\nCounts written to %s\n", outputPath.c_str());
+    }
+
+    for(int i = 0; i < shapes.size(); ++i)
+    {
+        delete shapes[i];
+    }
+
+    if(violations > 0)
+    {
+        std::fprintf(stderr, "%lld calls exceeded their allocation budget\n", violations);
+        return 1;
+    }
+
+    return 0;
+}
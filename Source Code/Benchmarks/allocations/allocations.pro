@@ -0,0 +1,59 @@
+#-------------------------------------------------
+#
+# Allocation budget check: loads, paints, sorts,
+# edits, and saves a synthetic document with the
+# allocation tracker compiled in, and fails when
+# an operation allocates more than its budget.
+#
+#-------------------------------------------------
+
+TARGET = allocationbudgets
+TEMPLATE = app
+
+QT += core gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+DEFINES += SHAPE_ALLOC_TRACKING
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        allocationbudgets.cpp \
+        ../../allocationtracker.cpp \
+        ../../allshapes.cpp \
+        ../../memoryreport.cpp \
+        ../../canvas.cpp \
+        ../../parser.cpp \
+        ../../idallocator.cpp \
+        ../../commandlog.cpp \
+        ../../scenegenerator.cpp \
+        ../../intscanner.cpp \
+        ../../selectionsort.cpp \
+        ../../geometrystore.cpp \
+        ../../geometrykernels.cpp \
+        ../../shapevariant.cpp \
+        ../../parallelsaver.cpp \
+        ../../pagecache.cpp \
+        ../../pagedshapefile.cpp \
+        ../../qtconversions.cpp \
+        ../../shapewriter.cpp \
+        ../../shapeindex.cpp \
+        ../../styletable.cpp \
+        ../../shape.cpp \
+        ../../line.cpp \
+        ../../polyline.cpp \
+        ../../polygon.cpp \
+        ../../rectangle.cpp \
+        ../../square.cpp \
+        ../../ellipse.cpp \
+        ../../circle.cpp \
+        ../../text.cpp
+
+HEADERS += \
+    ../../allocationtracker.h \
+    ../../allshapes.h \
+    ../../canvas.h \
+    ../../scenegenerator.h \
+    ../../selectionsort.h
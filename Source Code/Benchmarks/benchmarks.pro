@@ -0,0 +1,19 @@
+#-------------------------------------------------
+#
+# Standalone benchmarks for the shape application.
+# Each subdirectory builds one console program that
+# links only the sources it measures.
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+        kernels \
+        keywords \
+        parse \
+        intscan \
+        suite \
+        allocations \
+        culling \
+        lazystore
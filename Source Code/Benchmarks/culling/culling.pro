@@ -0,0 +1,55 @@
+#-------------------------------------------------
+#
+# Culling check: repaints a canvas with a region
+# covering only a shape's ID label, and fails when
+# the shape is culled instead of drawn.
+#
+#-------------------------------------------------
+
+TARGET = cullingcheck
+TEMPLATE = app
+
+QT += core gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+DEFINES += SHAPE_PERF_COUNTERS
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        cullingcheck.cpp \
+        ../../canvas.cpp \
+        ../../perfcounters.cpp \
+        ../../parser.cpp \
+        ../../idallocator.cpp \
+        ../../intscanner.cpp \
+        ../../geometrystore.cpp \
+        ../../geometrykernels.cpp \
+        ../../shapevariant.cpp \
+        ../../pagecache.cpp \
+        ../../pagedshapefile.cpp \
+        ../../qtconversions.cpp \
+        ../../shapewriter.cpp \
+        ../../shapeindex.cpp \
+        ../../styletable.cpp \
+        ../../shape.cpp \
+        ../../line.cpp \
+        ../../polyline.cpp \
+        ../../polygon.cpp \
+        ../../rectangle.cpp \
+        ../../square.cpp \
+        ../../ellipse.cpp \
+        ../../circle.cpp \
+        ../../text.cpp
+
+HEADERS += \
+    ../../canvas.h \
+    ../../perfcounters.h \
+    ../../parser.h \
+    ../../idallocator.h \
+    ../../parsereport.h \
+    ../../geometrystore.h \
+    ../../shapevariant.h \
+    ../../shapewriter.h
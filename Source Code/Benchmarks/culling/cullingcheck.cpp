@@ -0,0 +1,133 @@
+/*!
+ * \file    cullingcheck.cpp
+ * \brief   Checks that the canvas only culls shapes that cannot paint into the repainted region, ID labels included.
+ *
+ * Every shape type draws its ID label in a LABEL_SIZE square that may lie outside its bounding box. The program checks
+ * that the paint bounds of one shape of each type hold its label, then repaints a canvas holding a single rectangle
+ * with a region covering only the rectangle's label, and reads the SHAPES_DRAWN and SHAPES_CULLED counters:
+ * the rectangle must be drawn. A region away from the rectangle and its label must cull it.
+ * The program exits with status 1 when any check fails, or when it was built without SHAPE_PERF_COUNTERS.
+ *
+ * Usage: cullingcheck
+ *
+ * It needs no display: it selects Qt's offscreen platform and the canvas paints into a QImage.
+*/
+
+#include "canvas.h"
+#include "perfcounters.h"
+#include "shape_list.h"
+#include <QApplication>
+#include <QImage>
+#include <QRegion>
+#include <cstdio>
+
+namespace
+{
+    const int CANVAS_WIDTH = 1000;      /*!< the width of the canvas, matching canvas::canvas() */
+    const int CANVAS_HEIGHT = 500;      /*!< the height of the canvas, matching canvas::canvas() */
+
+    int failures{0};                    /*!< the number of failed checks */
+
+    //! Prints the outcome of one check and counts it if it failed.
+    void check(bool passed, const char *name)
+    {
+        std::printf("%-4s %s\n", passed ? "ok" : "FAIL", name);
+
+        if(!passed)
+        {
+            ++failures;
+        }
+    }
+
+    //! Repaints a region of a canvas and counts the shapes drawn and culled.
+    void repaint(canvas &area, QImage &image, const QRect &region, long long &drawn, long long &culled)
+    {
+        perf::reset();
+        area.render(&image, region.topLeft(), QRegion(region));
+
+        drawn = perf::getCounter(perf::SHAPES_DRAWN);
+        culled = perf::getCounter(perf::SHAPES_CULLED);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+#ifndef SHAPE_PERF_COUNTERS
+    std::fprintf(stderr, "built without SHAPE_PERF_COUNTERS; no shapes are counted\n");
+    return 1;
+#endif
+
+    /*! The offscreen platform lets the canvas be created and painted without a display */
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    QPen pen;
+    pen.setWidth(2);
+
+    /*! Paint bounds of every shape type */
+    dim::specs lineDims[NUM_LINE_SPECS]{100, 100, 200, 150};
+    dim::specs polylineDims[6]{100, 100, 150, 200, 200, 120};
+    dim::specs polygonDims[6]{100, 100, 150, 200, 200, 120};
+    dim::specs rectangleDims[NUM_RECTANGLE_SPECS]{200, 150, 100, 60};
+    dim::specs squareDims[NUM_SQUARE_SPECS]{200, 150, 80};
+    dim::specs ellipseDims[NUM_ELLIPSE_SPECS]{200, 150, 100, 60};
+    dim::specs circleDims[NUM_CIRCLE_SPECS]{200, 150, 80};
+    dim::specs textDims[NUM_TEXT_SPECS]{200, 150, 100, 40};
+
+    Shape *shapes[NUM_SHAPES]
+    {
+        new class::Line(1, NUM_LINE_SPECS, lineDims),
+        new Polyline(2, 6, polylineDims),
+        new Polygon(3, 6, polygonDims),
+        new Rectangle(4, NUM_RECTANGLE_SPECS, rectangleDims),
+        new Square(5, NUM_SQUARE_SPECS, squareDims),
+        new Ellipse(6, NUM_ELLIPSE_SPECS, ellipseDims),
+        new Circle(7, NUM_CIRCLE_SPECS, circleDims),
+        new Text(8, NUM_TEXT_SPECS, textDims, QFont(), "text", Qt::AlignLeft)
+    };
+
+    for(Shape *p_Shape : shapes)
+    {
+        p_Shape -> setPen(pen);
+
+        std::string name = "paint bounds hold the label of a " + p_Shape -> getType();
+        check(p_Shape -> getPaintBounds().contains(p_Shape -> calcLabelRect()), name.c_str());
+    }
+
+    /*! Repaints of a canvas holding only the rectangle; the label sits above and to the left of its top left corner */
+    Shape *p_Rectangle = shapes[3];
+    myVector::vector<Shape*> document;
+    document.push_back(p_Rectangle);
+
+    canvas area;
+    area.getShapes(document);
+
+    QImage image(CANVAS_WIDTH, CANVAS_HEIGHT, QImage::Format_ARGB32_Premultiplied);
+    long long drawn{0};
+    long long culled{0};
+
+    QRect labelOnly = p_Rectangle -> calcLabelRect().adjusted(0, 0, -8, -8);
+    int margin = p_Rectangle -> getPen().width() + 1;
+
+    check(!p_Rectangle -> getBoundingBox().adjusted(-margin, -margin, margin, margin).intersects(labelOnly),
+          "the label only region misses the rectangle widened by its pen");
+
+    repaint(area, image, labelOnly, drawn, culled);
+    check(drawn == 1 && culled == 0, "a repaint of the rectangle's label only draws the rectangle");
+
+    repaint(area, image, QRect(800, 400, 40, 40), drawn, culled);
+    check(drawn == 0 && culled == 1, "a repaint away from the rectangle and its label culls it");
+
+    for(Shape *p_Shape : shapes)
+    {
+        delete p_Shape;
+    }
+
+    if(failures > 0)
+    {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
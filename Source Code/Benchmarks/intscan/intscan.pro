@@ -0,0 +1,21 @@
+#-------------------------------------------------
+#
+# Microbenchmark comparing the integer list scanner
+# with stream and std::from_chars parsing.
+#
+#-------------------------------------------------
+
+TARGET = intscanbenchmark
+TEMPLATE = app
+
+CONFIG += console c++17
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        intscanbenchmark.cpp \
+        ../../intscanner.cpp
+
+HEADERS += \
+    ../../intscanner.h
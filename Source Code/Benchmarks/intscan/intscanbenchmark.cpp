@@ -0,0 +1,207 @@
+/*!
+ * \file    intscanbenchmark.cpp
+ * \brief   Times reading ShapeDimensions lines with the former istringstream loop, std::from_chars, and the intscan scanner, in integers per second.
+*/
+
+#include "intscanner.h"
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int NUM_REPETITIONS = 10;     /*!< the number of timed runs; the fastest one is reported */
+
+    volatile long long sink;            /*!< keeps the compiler from discarding parsed values */
+
+    //! Times a function and returns the fastest of NUM_REPETITIONS calls in milliseconds.
+    double bestTime(const std::function<void()> &run)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        double best{0.0};
+
+        run();
+
+        for(int i = 0; i < NUM_REPETITIONS; ++i)
+        {
+            Clock::time_point start = Clock::now();
+            run();
+            double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            if(i == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+
+        return best;
+    }
+
+    //! Generates dimension lines as AllShapes::printAll() writes them.
+    /*! \param lineCount the number of lines
+     * \param valuesPerLine the number of integers per line
+     * \param maxValue the largest coordinate
+     */
+    std::vector<std::string> generate(int lineCount, int valuesPerLine, int maxValue, std::mt19937 &generator)
+    {
+        std::uniform_int_distribution<int> coordinate(0, maxValue);
+        std::vector<std::string> lines(lineCount);
+
+        for(std::string &line : lines)
+        {
+            for(int i = 0; i < valuesPerLine; ++i)
+            {
+                line += std::to_string(coordinate(generator));
+
+                if(i + 1 < valuesPerLine)
+                {
+                    line += ", ";
+                }
+            }
+        }
+
+        return lines;
+    }
+
+    //! The former parser: an istringstream per line, a vector, and a copied array.
+    long long parseStream(const std::vector<std::string> &lines)
+    {
+        long long sum{0};
+
+        for(const std::string &line : lines)
+        {
+            std::istringstream buffer{line};
+            std::vector<int> dims;
+            int dim;
+
+            while(buffer >> dim)
+            {
+                dims.push_back(dim);
+
+                if((buffer >> std::ws).peek() == ',')
+                {
+                    buffer.ignore();
+                }
+            }
+
+            int *copy = new int[dims.size()];
+
+            for(std::size_t i = 0; i < dims.size(); ++i)
+            {
+                copy[i] = dims[i];
+                sum += copy[i];
+            }
+
+            delete[] copy;
+        }
+
+        return sum;
+    }
+
+    //! One std::from_chars call per integer into a reused vector.
+    long long parseFromChars(const std::vector<std::string> &lines, std::vector<int> &dims)
+    {
+        long long sum{0};
+
+        for(const std::string &line : lines)
+        {
+            const char *p = line.data();
+            const char *last = p + line.size();
+
+            dims.clear();
+
+            while(p < last)
+            {
+                while(p < last && *p == ' ')
+                {
+                    ++p;
+                }
+
+                int dim;
+                std::from_chars_result result = std::from_chars(p, last, dim);
+
+                dims.push_back(dim);
+                p = result.ptr;
+
+                while(p < last && (*p == ' ' || *p == ','))
+                {
+                    ++p;
+                }
+            }
+
+            for(int dim : dims)
+            {
+                sum += dim;
+            }
+        }
+
+        return sum;
+    }
+
+    //! The scanner: count the fields, then write the integers into storage of that size.
+    template<typename Count, typename Parse>
+    long long parseScanner(const std::vector<std::string> &lines, std::vector<int> &storage, Count count, Parse parse)
+    {
+        long long sum{0};
+
+        for(const std::string &line : lines)
+        {
+            const char *first = line.data();
+            const char *last = first + line.size();
+            int fields = count(first, last);
+
+            parse(first, last, storage.data(), fields);
+
+            for(int i = 0; i < fields; ++i)
+            {
+                sum += storage[i];
+            }
+        }
+
+        return sum;
+    }
+
+    //! Times every parser on one set of lines and prints a row of the results table.
+    void benchmark(const char *name, int lineCount, int valuesPerLine, int maxValue, std::mt19937 &generator)
+    {
+        std::vector<std::string> lines = generate(lineCount, valuesPerLine, maxValue, generator);
+        std::vector<int> storage(valuesPerLine);
+        const double integers = double(lineCount) * valuesPerLine;
+
+        long long streamSum{0}, fromCharsSum{0}, scalarSum{0}, vectorSum{0};
+
+        double streamMs = bestTime([&]{ streamSum = parseStream(lines); });
+        double fromCharsMs = bestTime([&]{ fromCharsSum = parseFromChars(lines, storage); });
+        double scalarMs = bestTime([&]{ scalarSum = parseScanner(lines, storage, intscan::scalar::countFields, intscan::scalar::parseList); });
+        double vectorMs = bestTime([&]{ vectorSum = parseScanner(lines, storage, intscan::countFields, intscan::parseList); });
+
+        bool match = streamSum == fromCharsSum && streamSum == scalarSum && streamSum == vectorSum;
+
+        std::printf("%-18s %8.1f %8.1f %8.1f %8.1f %8.2fx %s\n", name,
+                    integers / streamMs / 1000.0, integers / fromCharsMs / 1000.0, integers / scalarMs / 1000.0, integers / vectorMs / 1000.0,
+                    streamMs / vectorMs, match ? "ok" : "MISMATCH");
+
+        sink = streamSum + fromCharsSum + scalarSum + vectorSum;
+    }
+}
+
+int main()
+{
+    std::mt19937 generator(2018);
+
+    std::printf("Dimension lines, %s scanner, best of %d runs, millions of integers per second\n\n", intscan::instructionSet(), NUM_REPETITIONS);
+    std::printf("%-18s %8s %8s %8s %8s %9s %s\n", "Lines", "stream", "charconv", "scalar", "intscan", "Speedup", "Results");
+
+    benchmark("rectangles", 200000, 4, 1000, generator);
+    benchmark("polygons (16)", 50000, 16, 1000, generator);
+    benchmark("polygons (256)", 4000, 256, 1000, generator);
+    benchmark("polygons (4096)", 250, 4096, 100000, generator);
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*!
+ * \file    kernelbenchmark.cpp
+ * \brief   Times every geometry kernel against its scalar version on inputs of one million vertices.
+*/
+
+#include "geometrykernels.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const int NUM_VERTICES = 1000000;   /*!< the number of vertices, segments, or shapes per kernel call */
+    const int NUM_REPETITIONS = 20;     /*!< the number of timed calls; the fastest one is reported */
+
+    volatile double sink;               /*!< keeps the compiler from discarding kernel results */
+
+    //! Times a function and returns the fastest of NUM_REPETITIONS calls in milliseconds.
+    double bestTime(const std::function<void()> &run)
+    {
+        using clock = std::chrono::steady_clock;
+
+        double best{0.0};
+
+        run();
+
+        for(int i = 0; i < NUM_REPETITIONS; ++i)
+        {
+            clock::time_point start = clock::now();
+            run();
+            double elapsed = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+            if(i == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+
+        return best;
+    }
+
+    //! Prints one row of the results table.
+    void report(const char *kernel, double scalarMs, double vectorMs, double scalarResult, double vectorResult)
+    {
+        double relativeError = std::fabs(scalarResult - vectorResult) / std::max(1.0, std::fabs(scalarResult));
+
+        std::printf("%-18s %10.3f %10.3f %8.2fx %12.2e\n", kernel, scalarMs, vectorMs, scalarMs / vectorMs, relativeError);
+    }
+}
+
+int main()
+{
+    std::mt19937 generator(2018);
+    std::uniform_int_distribution<int> coordinate(0, 4000);
+    std::uniform_int_distribution<int> size(1, 500);
+
+    std::vector<int> x(NUM_VERTICES), y(NUM_VERTICES), x2(NUM_VERTICES), y2(NUM_VERTICES);
+    std::vector<int> a(NUM_VERTICES), b(NUM_VERTICES);
+    std::vector<double> scalarOut(NUM_VERTICES), vectorOut(NUM_VERTICES), areaOut(NUM_VERTICES);
+
+    for(int i = 0; i < NUM_VERTICES; ++i)
+    {
+        x[i] = coordinate(generator);
+        y[i] = coordinate(generator);
+        x2[i] = coordinate(generator);
+        y2[i] = coordinate(generator);
+        a[i] = size(generator);
+        b[i] = size(generator);
+    }
+
+    const int *px = x.data(), *py = y.data(), *px2 = x2.data(), *py2 = y2.data(), *pa = a.data(), *pb = b.data();
+
+    std::printf("Geometry kernels, %d elements, best of %d runs, instruction set: %s\n\n", NUM_VERTICES, NUM_REPETITIONS, geometry::instructionSet());
+    std::printf("%-18s %10s %10s %9s %12s\n", "Kernel", "Scalar ms", "Vector ms", "Speedup", "Rel. error");
+
+    double scalarResult{0.0}, vectorResult{0.0};
+    double scalarMs, vectorMs;
+
+    scalarMs = bestTime([&]{ scalarResult = geometry::scalar::segmentLengthSum(px, py, NUM_VERTICES, true); });
+    vectorMs = bestTime([&]{ vectorResult = geometry::segmentLengthSum(px, py, NUM_VERTICES, true); });
+    report("segmentLengthSum", scalarMs, vectorMs, scalarResult, vectorResult);
+
+    scalarMs = bestTime([&]{ scalarResult = geometry::scalar::shoelaceArea(px, py, NUM_VERTICES); });
+    vectorMs = bestTime([&]{ vectorResult = geometry::shoelaceArea(px, py, NUM_VERTICES); });
+    report("shoelaceArea", scalarMs, vectorMs, scalarResult, vectorResult);
+
+    scalarMs = bestTime([&]{ geometry::scalar::lineLengths(px, py, px2, py2, NUM_VERTICES, scalarOut.data()); });
+    vectorMs = bestTime([&]{ geometry::lineLengths(px, py, px2, py2, NUM_VERTICES, vectorOut.data()); });
+    report("lineLengths", scalarMs, vectorMs, scalarOut.back(), vectorOut.back());
+
+    scalarMs = bestTime([&]{ geometry::scalar::ellipseMetrics(pa, pb, NUM_VERTICES, scalarOut.data(), areaOut.data()); });
+    vectorMs = bestTime([&]{ geometry::ellipseMetrics(pa, pb, NUM_VERTICES, vectorOut.data(), areaOut.data()); });
+    report("ellipseMetrics", scalarMs, vectorMs, scalarOut.back(), vectorOut.back());
+
+    scalarMs = bestTime([&]{ geometry::scalar::circleMetrics(pa, NUM_VERTICES, scalarOut.data(), areaOut.data()); });
+    vectorMs = bestTime([&]{ geometry::circleMetrics(pa, NUM_VERTICES, vectorOut.data(), areaOut.data()); });
+    report("circleMetrics", scalarMs, vectorMs, scalarOut.back(), vectorOut.back());
+
+    int minX{0}, minY{0}, maxX{0}, maxY{0};
+
+    scalarMs = bestTime([&]{ geometry::scalar::boundingBox(px, py, NUM_VERTICES, minX, minY, maxX, maxY); scalarResult = maxX - minX + maxY - minY; });
+    vectorMs = bestTime([&]{ geometry::boundingBox(px, py, NUM_VERTICES, minX, minY, maxX, maxY); vectorResult = maxX - minX + maxY - minY; });
+    report("boundingBox", scalarMs, vectorMs, scalarResult, vectorResult);
+
+    sink = scalarResult + vectorResult + scalarOut[0] + vectorOut[0] + areaOut[0];
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#-------------------------------------------------
+#
+# Microbenchmark comparing the vectorized geometry
+# kernels with their scalar versions.
+#
+#-------------------------------------------------
+
+TARGET = kernelbenchmark
+TEMPLATE = app
+
+CONFIG += console c++11
+CONFIG -= app_bundle qt
+
+# The kernels use SSE2 on x86-64 by default.
+# Uncomment the line matching your compiler to build the AVX2 kernels instead.
+#QMAKE_CXXFLAGS += -mavx2
+#QMAKE_CXXFLAGS += /arch:AVX2
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        kernelbenchmark.cpp \
+        ../../geometrykernels.cpp
+
+HEADERS += \
+    ../../geometrykernels.h \
+    ../../custommath.h
@@ -0,0 +1,125 @@
+/*!
+ * \file    keywordbenchmark.cpp
+ * \brief   Times keyword lookups through the perfect hash tables against the former linear search over std::string arrays.
+*/
+
+#include "keywordtables.h"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int NUM_LOOKUPS = 1000000;    /*!< the number of keywords looked up per run */
+    const int NUM_REPETITIONS = 20;     /*!< the number of timed runs; the fastest one is reported */
+
+    volatile long long sink;            /*!< keeps the compiler from discarding lookup results */
+
+    //! Times a function and returns the fastest of NUM_REPETITIONS calls in milliseconds.
+    double bestTime(const std::function<void()> &run)
+    {
+        using clock = std::chrono::steady_clock;
+
+        double best{0.0};
+
+        run();
+
+        for(int i = 0; i < NUM_REPETITIONS; ++i)
+        {
+            clock::time_point start = clock::now();
+            run();
+            double elapsed = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+            if(i == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+
+        return best;
+    }
+
+    //! One keyword group as the application used to store it: parallel arrays of strings and values.
+    struct LinearTable
+    {
+        std::vector<std::string> names;     /*!< the keywords */
+        std::vector<int> values;            /*!< the enumeration value of each keyword */
+
+        //! The former lookup: compares the keyword with every string in turn.
+        int find(const std::string &name) const
+        {
+            for(std::size_t i = 0; i < names.size(); ++i)
+            {
+                if(names[i] == name)
+                {
+                    return values[i];
+                }
+            }
+
+            return -1;
+        }
+    };
+
+    //! Builds the string arrays of a keyword table.
+    template<std::size_t N>
+    LinearTable makeLinear(const keywords::Keyword (&list)[N])
+    {
+        LinearTable table;
+
+        for(const keywords::Keyword &keyword : list)
+        {
+            table.names.emplace_back(keyword.name);
+            table.values.push_back(keyword.value);
+        }
+
+        return table;
+    }
+
+    //! Times one keyword group and prints a row of the results table.
+    template<std::size_t N>
+    void benchmark(const char *group, const keywords::Keyword (&list)[N], const keywords::KeywordTable<N> &table, std::mt19937 &generator)
+    {
+        LinearTable linear = makeLinear(list);
+        std::uniform_int_distribution<int> pick(0, int(N) - 1);
+        std::vector<std::string> input(NUM_LOOKUPS);
+
+        for(std::string &name : input)
+        {
+            name = std::string(list[pick(generator)].name);
+        }
+
+        long long linearSum{0}, hashSum{0};
+
+        double linearMs = bestTime([&]{ linearSum = 0; for(const std::string &name : input) linearSum += linear.find(name); });
+        double hashMs = bestTime([&]{ hashSum = 0; for(const std::string &name : input) hashSum += table.find(name); });
+
+        std::printf("%-14s %4zu %10.3f %10.3f %8.2fx %s\n", group, N, linearMs, hashMs, linearMs / hashMs, linearSum == hashSum ? "ok" : "MISMATCH");
+
+        sink = linearSum + hashSum;
+    }
+}
+
+int main()
+{
+    using namespace keywords;
+
+    std::mt19937 generator(2018);
+
+    std::printf("Keyword lookups, %d per run, best of %d runs\n\n", NUM_LOOKUPS, NUM_REPETITIONS);
+    std::printf("%-14s %4s %10s %10s %9s %s\n", "Table", "Size", "Linear ms", "Hash ms", "Speedup", "Results");
+
+    benchmark("colors", COLOR_KEYWORDS, COLOR_TABLE, generator);
+    benchmark("pen styles", PEN_STYLE_KEYWORDS, PEN_STYLE_TABLE, generator);
+    benchmark("cap styles", CAP_STYLE_KEYWORDS, CAP_STYLE_TABLE, generator);
+    benchmark("join styles", JOIN_STYLE_KEYWORDS, JOIN_STYLE_TABLE, generator);
+    benchmark("brush styles", BRUSH_STYLE_KEYWORDS, BRUSH_STYLE_TABLE, generator);
+    benchmark("alignments", ALIGNMENT_KEYWORDS, ALIGNMENT_TABLE, generator);
+    benchmark("font styles", FONT_STYLE_KEYWORDS, FONT_STYLE_TABLE, generator);
+    benchmark("font weights", FONT_WEIGHT_KEYWORDS, FONT_WEIGHT_TABLE, generator);
+    benchmark("shape types", SHAPE_TYPE_KEYWORDS, SHAPE_TYPE_TABLE, generator);
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Microbenchmark comparing the perfect hash keyword
+# tables with a linear search over string arrays.
+#
+#-------------------------------------------------
+
+TARGET = keywordbenchmark
+TEMPLATE = app
+
+CONFIG += console c++17
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        keywordbenchmark.cpp
+
+HEADERS += \
+    ../../keywordtables.h
@@ -0,0 +1,49 @@
+#-------------------------------------------------
+#
+# Lazy store check: opens a shape file through
+# LazyShapeStore and fails when shapes are built
+# before they are asked for, or not evicted.
+#
+#-------------------------------------------------
+
+TARGET = lazystorecheck
+TEMPLATE = app
+
+QT += core gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        lazystorecheck.cpp \
+        ../../lazyshapestore.cpp \
+        ../../parser.cpp \
+        ../../idallocator.cpp \
+        ../../intscanner.cpp \
+        ../../geometrystore.cpp \
+        ../../geometrykernels.cpp \
+        ../../shapevariant.cpp \
+        ../../qtconversions.cpp \
+        ../../shapewriter.cpp \
+        ../../shapeindex.cpp \
+        ../../styletable.cpp \
+        ../../shape.cpp \
+        ../../line.cpp \
+        ../../polyline.cpp \
+        ../../polygon.cpp \
+        ../../rectangle.cpp \
+        ../../square.cpp \
+        ../../ellipse.cpp \
+        ../../circle.cpp \
+        ../../text.cpp
+
+HEADERS += \
+    ../../lazyshapestore.h \
+    ../../shapeindex.h \
+    ../../parser.h \
+    ../../idallocator.h \
+    ../../parsereport.h \
+    ../../shapevariant.h \
+    ../../shapewriter.h
@@ -0,0 +1,159 @@
+/*!
+ * \file    lazystorecheck.cpp
+ * \brief   Checks that LazyShapeStore opens a file without constructing shapes, loads them on demand, and evicts cold ones.
+ *
+ * The program writes a shape file of rectangles laid out on a grid, with one bad record, and opens it through the store.
+ * It checks that opening constructs no shape, that getShape() parses a record once and then answers from memory,
+ * that a small memory budget evicts the least recently used shapes but never a pinned one, that an evicted shape is parsed
+ * again with the same dimensions, that region queries load nothing, and that the bad record loads as nullptr and is reported.
+ * The program exits with status 1 when any check fails.
+ *
+ * Usage: lazystorecheck
+*/
+
+#include "lazyshapestore.h"
+#include "shapewriter.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int NUM_RECORDS = 100;        /*!< the number of records in the generated file */
+    const int GRID_COLUMNS = 10;        /*!< the number of rectangles per row of the grid */
+    const int CELL_SIZE = 100;          /*!< the distance between the rectangles of the grid */
+    const int RECTANGLE_SIZE = 50;      /*!< the width and height of every rectangle */
+    const int BAD_RECORD_ID = 7;        /*!< the ID of the record written with a bad pen width */
+
+    int failures{0};                    /*!< the number of failed checks */
+
+    //! Prints the outcome of one check and counts it if it failed.
+    void check(bool passed, const char *name)
+    {
+        std::printf("%-4s %s\n", passed ? "ok" : "FAIL", name);
+
+        if(!passed)
+        {
+            ++failures;
+        }
+    }
+
+    //! Writes the grid of rectangles in the format of AllShapes::printAll().
+    bool writeFile(const std::string &fileName)
+    {
+        using namespace ShapeFields;
+
+        std::ofstream out(fileName, std::ios::out | std::ios::binary);
+        ShapeWriter writer(out);
+
+        for(int shapeId = 1; shapeId <= NUM_RECORDS; ++shapeId)
+        {
+            int cell = shapeId - 1;
+            int dims[4] = {(cell % GRID_COLUMNS) * CELL_SIZE, (cell / GRID_COLUMNS) * CELL_SIZE, RECTANGLE_SIZE, RECTANGLE_SIZE};
+
+            writer.writeField(SHAPE_ID, shapeId);
+            writer.writeField(SHAPE_TYPE, "Rectangle");
+            writer.writeList(SHAPE_DIMENSIONS, dims, 4);
+            writer.writeField(PEN_COLOR, "blue");
+
+            if(shapeId == BAD_RECORD_ID)
+            {
+                writer.writeField(PEN_WIDTH, "2x");
+            }
+            else
+            {
+                writer.writeField(PEN_WIDTH, 2);
+            }
+
+            writer.writeField(PEN_STYLE, "SolidLine");
+            writer.writeField(PEN_CAP_STYLE, "FlatCap");
+            writer.writeField(PEN_JOIN_STYLE, "MiterJoin");
+            writer.writeField(BRUSH_COLOR, "yellow");
+            writer.writeField(BRUSH_STYLE, "SolidPattern");
+            writer.newline();
+        }
+
+        writer.flush();
+
+        return bool(out);
+    }
+}
+
+int main()
+{
+    std::string fileName = (std::filesystem::temp_directory_path() / "lazystorecheck_shapes.txt").string();
+
+    if(!writeFile(fileName))
+    {
+        std::fprintf(stderr, "cannot write %s\n", fileName.c_str());
+        return 1;
+    }
+
+    {
+        LazyShapeStore store;
+
+        check(store.open(fileName, nullptr), "the file opens");
+        check(store.getIndex().size() == NUM_RECORDS, "every record is indexed");
+        check(store.getResidentCount() == 0 && store.getLoadCount() == 0, "opening constructs no shape");
+
+        /*! Loading on demand */
+        Shape *p_Shape = store.getShape(42);
+
+        check(p_Shape != nullptr && p_Shape -> getID() == 42, "a shape is loaded by ID");
+        check(store.getLoadCount() == 1 && store.isResident(42), "loading a shape parses only its record");
+
+        store.getShape(42);
+        check(store.getHitCount() == 1 && store.getLoadCount() == 1, "a resident shape is not parsed again");
+        check(store.getShape(NUM_RECORDS + 1) == nullptr, "an unknown ID loads nothing");
+
+        /*! Region queries */
+        std::vector<int> inRegion = store.queryRegion(QRect(0, 0, CELL_SIZE * 2, CELL_SIZE));
+
+        check(inRegion.size() == 2, "a region query finds the shapes in the region");
+        check(store.getResidentCount() == 1, "a region query loads no shape");
+
+        /*! Eviction */
+        std::size_t shapeBytes = store.getResidentBytes();
+
+        store.setPinned(42, true);
+        store.setMemoryBudget(shapeBytes * 4);
+
+        for(int shapeId = 10; shapeId < 30; ++shapeId)
+        {
+            store.getShape(shapeId);
+        }
+
+        check(store.getResidentBytes() <= shapeBytes * 4, "the resident shapes fit the memory budget");
+        check(store.getEvictionCount() > 0, "loading past the budget evicts shapes");
+        check(store.isResident(42), "a pinned shape is not evicted");
+        check(!store.isResident(10) && store.isResident(29), "the least recently used shapes are evicted first");
+
+        /*! Reloading an evicted shape */
+        long long loads = store.getLoadCount();
+        p_Shape = store.getShape(10);
+
+        check(store.getLoadCount() == loads + 1, "an evicted shape is parsed again");
+        check(p_Shape != nullptr && p_Shape -> getDimensions()[0] == (9 % GRID_COLUMNS) * CELL_SIZE
+              && p_Shape -> getDimensions()[1] == (9 / GRID_COLUMNS) * CELL_SIZE, "a reloaded shape has its dimensions");
+
+        /*! Bad records */
+        check(store.getParseReport().isClean(), "no error is reported before the bad record is loaded");
+        check(store.getShape(BAD_RECORD_ID) == nullptr, "a bad record loads as nullptr");
+        check(!store.getParseReport().isClean(), "a bad record is listed in the parse report");
+
+        store.setPinned(42, false);
+    }
+
+    std::filesystem::remove(fileName);
+    std::filesystem::remove(ShapeIndex::sidecarName(fileName));
+
+    if(failures > 0)
+    {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#-------------------------------------------------
+#
+# Benchmark comparing parse speed of clean shape
+# files with files holding sparse bad records.
+#
+#-------------------------------------------------
+
+TARGET = parsebenchmark
+TEMPLATE = app
+
+QT += core gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        parsebenchmark.cpp \
+        ../../parser.cpp \
+        ../../idallocator.cpp \
+        ../../intscanner.cpp \
+        ../../qtconversions.cpp \
+        ../../shapewriter.cpp \
+        ../../shapeindex.cpp \
+        ../../styletable.cpp \
+        ../../shape.cpp \
+        ../../line.cpp \
+        ../../polyline.cpp \
+        ../../polygon.cpp \
+        ../../rectangle.cpp \
+        ../../square.cpp \
+        ../../ellipse.cpp \
+        ../../circle.cpp \
+        ../../text.cpp
+
+HEADERS += \
+    ../../parser.h \
+    ../../idallocator.h \
+    ../../parsereport.h \
+    ../../shapewriter.h \
+    ../../keywordtables.h
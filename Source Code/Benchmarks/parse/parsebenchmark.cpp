@@ -0,0 +1,154 @@
+/*!
+ * \file    parsebenchmark.cpp
+ * \brief   Times Parser::parseText() on a clean shape file and on copies with one bad record in every thousand.
+*/
+
+#include "parser.h"
+#include "shapewriter.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int NUM_RECORDS = 200000;     /*!< the number of records per generated file */
+    const int NUM_REPETITIONS = 5;      /*!< the number of timed runs; the fastest one is reported */
+
+    //! The kinds of damage written into bad records.
+    enum eDamage {NO_DAMAGE, BAD_NUMBER, BAD_KEYWORD, MISSING_FIELD, BAD_DIMENSION_COUNT, NUM_DAMAGES};
+
+    //! Writes one record in the format of AllShapes::printAll(), damaged as asked.
+    void writeRecord(ShapeWriter &writer, int shapeId, std::mt19937 &generator, eDamage damage)
+    {
+        using namespace ShapeFields;
+
+        std::uniform_int_distribution<int> coordinate(0, 4000);
+        int dims[4] = {coordinate(generator), coordinate(generator), coordinate(generator) % 200 + 1, coordinate(generator) % 200 + 1};
+
+        writer.writeField(SHAPE_ID, shapeId);
+
+        if(shapeId % 4 == 0)
+        {
+            writer.writeField(SHAPE_TYPE, "Text");
+            writer.writeList(SHAPE_DIMENSIONS, dims, damage == BAD_DIMENSION_COUNT ? 3 : 4);
+            writer.writeField(TEXT_STRING, "Shape number " + std::to_string(shapeId));
+            writer.writeField(TEXT_COLOR, damage == BAD_KEYWORD ? "bleu" : "blue");
+            writer.writeField(TEXT_ALIGNMENT, "AlignCenter");
+            writer.writeField(TEXT_POINT_SIZE, 10 + shapeId % 8);
+            writer.writeField(TEXT_FONT_FAMILY, "Comic Sans MS");
+            writer.writeField(TEXT_FONT_STYLE, "StyleNormal");
+
+            if(damage != MISSING_FIELD)
+            {
+                writer.writeField(TEXT_FONT_WEIGHT, "Normal");
+            }
+
+            return;
+        }
+
+        writer.writeField(SHAPE_TYPE, shapeId % 4 == 1 ? "Line" : shapeId % 4 == 2 ? "Rectangle" : "Ellipse");
+        writer.writeList(SHAPE_DIMENSIONS, dims, damage == BAD_DIMENSION_COUNT ? 3 : 4);
+        writer.writeField(PEN_COLOR, damage == BAD_KEYWORD ? "bleu" : "blue");
+
+        if(damage == BAD_NUMBER)
+        {
+            writer.writeField(PEN_WIDTH, "2x");
+        }
+        else
+        {
+            writer.writeField(PEN_WIDTH, 1 + shapeId % 6);
+        }
+
+        writer.writeField(PEN_STYLE, "DashDotLine");
+        writer.writeField(PEN_CAP_STYLE, "FlatCap");
+
+        if(damage != MISSING_FIELD)
+        {
+            writer.writeField(PEN_JOIN_STYLE, "MiterJoin");
+        }
+
+        if(shapeId % 4 != 1)
+        {
+            writer.writeField(BRUSH_COLOR, "yellow");
+            writer.writeField(BRUSH_STYLE, "SolidPattern");
+        }
+    }
+
+    //! Generates a shape file with one bad record in every errorInterval records, or none if errorInterval is 0.
+    std::string generate(int errorInterval)
+    {
+        std::vector<char> buffer;
+        std::mt19937 generator(2018);
+        ShapeWriter writer(buffer);
+
+        for(int i = 1; i <= NUM_RECORDS; ++i)
+        {
+            eDamage damage = errorInterval > 0 && i % errorInterval == 0 ? eDamage(1 + (i / errorInterval) % (NUM_DAMAGES - 1)) : NO_DAMAGE;
+
+            writeRecord(writer, i, generator, damage);
+            writer.newline();
+        }
+
+        return std::string(buffer.data(), std::size_t(writer.getBytesWritten()));
+    }
+
+    //! Parses a file NUM_REPETITIONS times and prints a row of the results table.
+    /*! \returns The fastest time in milliseconds.
+     */
+    double benchmark(const char *name, const std::string &text, double cleanMs)
+    {
+        double best{0.0};
+        ParseReport report;
+        Parser parser;
+
+        /*! The first run is not timed; it fills the style caches */
+        for(int i = -1; i < NUM_REPETITIONS; ++i)
+        {
+            std::vector<Shape*> shapes;
+            shapes.reserve(NUM_RECORDS);
+            report = ParseReport();
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            parser.parseText(text, shapes, nullptr, report);
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            for(Shape *p_Shape : shapes)
+            {
+                delete p_Shape;
+            }
+
+            if(i < 0)
+            {
+                continue;
+            }
+
+            if(i == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+
+        std::printf("%-22s %9d %8d %8d %10.2f %12.0f %8.2fx\n", name, report.recordsParsed, report.recordsSkipped, report.errorCount,
+                    best, (report.recordsParsed + report.recordsSkipped) / best * 1000.0, cleanMs > 0.0 ? best / cleanMs : 1.0);
+
+        return best;
+    }
+}
+
+int main()
+{
+    std::string clean = generate(0);
+    std::string sparse = generate(1000);
+    std::string dense = generate(10);
+
+    std::printf("Parsing %d records from memory, best of %d runs\n\n", NUM_RECORDS, NUM_REPETITIONS);
+    std::printf("%-22s %9s %8s %8s %10s %12s %9s\n", "File", "Parsed", "Skipped", "Errors", "ms", "Records/s", "vs clean");
+
+    double cleanMs = benchmark("clean", clean, 0.0);
+    benchmark("1 bad in 1000", sparse, cleanMs);
+    benchmark("1 bad in 10", dense, cleanMs);
+
+    return 0;
+}
@@ -0,0 +1,462 @@
+/*!
+ * \file    benchmarksuite.cpp
+ * \brief   Times the hot paths of the application on synthetic documents of growing size and writes the results as JSON.
+ *
+ * Covered paths: parsing a shape file, the shape vector, the selection sort of the shape tables,
+ * the perimeter and area calculations, and painting the canvas.
+ * Every benchmark runs untimed warm-up repetitions first, then timed repetitions; the JSON output holds every sample
+ * together with the minimum, percentiles, maximum, mean, and the throughput at the median.
+ *
+ * Usage: benchmarksuite [--sizes 1000,10000,100000,1000000] [--warmup N] [--repetitions N]
+ *                       [--max-sort-size N] [--filter TEXT] [--output FILE]
+ *
+ * The program needs no display: it selects Qt's offscreen platform before the application object is created,
+ * and the canvas paints into a QImage.
+*/
+
+#include "canvas.h"
+#include "geometrystore.h"
+#include "parser.h"
+#include "scenegenerator.h"
+#include "selectionsort.h"
+#include <QApplication>
+#include <QImage>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int CANVAS_WIDTH = 1000;      /*!< the width of the canvas, matching canvas::canvas() */
+    const int CANVAS_HEIGHT = 500;      /*!< the height of the canvas, matching canvas::canvas() */
+    const int MAX_EXTENT = 60;          /*!< the largest width, height, side, or radius of a generated shape */
+    const int NUM_ERASES = 100;         /*!< the number of erasures from the middle of the shape vector per repetition */
+
+    volatile double sink;               /*!< keeps the compiler from discarding results */
+
+    /*! \struct Options
+     * \brief The command line settings.
+     */
+    struct Options
+    {
+        std::vector<int> sizes{1000, 10000, 100000, 1000000};  /*!< the numbers of shapes per document */
+        int warmup{2};                                          /*!< the untimed repetitions run before the timed ones */
+        int repetitions{10};                                    /*!< the timed repetitions */
+        int maxSortSize{10000};                                 /*!< the largest document sorted, since the selection sort is quadratic */
+        std::string filter;                                     /*!< runs only the benchmarks whose name contains this text */
+        std::string output{"benchmarksuite.json"};              /*!< the path of the JSON output, or "-" for standard output */
+    };
+
+    /*! \struct Result
+     * \brief The samples of one benchmark on one document size.
+     */
+    struct Result
+    {
+        std::string name;               /*!< the benchmark, as "area/operation" */
+        int size{0};                    /*!< the number of shapes in the document */
+        long long items{0};             /*!< the units of work per repetition, used for the throughput */
+        std::vector<double> samples;    /*!< the time of every timed repetition, in milliseconds, in run order */
+    };
+
+    /*! \struct Skipped
+     * \brief A benchmark left out for a document size, and why.
+     */
+    struct Skipped
+    {
+        std::string name;       /*!< the benchmark */
+        int size{0};            /*!< the number of shapes in the document */
+        std::string reason;     /*!< why it was left out */
+    };
+
+    //! Generates a document of numShapes shapes, evenly mixed, placed on the canvas; the same size always gives the same document.
+    std::string generate(int numShapes)
+    {
+        SceneSpec spec;
+        spec.shapeCount = numShapes;
+        spec.width = CANVAS_WIDTH - MAX_EXTENT;
+        spec.height = CANVAS_HEIGHT - MAX_EXTENT;
+        spec.maxExtent = MAX_EXTENT;
+
+        return SceneGenerator(spec).generate();
+    }
+
+    //! Runs a benchmark: options.warmup untimed repetitions, then options.repetitions timed ones.
+    /*! \param prepare the untimed work done before every repetition, such as restoring an unsorted copy; may be empty
+     * \param run the timed work
+     * \param cleanup the untimed work done after every repetition, such as deleting parsed shapes; may be empty
+     */
+    Result measure(const Options &options, const std::string &name, int size, long long items,
+                   const std::function<void()> &prepare, const std::function<void()> &run, const std::function<void()> &cleanup)
+    {
+        using clock = std::chrono::steady_clock;
+
+        Result result;
+        result.name = name;
+        result.size = size;
+        result.items = items;
+
+        for(int i = -options.warmup; i < options.repetitions; ++i)
+        {
+            if(prepare)
+            {
+                prepare();
+            }
+
+            clock::time_point start = clock::now();
+            run();
+            double elapsed = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+            if(cleanup)
+            {
+                cleanup();
+            }
+
+            if(i >= 0)
+            {
+                result.samples.push_back(elapsed);
+            }
+        }
+
+        return result;
+    }
+
+    //! Gets a percentile of sorted samples by the nearest rank method.
+    double percentile(const std::vector<double> &sorted, double percent)
+    {
+        int rank = int(std::ceil(percent / 100.0 * double(sorted.size())));
+
+        return sorted[std::size_t(std::max(1, rank) - 1)];
+    }
+
+    //! Escapes the characters JSON does not allow inside a string.
+    std::string escape(const std::string &text)
+    {
+        std::string escaped;
+
+        for(char character : text)
+        {
+            if(character == '"' || character == '\\')
+            {
+                escaped += '\\';
+            }
+
+            escaped += character;
+        }
+
+        return escaped;
+    }
+
+    //! Formats the results and the skipped benchmarks as a JSON document.
+    std::string toJson(const Options &options, const std::vector<Result> &results, const std::vector<Skipped> &skipped)
+    {
+        std::ostringstream json;
+        json.precision(6);
+
+        json << "{\n  \"suite\": \"ClassProjv1\",\n  \"warmup\": " << options.warmup << ",\n  \"repetitions\": " << options.repetitions
+             << ",\n  \"results\": [";
+
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &result = results[i];
+            std::vector<double> sorted = result.samples;
+            std::sort(sorted.begin(), sorted.end());
+
+            double mean{0.0};
+
+            for(double sample : sorted)
+            {
+                mean += sample;
+            }
+
+            mean /= double(sorted.size());
+
+            double median = percentile(sorted, 50.0);
+
+            json << (i == 0 ? "\n" : ",\n")
+                 << "    {\"name\": \"" << escape(result.name) << "\", \"size\": " << result.size << ", \"items\": " << result.items
+                 << ", \"min_ms\": " << sorted.front() << ", \"p50_ms\": " << median << ", \"p90_ms\": " << percentile(sorted, 90.0)
+                 << ", \"p99_ms\": " << percentile(sorted, 99.0) << ", \"max_ms\": " << sorted.back() << ", \"mean_ms\": " << mean
+                 << ", \"items_per_second\": " << (median > 0.0 ? double(result.items) / median * 1000.0 : 0.0) << ", \"samples_ms\": [";
+
+            for(std::size_t j = 0; j < result.samples.size(); ++j)
+            {
+                json << (j == 0 ? "" : ", ") << result.samples[j];
+            }
+
+            json << "]}";
+        }
+
+        json << "\n  ],\n  \"skipped\": [";
+
+        for(std::size_t i = 0; i < skipped.size(); ++i)
+        {
+            json << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << escape(skipped[i].name) << "\", \"size\": " << skipped[i].size
+                 << ", \"reason\": \"" << escape(skipped[i].reason) << "\"}";
+        }
+
+        json << (skipped.empty() ? "]\n}\n" : "\n  ]\n}\n");
+
+        return json.str();
+    }
+
+    //! Prints one row of the results table.
+    void print(const Result &result)
+    {
+        std::vector<double> sorted = result.samples;
+        std::sort(sorted.begin(), sorted.end());
+
+        double median = percentile(sorted, 50.0);
+
+        std::printf("%-22s %9d %10.3f %10.3f %10.3f %14.0f\n", result.name.c_str(), result.size, sorted.front(), median,
+                    percentile(sorted, 90.0), median > 0.0 ? double(result.items) / median * 1000.0 : 0.0);
+        std::fflush(stdout);
+    }
+
+    //! Reads a comma separated list of sizes.
+    std::vector<int> readSizes(const char *text)
+    {
+        std::vector<int> sizes;
+        std::istringstream in(text);
+        std::string item;
+
+        while(std::getline(in, item, ','))
+        {
+            int size = std::atoi(item.c_str());
+
+            if(size > 0)
+            {
+                sizes.push_back(size);
+            }
+        }
+
+        return sizes;
+    }
+
+    //! Reads the command line.
+    /*! \returns FALSE if an option is unknown or misses its value.
+     */
+    bool readOptions(int argc, char *argv[], Options &options)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const char *option = argv[i];
+
+            if(i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *value = argv[++i];
+
+            if(std::strcmp(option, "--sizes") == 0)
+            {
+                options.sizes = readSizes(value);
+            }
+            else if(std::strcmp(option, "--warmup") == 0)
+            {
+                options.warmup = std::max(0, std::atoi(value));
+            }
+            else if(std::strcmp(option, "--repetitions") == 0)
+            {
+                options.repetitions = std::max(1, std::atoi(value));
+            }
+            else if(std::strcmp(option, "--max-sort-size") == 0)
+            {
+                options.maxSortSize = std::atoi(value);
+            }
+            else if(std::strcmp(option, "--filter") == 0)
+            {
+                options.filter = value;
+            }
+            else if(std::strcmp(option, "--output") == 0)
+            {
+                options.output = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return !options.sizes.empty();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+
+    if(!readOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "usage: %s [--sizes N,N,...] [--warmup N] [--repetitions N] [--max-sort-size N] [--filter TEXT] [--output FILE]\n", argv[0]);
+        return 1;
+    }
+
+    /*! The offscreen platform lets the canvas be created and painted without a display */
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    std::vector<Result> results;
+    std::vector<Skipped> skipped;
+
+    //! Runs a benchmark if it passes the filter, and records and prints its result.
+    auto bench = [&](const std::string &name, int size, long long items, const std::function<void()> &prepare,
+                     const std::function<void()> &run, const std::function<void()> &cleanup)
+    {
+        if(name.find(options.filter) == std::string::npos)
+        {
+            return;
+        }
+
+        results.push_back(measure(options, name, size, items, prepare, run, cleanup));
+        print(results.back());
+    };
+
+    std::printf("%d warm-up and %d timed runs per benchmark\n\n", options.warmup, options.repetitions);
+    std::printf("%-22s %9s %10s %10s %10s %14s\n", "Benchmark", "Shapes", "min ms", "p50 ms", "p90 ms", "Items/s at p50");
+
+    for(int size : options.sizes)
+    {
+        std::string text = generate(size);
+
+        Parser parser;
+        ParseReport report;
+        myVector::vector<Shape*> shapes;
+
+        {
+            std::vector<Shape*> parsed;
+            parsed.reserve(std::size_t(size));
+            parser.parseText(text, parsed, nullptr, report);
+
+            for(Shape *p_Shape : parsed)
+            {
+                shapes.push_back(p_Shape);
+            }
+        }
+
+        if(!report.isClean())
+        {
+            std::fprintf(stderr, "generated document of %d shapes did not parse cleanly:\n%s", size, report.toString().c_str());
+            return 1;
+        }
+
+        /*! Parser */
+        std::vector<Shape*> parsed;
+
+        bench("parse/text", size, size,
+              [&]{report = ParseReport(); parsed.reserve(std::size_t(size));},
+              [&]{parser.parseText(text, parsed, nullptr, report);},
+              [&]{for(Shape *p_Shape : parsed) delete p_Shape; parsed.clear();});
+
+        /*! Shape vector */
+        bench("vector/push_back", size, size, nullptr,
+              [&]{myVector::vector<Shape*> grown; for(int i = 0; i < shapes.size(); ++i) grown.push_back(shapes[i]); sink = grown.size();},
+              nullptr);
+
+        myVector::vector<Shape*> copied;
+
+        bench("vector/copy", size, size, nullptr,
+              [&]{copied = shapes; sink = copied.size();},
+              nullptr);
+
+        myVector::vector<Shape*> erased;
+        int numErases = std::min(NUM_ERASES, size);
+
+        bench("vector/erase_middle", size, numErases,
+              [&]{erased = shapes;},
+              [&]{for(int i = 0; i < numErases; ++i) erased.erase(erased.begin() + erased.size() / 2); sink = erased.size();},
+              nullptr);
+
+        /*! Geometry */
+        bench("geometry/calc", size, size, nullptr,
+              [&]{double total{0.0}; for(int i = 0; i < shapes.size(); ++i) total += double(shapes[i] -> calcPerimeter()) + double(shapes[i] -> calcArea()); sink = total;},
+              nullptr);
+
+        GeometryStore store;
+
+        bench("geometry/store", size, size, nullptr,
+              [&]{store.rebuild(shapes); sink = store.size();},
+              nullptr);
+
+        /*! Selection sort, on a shuffled copy so the ID sort has work to do */
+        if(size <= options.maxSortSize)
+        {
+            myVector::vector<Shape*> shuffled = shapes;
+            std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(2018));
+            myVector::vector<Shape*> sorted;
+
+            bench("sort/id", size, size,
+                  [&]{sorted = shuffled;},
+                  [&]{selectionSort(sorted.begin(), sorted.end(), idCompare);},
+                  nullptr);
+
+            bench("sort/perimeter", size, size,
+                  [&]{sorted = shuffled;},
+                  [&]{selectionSort(sorted.begin(), sorted.end(), perimeterCompare);},
+                  nullptr);
+
+            bench("sort/area", size, size,
+                  [&]{sorted = shuffled;},
+                  [&]{selectionSort(sorted.begin(), sorted.end(), areaCompare);},
+                  nullptr);
+        }
+        else
+        {
+            for(const char *name : {"sort/id", "sort/perimeter", "sort/area"})
+            {
+                skipped.push_back({name, size, "larger than --max-sort-size; the selection sort is quadratic"});
+            }
+        }
+
+        /*! Canvas: converting the shapes as getShapes() does, and painting them as a paint event does */
+        canvas area;
+        QImage image(CANVAS_WIDTH, CANVAS_HEIGHT, QImage::Format_ARGB32_Premultiplied);
+
+        bench("render/get_shapes", size, size, nullptr,
+              [&]{area.getShapes(shapes);},
+              nullptr);
+
+        area.getShapes(shapes);
+
+        bench("render/paint", size, size,
+              [&]{image.fill(Qt::white);},
+              [&]{area.render(&image);},
+              nullptr);
+
+        for(int i = 0; i < shapes.size(); ++i)
+        {
+            delete shapes[i];
+        }
+    }
+
+    std::string json = toJson(options, results, skipped);
+
+    if(options.output == "-")
+    {
+        std::fputs(json.c_str(), stdout);
+    }
+    else
+    {
+        std::ofstream out(options.output, std::ios::out | std::ios::trunc);
+        out << json;
+
+        if(!out)
+        {
+            std::fprintf(stderr, "cannot write %s\n", options.output.c_str());
+            return 1;
+        }
+
+        std::printf("\nResults written to %s\n", options.output.c_str());
+    }
+
+    return 0;
+}
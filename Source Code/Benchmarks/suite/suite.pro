@@ -0,0 +1,56 @@
+#-------------------------------------------------
+#
+# Headless benchmark suite timing the parser, the
+# shape vector, the selection sort, the geometry
+# calculations, and canvas painting on synthetic
+# documents, with the results written as JSON.
+#
+#-------------------------------------------------
+
+TARGET = benchmarksuite
+TEMPLATE = app
+
+QT += core gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        benchmarksuite.cpp \
+        ../../canvas.cpp \
+        ../../parser.cpp \
+        ../../idallocator.cpp \
+        ../../scenegenerator.cpp \
+        ../../intscanner.cpp \
+        ../../selectionsort.cpp \
+        ../../geometrystore.cpp \
+        ../../geometrykernels.cpp \
+        ../../shapevariant.cpp \
+        ../../pagecache.cpp \
+        ../../pagedshapefile.cpp \
+        ../../qtconversions.cpp \
+        ../../shapewriter.cpp \
+        ../../shapeindex.cpp \
+        ../../styletable.cpp \
+        ../../shape.cpp \
+        ../../line.cpp \
+        ../../polyline.cpp \
+        ../../polygon.cpp \
+        ../../rectangle.cpp \
+        ../../square.cpp \
+        ../../ellipse.cpp \
+        ../../circle.cpp \
+        ../../text.cpp
+
+HEADERS += \
+    ../../canvas.h \
+    ../../parser.h \
+    ../../idallocator.h \
+    ../../scenegenerator.h \
+    ../../parsereport.h \
+    ../../selectionsort.h \
+    ../../geometrystore.h \
+    ../../shapevariant.h \
+    ../../shapewriter.h
@@ -24,7 +24,23 @@ DEFINES += QT_DEPRECATED_WARNINGS
 
 PRECOMPILED_HEADER = pch.h
 
-CONFIG += -std=c++11 precompile_header
+CONFIG += c++17 precompile_header
+
+# The geometry kernels use SSE2 on x86-64 by default.
+# Uncomment the line matching your compiler to build the AVX2 kernels instead.
+#QMAKE_CXXFLAGS += -mavx2
+#QMAKE_CXXFLAGS += /arch:AVX2
+
+# Uncomment to compile in the performance counters, the canvas overlay, and the Performance menu.
+# Without it the instrumentation compiles to nothing.
+#DEFINES += SHAPE_PERF_COUNTERS
+
+# Uncomment to record spans of UI slots and subsystems, exported as a Chrome trace from the Trace menu.
+#DEFINES += SHAPE_TRACING
+
+# Uncomment to count heap allocations per load, save, sort, paint, and edit, shown from the Allocations menu.
+# This replaces the global operator new and operator delete.
+#DEFINES += SHAPE_ALLOC_TRACKING
 
 SOURCES += \
         main.cpp \
@@ -42,7 +58,25 @@ SOURCES += \
     canvas.cpp \
     qtconversions.cpp \
     parser.cpp \
-    selectionsort.cpp
+    selectionsort.cpp \
+    memoryreport.cpp \
+    styletable.cpp \
+    geometrystore.cpp \
+    geometrykernels.cpp \
+    shapevariant.cpp \
+    shapewriter.cpp \
+    parallelsaver.cpp \
+    shapeindex.cpp \
+    pagedshapefile.cpp \
+    pagecache.cpp \
+    intscanner.cpp \
+    perfcounters.cpp \
+    tracing.cpp \
+    allocationtracker.cpp \
+    startuptimer.cpp \
+    shapeidmodel.cpp \
+    idallocator.cpp \
+    commandlog.cpp
 
 HEADERS += \
     allshapes.h \
@@ -65,10 +99,47 @@ HEADERS += \
     canvas.h \
     pch.h \
     selectionsort.h \
-    custommath.h
+    custommath.h \
+    memoryreport.h \
+    styletable.h \
+    geometrystore.h \
+    geometrykernels.h \
+    shapevariant.h \
+    keywordtables.h \
+    shapewriter.h \
+    parallelsaver.h \
+    shapeindex.h \
+    pagedshapefile.h \
+    pagecache.h \
+    parsereport.h \
+    intscanner.h \
+    perfcounters.h \
+    tracing.h \
+    allocationtracker.h \
+    startuptimer.h \
+    lazyform.h \
+    shapeidmodel.h \
+    idallocator.h \
+    commandlog.h
 
 FORMS += \
-        mainwindow.ui
+        mainwindow.ui \
+    addlineform.ui \
+    addpolylineform.ui \
+    addpolygonform.ui \
+    addrectangleform.ui \
+    addsquareform.ui \
+    addellipseform.ui \
+    addcircleform.ui \
+    addtextform.ui \
+    editlineform.ui \
+    editpolylineform.ui \
+    editpolygonform.ui \
+    editrectangleform.ui \
+    editsquareform.ui \
+    editellipseform.ui \
+    editcircleform.ui \
+    edittextform.ui
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
@@ -0,0 +1,197 @@
+/*!
+ * \file    scenegen.cpp
+ * \brief   Writes a synthetic shape file, and optionally its offset index and a paged copy, for load and render benchmarks.
+ *
+ * Usage: scenegen [options] FILE
+ *   --shapes N             the number of shapes (default 1000)
+ *   --mix TYPE=W,...       the relative frequency of each type, such as "line=2,polygon=1,text=1" (default: all equal)
+ *   --vertices MIN,MAX     the vertex count range of polylines and polygons (default 2,8)
+ *   --region W,H           the region the shapes are placed in, in canvas units (default 1000,500)
+ *   --max-extent N         the largest width, height, side, or radius of a shape (default 60)
+ *   --seed N               the seed; the same options always give the same file (default 2018)
+ *   --threads N            the number of threads formatting shapes, 0 for one per hardware thread (default 0)
+ *   --index                also writes the offset index sidecar read by the lazy shape store (FILE.idx)
+ *   --paged PAGED_FILE     also writes a paged copy and its page table, read by the page cache (PAGED_FILE.pages)
+ *   --page-size N          the page width and height of the paged copy (default 1024)
+*/
+
+#include "scenegenerator.h"
+#include "shapeindex.h"
+#include "pagedshapefile.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    /*! \struct Options
+     * \brief The command line settings that are not part of the scene spec.
+     */
+    struct Options
+    {
+        std::string fileName;                                   /*!< the path of the shape file to be written */
+        int threads{0};                                         /*!< the number of threads formatting shapes */
+        bool index{false};                                      /*!< TRUE to write the offset index sidecar */
+        std::string pagedFileName;                              /*!< the path of the paged copy, or empty for none */
+        int pageSize{PagedShapeFile::DEFAULT_PAGE_SIZE};        /*!< the page width and height of the paged copy */
+    };
+
+    //! Reads a pair of integers written as "a,b".
+    bool readPair(const char *text, int &first, int &second)
+    {
+        return std::sscanf(text, "%d,%d", &first, &second) == 2;
+    }
+
+    //! Reads the command line.
+    /*! \returns FALSE if an option is unknown, misses its value, or the file name is missing.
+     */
+    bool readOptions(int argc, char *argv[], SceneSpec &spec, Options &options)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const char *option = argv[i];
+
+            if(option[0] != '-')
+            {
+                if(!options.fileName.empty())
+                {
+                    return false;
+                }
+
+                options.fileName = option;
+                continue;
+            }
+
+            if(std::strcmp(option, "--index") == 0)
+            {
+                options.index = true;
+                continue;
+            }
+
+            if(i + 1 >= argc)
+            {
+                return false;
+            }
+
+            const char *value = argv[++i];
+            bool valid{true};
+
+            if(std::strcmp(option, "--shapes") == 0)
+            {
+                spec.shapeCount = std::atoll(value);
+            }
+            else if(std::strcmp(option, "--mix") == 0)
+            {
+                valid = SceneGenerator::readMix(value, spec.weights);
+            }
+            else if(std::strcmp(option, "--vertices") == 0)
+            {
+                valid = readPair(value, spec.minVertices, spec.maxVertices);
+            }
+            else if(std::strcmp(option, "--region") == 0)
+            {
+                valid = readPair(value, spec.width, spec.height);
+            }
+            else if(std::strcmp(option, "--max-extent") == 0)
+            {
+                spec.maxExtent = std::atoi(value);
+            }
+            else if(std::strcmp(option, "--seed") == 0)
+            {
+                spec.seed = std::strtoull(value, nullptr, 10);
+            }
+            else if(std::strcmp(option, "--threads") == 0)
+            {
+                options.threads = std::atoi(value);
+            }
+            else if(std::strcmp(option, "--paged") == 0)
+            {
+                options.pagedFileName = value;
+            }
+            else if(std::strcmp(option, "--page-size") == 0)
+            {
+                options.pageSize = std::atoi(value);
+            }
+            else
+            {
+                valid = false;
+            }
+
+            if(!valid)
+            {
+                return false;
+            }
+        }
+
+        return !options.fileName.empty();
+    }
+
+    //! Gets the seconds elapsed since a point in time.
+    double secondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    SceneSpec spec;
+    Options options;
+
+    if(!readOptions(argc, argv, spec, options))
+    {
+        std::fprintf(stderr, "usage: %s [--shapes N] [--mix TYPE=W,...] [--vertices MIN,MAX] [--region W,H] [--max-extent N]\n"
+                             "       [--seed N] [--threads N] [--index] [--paged PAGED_FILE] [--page-size N] FILE\n", argv[0]);
+        return 1;
+    }
+
+    SceneGenerator generator(spec);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    long long bytes = generator.save(options.fileName, options.threads);
+
+    if(bytes < 0)
+    {
+        std::fprintf(stderr, "cannot write %s\n", options.fileName.c_str());
+        return 1;
+    }
+
+    double seconds = secondsSince(start);
+
+    std::printf("%s: %lld shapes, %lld bytes in %.2f s (%.1f MB/s)\n", options.fileName.c_str(), generator.getSpec().shapeCount,
+                bytes, seconds, seconds > 0.0 ? double(bytes) / seconds / 1e6 : 0.0);
+
+    if(options.index)
+    {
+        start = std::chrono::steady_clock::now();
+
+        ShapeIndex index;
+
+        if(!index.build(options.fileName) || !index.save(options.fileName))
+        {
+            std::fprintf(stderr, "cannot write %s\n", ShapeIndex::sidecarName(options.fileName).c_str());
+            return 1;
+        }
+
+        std::printf("%s: %d entries in %.2f s\n", ShapeIndex::sidecarName(options.fileName).c_str(), index.size(), secondsSince(start));
+    }
+
+    if(!options.pagedFileName.empty())
+    {
+        start = std::chrono::steady_clock::now();
+
+        PagedShapeFile paged;
+
+        if(!PagedShapeFile::paginate(options.fileName, options.pagedFileName, options.pageSize) || !paged.open(options.pagedFileName))
+        {
+            std::fprintf(stderr, "cannot write %s\n", options.pagedFileName.c_str());
+            return 1;
+        }
+
+        std::printf("%s: %d pages in %.2f s\n", options.pagedFileName.c_str(), paged.size(), secondsSince(start));
+    }
+
+    return 0;
+}
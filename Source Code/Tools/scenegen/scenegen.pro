@@ -0,0 +1,44 @@
+#-------------------------------------------------
+#
+# Generator of synthetic shape files, with their
+# offset index and a paged copy, for load and
+# render benchmarks.
+#
+#-------------------------------------------------
+
+TARGET = scenegen
+TEMPLATE = app
+
+QT += core gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        scenegen.cpp \
+        ../../scenegenerator.cpp \
+        ../../pagedshapefile.cpp \
+        ../../shapeindex.cpp \
+        ../../parser.cpp \
+        ../../idallocator.cpp \
+        ../../intscanner.cpp \
+        ../../qtconversions.cpp \
+        ../../shapewriter.cpp \
+        ../../styletable.cpp \
+        ../../shape.cpp \
+        ../../line.cpp \
+        ../../polyline.cpp \
+        ../../polygon.cpp \
+        ../../rectangle.cpp \
+        ../../square.cpp \
+        ../../ellipse.cpp \
+        ../../circle.cpp \
+        ../../text.cpp
+
+HEADERS += \
+    ../../scenegenerator.h \
+    ../../pagedshapefile.h \
+    ../../shapeindex.h \
+    ../../shapewriter.h
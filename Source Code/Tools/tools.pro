@@ -0,0 +1,12 @@
+#-------------------------------------------------
+#
+# Standalone tools for the shape application.
+# Each subdirectory builds one console program that
+# links only the sources it uses.
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+        scenegen
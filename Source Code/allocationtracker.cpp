@@ -0,0 +1,317 @@
+#include "allocationtracker.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+namespace
+{
+    /*! \struct OperationSlot
+     * \brief The atomic storage of one operation.
+     */
+    struct OperationSlot
+    {
+        std::atomic<long long> calls{0};
+        std::atomic<long long> allocations{0};
+        std::atomic<long long> bytes{0};
+        std::atomic<long long> deallocations{0};
+        std::atomic<long long> largestAllocations{0};
+        std::atomic<long long> largestBytes{0};
+        std::atomic<long long> largestDeallocations{0};
+        std::atomic<long long> lastAllocations{0};
+        std::atomic<long long> lastBytes{0};
+        std::atomic<long long> lastDeallocations{0};
+        std::atomic<long long> budgetViolations{0};
+        std::atomic<long long> budgetAllocations{-1};
+        std::atomic<long long> budgetBytes{-1};
+    };
+
+    OperationSlot operations[alloc::NUM_OPERATIONS];
+
+    /*! The running totals of each thread. They are plain integers with constant initialization,
+     * so the allocation functions can update them before any static constructor has run. */
+    thread_local long long threadAllocations{0};
+    thread_local long long threadBytes{0};
+    thread_local long long threadDeallocations{0};
+
+    /*! The number of scopes of each operation open on each thread */
+    thread_local int openScopes[alloc::NUM_OPERATIONS]{};
+
+    const char *const OPERATION_NAMES[alloc::NUM_OPERATIONS]
+    {
+        "load",
+        "save",
+        "sort",
+        "paint",
+        "edit"
+    };
+
+    //! Prints a budget violation to the standard error stream.
+    void warnBudgetExceeded(alloc::eOperation operation, const alloc::Totals &used, const alloc::Budget &budget)
+    {
+        std::cerr << "Allocation budget exceeded by " << OPERATION_NAMES[operation] << ": "
+                  << used.allocations << " allocations (budget " << budget.allocations << "), "
+                  << used.bytes << " bytes (budget " << budget.bytes << ")" << std::endl;
+    }
+
+    std::atomic<alloc::BudgetHandler> budgetHandler{warnBudgetExceeded};
+
+    //! Raises a maximum with a compare and swap loop, so concurrent calls never lose the largest value.
+    void raise(std::atomic<long long> &maximum, long long value)
+    {
+        long long current = maximum.load(std::memory_order_relaxed);
+
+        while(value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {}
+    }
+
+    //! Checks whether a count is above a limit; a limit below 0 means no limit.
+    bool exceeds(long long used, long long limit)
+    {
+        return limit >= 0 && used > limit;
+    }
+}
+
+alloc::Totals alloc::threadTotals()
+{
+    Totals totals;
+
+    totals.allocations = threadAllocations;
+    totals.bytes = threadBytes;
+    totals.deallocations = threadDeallocations;
+
+    return totals;
+}
+
+alloc::OperationStats alloc::getOperation(eOperation operation)
+{
+    const OperationSlot &slot = operations[operation];
+    OperationStats stats;
+
+    stats.calls = slot.calls.load(std::memory_order_relaxed);
+    stats.total.allocations = slot.allocations.load(std::memory_order_relaxed);
+    stats.total.bytes = slot.bytes.load(std::memory_order_relaxed);
+    stats.total.deallocations = slot.deallocations.load(std::memory_order_relaxed);
+    stats.largest.allocations = slot.largestAllocations.load(std::memory_order_relaxed);
+    stats.largest.bytes = slot.largestBytes.load(std::memory_order_relaxed);
+    stats.largest.deallocations = slot.largestDeallocations.load(std::memory_order_relaxed);
+    stats.last.allocations = slot.lastAllocations.load(std::memory_order_relaxed);
+    stats.last.bytes = slot.lastBytes.load(std::memory_order_relaxed);
+    stats.last.deallocations = slot.lastDeallocations.load(std::memory_order_relaxed);
+    stats.budgetViolations = slot.budgetViolations.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void alloc::setBudget(eOperation operation, const Budget &budget)
+{
+    operations[operation].budgetAllocations.store(budget.allocations, std::memory_order_relaxed);
+    operations[operation].budgetBytes.store(budget.bytes, std::memory_order_relaxed);
+}
+
+alloc::Budget alloc::getBudget(eOperation operation)
+{
+    Budget budget;
+
+    budget.allocations = operations[operation].budgetAllocations.load(std::memory_order_relaxed);
+    budget.bytes = operations[operation].budgetBytes.load(std::memory_order_relaxed);
+
+    return budget;
+}
+
+void alloc::setBudgetHandler(BudgetHandler handler)
+{
+    budgetHandler.store(handler != nullptr ? handler : warnBudgetExceeded);
+}
+
+void alloc::reset()
+{
+    for(OperationSlot &slot : operations)
+    {
+        slot.calls.store(0, std::memory_order_relaxed);
+        slot.allocations.store(0, std::memory_order_relaxed);
+        slot.bytes.store(0, std::memory_order_relaxed);
+        slot.deallocations.store(0, std::memory_order_relaxed);
+        slot.largestAllocations.store(0, std::memory_order_relaxed);
+        slot.largestBytes.store(0, std::memory_order_relaxed);
+        slot.largestDeallocations.store(0, std::memory_order_relaxed);
+        slot.lastAllocations.store(0, std::memory_order_relaxed);
+        slot.lastBytes.store(0, std::memory_order_relaxed);
+        slot.lastDeallocations.store(0, std::memory_order_relaxed);
+        slot.budgetViolations.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char *alloc::operationName(eOperation operation)
+{
+    return OPERATION_NAMES[operation];
+}
+
+std::string alloc::toJson()
+{
+    std::ostringstream json;
+
+    json << "{\n  \"tracking\": " << (ENABLED ? "true" : "false") << ",\n  \"operations\": {";
+
+    for(int i = 0; i < NUM_OPERATIONS; ++i)
+    {
+        OperationStats stats = getOperation(eOperation(i));
+        Budget budget = getBudget(eOperation(i));
+
+        json << (i == 0 ? "\n" : ",\n") << "    \"" << OPERATION_NAMES[i] << "\": {\"calls\": " << stats.calls
+             << ", \"allocations\": " << stats.total.allocations << ", \"bytes\": " << stats.total.bytes
+             << ", \"deallocations\": " << stats.total.deallocations
+             << ", \"largest_allocations\": " << stats.largest.allocations << ", \"largest_bytes\": " << stats.largest.bytes
+             << ", \"last_allocations\": " << stats.last.allocations << ", \"last_bytes\": " << stats.last.bytes
+             << ", \"budget_allocations\": " << budget.allocations << ", \"budget_bytes\": " << budget.bytes
+             << ", \"budget_violations\": " << stats.budgetViolations << "}";
+    }
+
+    json << "\n  }\n}\n";
+
+    return json.str();
+}
+
+alloc::Scope::Scope(eOperation operation) : operation{operation}, outermost{openScopes[operation]++ == 0}, start{threadTotals()} {}
+
+/*! The counts are taken before anything is charged, so neither the bookkeeping nor the budget handler counts against the call. */
+alloc::Scope::~Scope()
+{
+    --openScopes[operation];
+
+    if(!outermost)
+    {
+        return;
+    }
+
+    Totals used;
+    used.allocations = threadAllocations - start.allocations;
+    used.bytes = threadBytes - start.bytes;
+    used.deallocations = threadDeallocations - start.deallocations;
+
+    OperationSlot &slot = operations[operation];
+
+    slot.calls.fetch_add(1, std::memory_order_relaxed);
+    slot.allocations.fetch_add(used.allocations, std::memory_order_relaxed);
+    slot.bytes.fetch_add(used.bytes, std::memory_order_relaxed);
+    slot.deallocations.fetch_add(used.deallocations, std::memory_order_relaxed);
+    raise(slot.largestAllocations, used.allocations);
+    raise(slot.largestBytes, used.bytes);
+    raise(slot.largestDeallocations, used.deallocations);
+    slot.lastAllocations.store(used.allocations, std::memory_order_relaxed);
+    slot.lastBytes.store(used.bytes, std::memory_order_relaxed);
+    slot.lastDeallocations.store(used.deallocations, std::memory_order_relaxed);
+
+    Budget budget = getBudget(operation);
+
+    if(exceeds(used.allocations, budget.allocations) || exceeds(used.bytes, budget.bytes))
+    {
+        slot.budgetViolations.fetch_add(1, std::memory_order_relaxed);
+        budgetHandler.load()(operation, used, budget);
+    }
+}
+
+#ifdef SHAPE_ALLOC_TRACKING
+namespace
+{
+    //! Allocates a block from malloc(), calling the new handler until it succeeds, and counts it.
+    void *countedAllocate(std::size_t size)
+    {
+        ++threadAllocations;
+        threadBytes += static_cast<long long>(size);
+
+        void *block = std::malloc(size != 0 ? size : 1);
+
+        while(block == nullptr)
+        {
+            std::new_handler handler = std::get_new_handler();
+
+            if(handler == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            handler();
+            block = std::malloc(size != 0 ? size : 1);
+        }
+
+        return block;
+    }
+
+    //! Releases a block from countedAllocate() and counts it.
+    void countedRelease(void *block) noexcept
+    {
+        if(block != nullptr)
+        {
+            ++threadDeallocations;
+            std::free(block);
+        }
+    }
+
+    /*! Over-aligned blocks are carved out of a larger malloc() block, with the address of that block stored just
+     * in front of the aligned one, since std::aligned_alloc() is not available on every compiler. */
+    void *countedAllocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        std::size_t align = static_cast<std::size_t>(alignment);
+        void *raw = countedAllocate(size + align + sizeof(void*));
+
+        std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + align - 1) & ~std::uintptr_t(align - 1);
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    //! Releases a block from countedAllocateAligned() and counts it.
+    void countedReleaseAligned(void *block) noexcept
+    {
+        if(block != nullptr)
+        {
+            countedRelease(static_cast<void**>(block)[-1]);
+        }
+    }
+}
+
+void *operator new(std::size_t size) {return countedAllocate(size);}
+void *operator new[](std::size_t size) {return countedAllocate(size);}
+void *operator new(std::size_t size, std::align_val_t alignment) {return countedAllocateAligned(size, alignment);}
+void *operator new[](std::size_t size, std::align_val_t alignment) {return countedAllocateAligned(size, alignment);}
+
+void *operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {return countedAllocate(size);}
+    catch(...) {return nullptr;}
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {return countedAllocate(size);}
+    catch(...) {return nullptr;}
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try {return countedAllocateAligned(size, alignment);}
+    catch(...) {return nullptr;}
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try {return countedAllocateAligned(size, alignment);}
+    catch(...) {return nullptr;}
+}
+
+void operator delete(void *block) noexcept {countedRelease(block);}
+void operator delete[](void *block) noexcept {countedRelease(block);}
+void operator delete(void *block, std::size_t) noexcept {countedRelease(block);}
+void operator delete[](void *block, std::size_t) noexcept {countedRelease(block);}
+void operator delete(void *block, const std::nothrow_t&) noexcept {countedRelease(block);}
+void operator delete[](void *block, const std::nothrow_t&) noexcept {countedRelease(block);}
+void operator delete(void *block, std::align_val_t) noexcept {countedReleaseAligned(block);}
+void operator delete[](void *block, std::align_val_t) noexcept {countedReleaseAligned(block);}
+void operator delete(void *block, std::size_t, std::align_val_t) noexcept {countedReleaseAligned(block);}
+void operator delete[](void *block, std::size_t, std::align_val_t) noexcept {countedReleaseAligned(block);}
+void operator delete(void *block, std::align_val_t, const std::nothrow_t&) noexcept {countedReleaseAligned(block);}
+void operator delete[](void *block, std::align_val_t, const std::nothrow_t&) noexcept {countedReleaseAligned(block);}
+#endif
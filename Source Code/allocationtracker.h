@@ -0,0 +1,155 @@
+/*!
+ * \file    allocationtracker.h
+ * \brief   Counts heap allocations and bytes per high level operation and checks them against allocation budgets,
+ *          compiled in only when SHAPE_ALLOC_TRACKING is defined.
+*/
+
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <string>
+
+/*! \namespace alloc
+ * \brief Holds the allocation counters of every operation and their budgets.
+ *
+ * With SHAPE_ALLOC_TRACKING defined, allocationtracker.cpp replaces the global operator new and operator delete,
+ * and every allocation made through them is added to counters of the calling thread.
+ * Code is instrumented with ALLOC_SCOPE(operation): the allocations the calling thread makes inside the scope
+ * are charged to the operation, once per outermost scope, so an edit that looks up a shape is still one edit.
+ * Allocations made on other threads, such as the workers of a parallel save, are not charged to the caller;
+ * neither are blocks Qt's implicitly shared containers take straight from malloc().
+ * When a scope ends above its operation's budget, the budget handler is called.
+ * Without SHAPE_ALLOC_TRACKING the macro expands to nothing and the allocation functions are not replaced.
+ * \sa perf
+ */
+namespace alloc
+{
+#ifdef SHAPE_ALLOC_TRACKING
+    constexpr bool ENABLED = true;      /*!< TRUE if allocations are counted */
+#else
+    constexpr bool ENABLED = false;     /*!< TRUE if allocations are counted */
+#endif
+
+    //! The enumeration of all tracked operations.
+    enum eOperation{
+                    LOAD,           /*!< AllShapes::addShapesFromFile() */
+                    SAVE,           /*!< AllShapes::printAll() */
+                    SORT,           /*!< MainWindow::updateShapeTables() and the three table sorts */
+                    PAINT,          /*!< canvas::paintEvent() */
+                    EDIT,           /*!< adding, editing, moving, and deleting a shape in AllShapes */
+                    NUM_OPERATIONS  /*!< the number of operations */
+                   };
+
+    /*! \struct Totals
+     * \brief Allocation counts over some stretch of a thread's work.
+     */
+    struct Totals
+    {
+        long long allocations{0};   /*!< the number of blocks allocated */
+        long long bytes{0};         /*!< the bytes requested by those allocations */
+        long long deallocations{0}; /*!< the number of blocks released */
+    };
+
+    /*! \struct Budget
+     * \brief The most one call of an operation may allocate. A limit below 0 means no limit.
+     */
+    struct Budget
+    {
+        long long allocations{-1};  /*!< the most blocks allocated per call */
+        long long bytes{-1};        /*!< the most bytes requested per call */
+    };
+
+    /*! \struct OperationStats
+     * \brief The allocations charged to one operation since the last reset.
+     */
+    struct OperationStats
+    {
+        long long calls{0};             /*!< the number of outermost scopes that ended */
+        Totals total;                   /*!< the allocations of every call together */
+        Totals largest;                 /*!< the most allocations and the most bytes of a single call, each taken separately */
+        Totals last;                    /*!< the allocations of the most recent call */
+        long long budgetViolations{0};  /*!< the number of calls that exceeded the budget */
+    };
+
+    //! The function called when a call exceeds its operation's budget.
+    /*! \param operation the operation
+     * \param used the allocations of the call
+     * \param budget the budget in force
+     */
+    using BudgetHandler = void (*)(eOperation operation, const Totals &used, const Budget &budget);
+
+    //! Gets the allocations made by the calling thread since it started.
+    /*! Taking this before and after a piece of work gives the work's allocations, without an ALLOC_SCOPE().
+     * \returns The running totals of the calling thread; all 0 without SHAPE_ALLOC_TRACKING.
+     */
+    Totals threadTotals();
+
+    //! Gets the allocations charged to an operation.
+    OperationStats getOperation(eOperation operation);
+
+    //! Sets the budget of an operation.
+    /*! \param operation the operation
+     * \param budget the most one call may allocate
+     */
+    void setBudget(eOperation operation, const Budget &budget);
+
+    //! Gets the budget of an operation.
+    Budget getBudget(eOperation operation);
+
+    //! Sets the function called when a call exceeds its budget.
+    /*! \param handler the function; nullptr restores the default, which prints a warning to the standard error stream
+     */
+    void setBudgetHandler(BudgetHandler handler);
+
+    //! Sets the counts of every operation to 0. Budgets are kept.
+    void reset();
+
+    //! Gets the name of an operation, as used in the JSON dump.
+    const char *operationName(eOperation operation);
+
+    //! Formats the counts and budget of every operation as a JSON object.
+    /*! \returns The JSON text.
+     */
+    std::string toJson();
+
+    /*! \class Scope
+     * \brief Charges the allocations the calling thread makes from its construction to its destruction to an operation.
+     */
+    class Scope
+    {
+    public:
+
+        //! Constructor
+        /*! \param operation the operation charged; a scope nested in another of the same operation charges nothing
+         */
+        explicit Scope(eOperation operation);
+
+        //! Destructor
+        /*! Charges the allocations and checks the budget.
+         */
+        ~Scope();
+
+        //! Removes functionality of a copy constructor.
+        Scope(const Scope &otherScope) = delete;
+
+        //! Removes functionality of a copy assignment operator.
+        Scope& operator=(const Scope &otherScope) = delete;
+
+    private:
+        eOperation operation;   /*!< the operation charged */
+        bool outermost;         /*!< TRUE if no other scope of the operation was open on this thread */
+        Totals start;           /*!< the thread's totals when the scope began */
+    };
+}
+
+#define ALLOC_CONCATENATE_IMPL(a, b) a##b
+#define ALLOC_CONCATENATE(a, b) ALLOC_CONCATENATE_IMPL(a, b)
+
+#ifdef SHAPE_ALLOC_TRACKING
+    //! Charges the allocations of the rest of the enclosing scope to the named alloc::eOperation.
+    #define ALLOC_SCOPE(operation) alloc::Scope ALLOC_CONCATENATE(allocScope, __LINE__)(alloc::operation)
+#else
+    #define ALLOC_SCOPE(operation) static_cast<void>(0)
+#endif
+
+#endif // ALLOCATIONTRACKER_H
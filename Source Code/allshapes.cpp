@@ -1,39 +1,46 @@
 #include "allshapes.h"
+#include "allocationtracker.h"
+#include "perfcounters.h"
+#include "tracing.h"
 #include <sstream>
+#include <chrono>
+#include <functional>
+#include <algorithm>
 
 //! Adds shapes from the input file.
 void AllShapes::addShapesFromFile()
 {
-    shapeCount = shapeParser.parseShapes(v_Shapes, device);
+    TRACE_SCOPE("shapes", "addShapesFromFile");
+    ALLOC_SCOPE(LOAD);
 
-    setCurrentID();
-}
-
-//! Sets the current largest ID number in the vector.
-void AllShapes::setCurrentID()
-{
-    int current{0};
-
-    for(int i = 0; i < v_Shapes.size(); i++)
-    {
-        if(v_Shapes[i+1] > v_Shapes[i])
-        {
-            current = v_Shapes[i]->getID();
-        }
-    }
+    parseReport = ParseReport();
+    shapeParser.parseShapes(v_Shapes, device, parseReport, &ids);
 
-    currentID = current;
+    invalidateGeometry();
+    batchesDirty = true;
 }
 
 //! Adds a new shape to the vector.
 void AllShapes::newShape(Shape *newShape)
 {
+    TRACE_SCOPE("shapes", "newShape");
+    ALLOC_SCOPE(EDIT);
+
+    ids.reserve(newShape -> getID());
     v_Shapes.push_back(newShape);
+    invalidateGeometry();
+    batchesDirty = true;
+
+    commands.record(new AddCommand(newShape));
+    notify({ShapeChange::ADDED, newShape -> getID()});
 }
 
 //! (1 of 3) Edits the properties of a line or polyline in the vector.
 void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const QPen &pen)
 {
+    TRACE_SCOPE("shapes", "editShape");
+    ALLOC_SCOPE(EDIT);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
 
@@ -42,9 +49,12 @@ void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const Q
         if((*it) -> getID() == id)
         {
             found = true;
-            (*it)->setBaseInfo(id, findShape(id), NUM_SPECS, dims);
+            EditCommand::State before = EditCommand::capture(*it);
+            (*it)->setBaseInfo(id, NUM_SPECS, dims);
             (*it)->setPosition();
+            invalidateGeometry();
             (*it)->setPen(pen);
+            recordEdit(*it, before);
         }
         else
         {
@@ -56,6 +66,9 @@ void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const Q
 //! (2 of 3) Edits the properties of a polygon, rectangle, square, ellipse, or circle in the vector.
 void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const QPen &pen, const QBrush &brush)
 {
+    TRACE_SCOPE("shapes", "editShape");
+    ALLOC_SCOPE(EDIT);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
 
@@ -64,10 +77,13 @@ void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const Q
         if((*it) -> getID() == id)
         {
             found = true;
-            (*it)->setBaseInfo(id, findShape(id), NUM_SPECS, dims);
+            EditCommand::State before = EditCommand::capture(*it);
+            (*it)->setBaseInfo(id, NUM_SPECS, dims);
             (*it)->setPosition();
+            invalidateGeometry();
             (*it)->setPen(pen);
             (*it)->setBrush(brush);
+            recordEdit(*it, before);
         }
         else
         {
@@ -79,6 +95,9 @@ void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const Q
 //! (3 of 3) Edits the properties of a text box in the vector.
 void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const QPen &pen, const QFont &font, Qt::AlignmentFlag flag, string text)
 {
+    TRACE_SCOPE("shapes", "editShape");
+    ALLOC_SCOPE(EDIT);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
 
@@ -87,12 +106,23 @@ void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const Q
         if((*it) -> getID() == id)
         {
             found = true;
-            (*it)->setBaseInfo(id, findShape(id), NUM_SPECS, dims);
+            EditCommand::State before = EditCommand::capture(*it);
+            (*it)->setBaseInfo(id, NUM_SPECS, dims);
             (*it)->setPosition();
+            invalidateGeometry();
             (*it)->setPen(pen);
-            (*it)->setFont(font);
-            (*it)->setAlignment(flag);
-            (*it)->setText(text);
+
+            /*! Only text boxes carry font, alignment, and text data */
+            if((*it)->getShapeType() == ShapeLabels::TEXT)
+            {
+                Text *p_Text = static_cast<Text*>(*it);
+
+                p_Text->setFont(font);
+                p_Text->setAlignment(flag);
+                p_Text->setText(text);
+            }
+
+            recordEdit(*it, before);
         }
         else
         {
@@ -104,6 +134,9 @@ void AllShapes::editShape(int id, const int NUM_SPECS, dim::specs *dims, const Q
 //! Moves a shape by a certain x and y shift.
 void AllShapes::moveShape(int id, const QPoint &shift)
 {
+    TRACE_SCOPE("shapes", "moveShape");
+    ALLOC_SCOPE(EDIT);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
 
@@ -113,6 +146,13 @@ void AllShapes::moveShape(int id, const QPoint &shift)
         {
             found = true;
             (*it)->move(shift);
+            invalidateGeometry();
+
+            if(shift.x() != 0 || shift.y() != 0)
+            {
+                commands.record(new MoveCommand(*it, shift));
+                notify({ShapeChange::CHANGED, id});
+            }
         }
         else
         {
@@ -124,6 +164,9 @@ void AllShapes::moveShape(int id, const QPoint &shift)
 //! Finds a shape by its ID number and returns its shape type as a string.
 string AllShapes::findShape(int id)
 {
+    TRACE_SCOPE("shapes", "findShape");
+    PERF_SCOPE(FIND_SHAPE);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
     string shapeType{""};
@@ -141,12 +184,17 @@ string AllShapes::findShape(int id)
         }
      }
 
+    PERF_COUNT(ID_LOOKUPS_MISSED, found ? 0 : 1);
+
     return shapeType;
 }
 
 //! Finds a shape by its ID number and returns a pointer to its location in the vector.
 Shape* AllShapes::findShapePtr(int id)
 {
+    TRACE_SCOPE("shapes", "findShapePtr");
+    PERF_SCOPE(FIND_SHAPE);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
     Shape* p_Shape{nullptr};
@@ -164,12 +212,17 @@ Shape* AllShapes::findShapePtr(int id)
         }
      }
 
+    PERF_COUNT(ID_LOOKUPS_MISSED, found ? 0 : 1);
+
     return p_Shape;
 }
 
 //! Deletes a shape from the vector.
 void AllShapes::deleteShape(int id)
 {
+    TRACE_SCOPE("shapes", "deleteShape");
+    ALLOC_SCOPE(EDIT);
+
     myVector::vector<Shape*>::iterator it = v_Shapes.begin();
     bool found = false;
 
@@ -178,7 +231,12 @@ void AllShapes::deleteShape(int id)
         if((*it) -> getID() == id)
         {
             found = true;
+            commands.record(new DeleteCommand(*it));
             v_Shapes.erase(it);
+            ids.release(id);
+            invalidateGeometry();
+            batchesDirty = true;
+            notify({ShapeChange::REMOVED, id});
         }
         else
         {
@@ -187,26 +245,245 @@ void AllShapes::deleteShape(int id)
      }
 }
 
+//! Records an edit that changed at least one value.
+void AllShapes::recordEdit(Shape *shape, const EditCommand::State &before)
+{
+    EditCommand *command = new EditCommand(shape, before, EditCommand::capture(shape));
+
+    if(command -> isEmpty())
+    {
+        delete command;
+        return;
+    }
+
+    commands.record(command);
+    notify({ShapeChange::CHANGED, shape -> getID()});
+}
+
+//! Undoes the most recent step in the command log.
+bool AllShapes::undo()
+{
+    TRACE_SCOPE("shapes", "undo");
+    ALLOC_SCOPE(EDIT);
+
+    const ShapeCommand *command = commands.undo(v_Shapes);
+
+    if(command == nullptr)
+    {
+        return false;
+    }
+
+    applyChange(command -> undoneChange());
+
+    return true;
+}
+
+//! Redoes the most recently undone step in the command log.
+bool AllShapes::redo()
+{
+    TRACE_SCOPE("shapes", "redo");
+    ALLOC_SCOPE(EDIT);
+
+    const ShapeCommand *command = commands.redo(v_Shapes);
+
+    if(command == nullptr)
+    {
+        return false;
+    }
+
+    applyChange(command -> doneChange());
+
+    return true;
+}
+
+//! Brings the ID allocator and the caches in line with an undone or redone step.
+void AllShapes::applyChange(const ShapeChange &change)
+{
+    switch(change.kind)
+    {
+    case ShapeChange::ADDED:
+        ids.reserve(change.shapeId);
+        batchesDirty = true;
+        break;
+    case ShapeChange::REMOVED:
+        ids.release(change.shapeId);
+        batchesDirty = true;
+        break;
+    case ShapeChange::CHANGED:
+        break;
+    }
+
+    invalidateGeometry();
+    notify(change);
+}
+
+//! Gets the geometry store, rebuilding it if the shape vector changed.
+const GeometryStore &AllShapes::getGeometry()
+{
+    if(geometryDirty)
+    {
+        TRACE_SCOPE("shapes", "rebuildGeometry");
+        geometry.rebuild(v_Shapes);
+        geometryDirty = false;
+    }
+
+    return geometry;
+}
+
+//! Gets the shape batches, rebuilding them if the shape vector changed.
+const ShapeBatches &AllShapes::getBatches()
+{
+    if(batchesDirty)
+    {
+        TRACE_SCOPE("shapes", "rebuildBatches");
+        batches.rebuild(v_Shapes);
+        batchesDirty = false;
+    }
+
+    return batches;
+}
+
+//! Builds the geometry store and every shape's metrics cache.
+void AllShapes::buildCaches()
+{
+    TRACE_SCOPE("shapes", "buildCaches");
+
+    getGeometry();
+
+    for(const Shape *shape : v_Shapes)
+    {
+        shape->getBoundingBox();
+    }
+}
+
 //! Prints all the shapes' information to the output file.
 void AllShapes::printAll()
 {
-     fstream fout("shapes.txt", ios::out);
+     TRACE_SCOPE("save", "printAll");
+     ALLOC_SCOPE(SAVE);
+     PERF_SCOPE(SAVE);
+
+     const ShapeBatches &shapes = getBatches();
+
+     if(parallelSave && shapes.size() >= ParallelSaver::MIN_PARALLEL_SHAPES)
+     {
+         lastSave = saver.save("shapes.txt", shapes);
+         return;
+     }
+
+     std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
-     myVector::vector<Shape*>::const_iterator it = v_Shapes.begin();
+     fstream fout("shapes.txt", ios::out);
      int i{0};
 
-     while(it != v_Shapes.end())
      {
-         fout << (*it) -> print();
+         ShapeWriter writer(fout, saveBuffer);
 
-         if(i < (v_Shapes.size() - 1))
+         shapes.forEachInOrder([&](const auto &shape)
          {
-             fout << endl;
-             ++i;
-         }
+             shape.serialize(writer);
+
+             if(i < (shapes.size() - 1))
+             {
+                 writer.newline();
+                 ++i;
+             }
+         });
 
-         it++;
+         lastSave = SaveTimings();
+         lastSave.threadCount = 1;
+         lastSave.chunkCount = 1;
+         lastSave.bytesWritten = writer.getBytesWritten();
      }
 
      fout.close();
+
+     lastSave.formatMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+     lastSave.totalMilliseconds = lastSave.formatMilliseconds;
+}
+
+//! Measures the memory of the shapes, styles, caches, and indexes.
+MemoryReport AllShapes::getMemoryReport()
+{
+    MemoryReport report;
+
+    report.addShapes(v_Shapes);
+    report.addStyles();
+
+    report.add("caches", "geometry store", geometry.size(), geometry.memoryBytes(), true);
+    report.add("caches", "shape batches", batches.size(), batches.memoryBytes(), true);
+    report.add("caches", "save buffer", 0, saveBuffer.capacity(), true);
+    report.add("caches", "parallel save buffers", 0, saver.memoryBytes(), true);
+    report.add("caches", "page cache shapes", pageCache.getStats().residentShapes, pageCache.getResidentBytes(), true);
+    report.add("caches", "prefetched pages", 0, pageCache.getPrefetchedBytes(), true);
+
+    report.add("indexes", "page table", pageCache.getPages().size(), pageCache.getPages().memoryBytes());
+    report.add("indexes", "shape IDs", ids.getCount(), ids.memoryBytes());
+
+    report.add("history", "command log", commands.getStepCount(), commands.memoryBytes());
+
+    return report;
+}
+
+//! Frees caches until the document fits in the memory budget.
+std::size_t AllShapes::enforceMemoryBudget(std::size_t *bytesInUse)
+{
+    TRACE_SCOPE("shapes", "enforceMemoryBudget");
+
+    if(memoryBudget == 0)
+    {
+        return 0;
+    }
+
+    std::size_t before = getMemoryReport().totalBytes();
+    std::size_t current = before;
+
+    /*! The caches in the order they are freed; each returns the bytes it freed, measured on the cache alone */
+    std::function<std::size_t()> evictions[]
+    {
+        [this]
+        {
+            std::size_t cached = pageCache.getResidentBytes() + pageCache.getPrefetchedBytes();
+            pageCache.trim();
+            return cached - std::min(cached, pageCache.getResidentBytes() + pageCache.getPrefetchedBytes());
+        },
+        [this]
+        {
+            std::size_t cached = saveBuffer.capacity() + saver.memoryBytes();
+            std::vector<char>().swap(saveBuffer);
+            saver.release();
+            return cached;
+        },
+        [this]
+        {
+            std::size_t cached = geometry.memoryBytes();
+            geometry.release();
+            geometryDirty = true;
+            return cached;
+        },
+        [this]
+        {
+            std::size_t cached = batches.memoryBytes();
+            batches.release();
+            batchesDirty = true;
+            return cached;
+        }
+    };
+
+    for(std::function<std::size_t()> &evict : evictions)
+    {
+        if(current <= memoryBudget)
+        {
+            break;
+        }
+
+        current -= std::min(current, evict());
+    }
+
+    if(bytesInUse != nullptr)
+    {
+        *bytesInUse = current;
+    }
+
+    return before - current;
 }
@@ -9,6 +9,15 @@
 #include "libraries.h"
 #include "shape_list.h"
 #include "parser.h"
+#include "geometrystore.h"
+#include "shapevariant.h"
+#include "shapewriter.h"
+#include "parallelsaver.h"
+#include "pagecache.h"
+#include "memoryreport.h"
+#include "idallocator.h"
+#include "commandlog.h"
+#include <functional>
 
 /*! An object of the Parser class is implemented and used in this class via composition.
  * This allows the AllShapes class to navigate the text file containing all shape properties and fill the shapes vector.
@@ -22,35 +31,42 @@ class AllShapes
 
         //! Default constructor
         /*! \param device the pointer to a QPaintDevice that allows Qt to render shapes
-         * Also initializes shapeCount, currentId, and the device to their appropriate values.
+         * Also initializes the device to its appropriate value.
         */
-        AllShapes(QPaintDevice *device) : shapeCount{0}, currentID{0}, device{device} {}
+        AllShapes(QPaintDevice *device) : device{device}, geometryDirty{true}, batchesDirty{true}, parallelSave{true}, memoryBudget{0} {}
 
         //! Destructor
         ~AllShapes(){}
 
         //! Adds shapes from a text file using the composed shapeParser object.
         /*! Reads in shape values from the shapes file and populates the vector of shape pointers.
+         * The ID of each shape is reserved in the ID allocator as its record is read.
+         * Records with errors, or with an ID already in use, are skipped; the errors are kept in the parse report.
          * \sa Parser::parseShapes()
+         * \sa getParseReport()
         */
         void addShapesFromFile();
 
-        //! Sets the current max ID number from the largest shape ID currently in the vector.
-        /*! Ensures each shape will have its own unique ID number.
+        //! Gets the errors found by the last call to addShapesFromFile().
+        /*! \returns The parse report by constant reference.
+         * \sa MainWindow::shapesLoaded()
         */
-        void setCurrentID();
+        const ParseReport &getParseReport() const {return parseReport;}
 
         //! Adds a new shape to the shape vector.
-        /*! \param newShape the pointer to the new Shape object
+        /*! The shape's ID is reserved if it is not in use yet, so a shape restored with its old ID keeps it.
+         * The addition is recorded in the command log, so it can be undone. A deleted shape belongs to the command log;
+         * it is restored with undo(), never by passing it here again.
+         * \param newShape the pointer to the new Shape object
          * Used when the user creates a new shape via the front end.
-         * \sa MainWindow::on_lineSave_clicked()
-         * \sa MainWindow::on_polylineSave_clicked()
-         * \sa MainWindow::on_polygonSave_clicked()
-         * \sa MainWindow::on_rectangleSave_clicked()
-         * \sa MainWindow::on_squareSave_clicked()
-         * \sa MainWindow::on_ellipseSave_clicked()
-         * \sa MainWindow::on_circleSave_clicked()
-         * \sa MainWindow::on_textSave_clicked()
+         * \sa MainWindow::lineSaveClicked()
+         * \sa MainWindow::polylineSaveClicked()
+         * \sa MainWindow::polygonSaveClicked()
+         * \sa MainWindow::rectangleSaveClicked()
+         * \sa MainWindow::squareSaveClicked()
+         * \sa MainWindow::ellipseSaveClicked()
+         * \sa MainWindow::circleSaveClicked()
+         * \sa MainWindow::textSaveClicked()
         */
         void newShape(Shape *newShape);
 
@@ -60,8 +76,8 @@ class AllShapes
          * \param NUM_SPECS the number of specifications the shape being edited has
          * \param *dims the array of shape dimensions
          * \param pen the QPen settings of the edited shape
-         * \sa MainWindow::on_editLineSave_clicked()
-         * \sa MainWindow::on_editPolylineSave_clicked()
+         * \sa MainWindow::editLineSaveClicked()
+         * \sa MainWindow::editPolylineSaveClicked()
         */
         void editShape(int id, const int NUM_SPECS, dim::specs *dims, const QPen &pen);
 
@@ -72,11 +88,11 @@ class AllShapes
          * \param *dims the array of shape dimensions
          * \param pen the QPen settings of the edited shape
          * \param brush the QBrush settings of the edited shape
-         * \sa MainWindow::on_editPolygonSave_clicked()
-         * \sa MainWindow::on_editRectangleSave_clicked()
-         * \sa MainWindow::on_editSquareSave_clicked()
-         * \sa MainWindow::on_editEllipseSave_clicked()
-         * \sa MainWindow::on_editCircleSave_clicked()
+         * \sa MainWindow::editPolygonSaveClicked()
+         * \sa MainWindow::editRectangleSaveClicked()
+         * \sa MainWindow::editSquareSaveClicked()
+         * \sa MainWindow::editEllipseSaveClicked()
+         * \sa MainWindow::editCircleSaveClicked()
         */
         void editShape(int id, const int NUM_SPECS, dim::specs *dims, const QPen &pen, const QBrush &brush);
 
@@ -89,13 +105,13 @@ class AllShapes
          * \param font the QFont settings of the edited shape
          * \param flag the alignment setting of the edited shape
          * \param text the actual string displayed in the rendering area
-         * \sa MainWindow::on_editTextSave_clicked()
+         * \sa MainWindow::editTextSaveClicked()
         */
         void editShape(int id, const int NUM_SPECS, dim::specs *dims, const QPen &pen, const QFont &font, Qt::AlignmentFlag flag, string text);
 
         //! Moves a shape in the shape vector.
         /*! Moves a shape by shifting its x and y coordinates.
-         * All shapes have this functionality.
+         * All shapes have this functionality. The move is recorded in the command log, so it can be undone.
          * \param id the ID number of the shape being moved
          * \param shift the QPoint containing the x and y shifts for the current shape
          * \sa MainWindow::on_moveUpdateButton_clicked()
@@ -119,32 +135,170 @@ class AllShapes
         */
         int getShapeCount() {return v_Shapes.size();}
 
+        //! Gets the struct of arrays copy of all shape geometry with up to date perimeters, areas, and bounding boxes.
+        /*! Rebuilds the store first if any shape was added, edited, moved, or deleted since the last call.
+         * \returns The geometry store by constant reference.
+         * \sa MainWindow::updateShapeTables()
+        */
+        const GeometryStore &getGeometry();
+
+        //! Marks the geometry store as out of date.
+        /*! Called by every function that changes shape dimensions.
+        */
+        void invalidateGeometry() {geometryDirty = true;}
+
+        //! Builds the geometry store and the metrics cache of every shape ahead of their first use.
+        /*! Called on the loader thread after addShapesFromFile(), so the first table refresh and paint find them ready.
+         * Nothing else may use the shapes while it runs.
+         * \sa MainWindow::MainWindow()
+        */
+        void buildCaches();
+
+        //! Gets the shapes in their closed set representation, in vector order and grouped by shape type.
+        /*! Rebuilds the batches first if shapes were added, deleted, or possibly reordered since the last call.
+         * \returns The shape batches by constant reference.
+         * \sa AllShapes::printAll()
+        */
+        const ShapeBatches &getBatches();
+
         //! Gets the entire shape vector and returns it by reference.
-        /*! \returns The entire shape vector by reference.
+        /*! The caller may reorder the vector (the shape tables sort it), so the shape batches are marked out of date.
+         * \returns The entire shape vector by reference.
         */
-        myVector::vector<Shape*>& getVector() {return v_Shapes;}
+        myVector::vector<Shape*>& getVector() {batchesDirty = true; return v_Shapes;}
 
-        //! Increments the current shape count and the current greatest ID number.
+        //! Hands out an ID for a new shape.
         /*! Used when adding a new shape to the vector. Makes sure no two shapes will have the same ID.
-         * \returns The incremented current greatest ID number, to be assigned to a new shape.
+         * The IDs of deleted shapes are handed out again.
+         * \returns The ID to be assigned to the new shape.
+         * \sa IdAllocator::allocate()
         */
-        int incrementShapeCount() {++shapeCount; return ++currentID;}
+        int allocateID() {return ids.allocate();}
+
+        //! Gets the allocator of shape IDs.
+        const IdAllocator &getIdAllocator() const {return ids;}
 
         //! Deletes a shape from the shape vector.
-        /*! \param id the ID number of the shape being deleted
+        /*! The shape's ID is released, so a later new shape may reuse it.
+         * The shape itself is kept by the command log until the deletion can no longer be undone.
+         * \param id the ID number of the shape being deleted
          * \sa MainWindow::on_deleteShapeButton_clicked()
         */
         void deleteShape(int id);
 
+        //! Undoes the most recent add, edit, move, or delete.
+        /*! A shape whose deletion is undone gets its old ID back; the IDs handed out since were undone first.
+         * \returns FALSE if there was nothing to undo.
+         * \sa CommandLog::undo()
+        */
+        bool undo();
+
+        //! Redoes the most recently undone add, edit, move, or delete.
+        /*! \returns FALSE if there was nothing to redo.
+         * \sa CommandLog::redo()
+        */
+        bool redo();
+
+        //! Gets the command log holding the undo and redo stacks.
+        /*! \returns The command log by constant reference.
+        */
+        const CommandLog &getCommandLog() const {return commands;}
+
+        //! Sets the function told about every shape added, removed, or changed by an edit, an undo, or a redo.
+        /*! Shapes read by addShapesFromFile() are not reported.
+         * \param observer the function called after each change, or an empty function to stop the reports
+        */
+        void setObserver(std::function<void(const ShapeChange &)> observer) {this->observer = observer;}
+
         //! Prints all data from the shape vector to the shapes database.
+        /*! The shapes are serialized into the reusable save buffer, which is written to the file in large blocks.
+         * When the parallel save mode is on and the document has at least ParallelSaver::MIN_PARALLEL_SHAPES shapes,
+         * chunks of shapes are formatted on several threads instead. Both modes write the same bytes.
+         * \sa ShapeWriter
+         * \sa ParallelSaver
+        */
         void printAll();
 
+        //! Turns the parallel save mode on or off.
+        /*! \param enabled TRUE to format large documents on several threads when saving
+        */
+        void setParallelSave(bool enabled) {parallelSave = enabled;}
+
+        //! Checks whether the parallel save mode is on.
+        bool isParallelSave() const {return parallelSave;}
+
+        //! Gets the counters recorded by the last call to printAll().
+        /*! \returns The save timings by constant reference.
+        */
+        const SaveTimings &getLastSaveTimings() const {return lastSave;}
+
+        //! Gets the page cache used for documents too large to parse whole.
+        /*! Open a file written by PagedShapeFile::paginate() in it; the canvas then renders the pages in view.
+         * The shape vector, tables, and saving are not affected by the page cache.
+         * \returns The page cache by reference.
+         * \sa canvas::setPageCache()
+        */
+        PageCache &getPageCache() {return pageCache;}
+
+        //! Measures the memory used by the shapes, the style tables, the caches, the indexes, and the undo history.
+        /*! \returns The bytes per shape type and per subsystem.
+         * \sa MemoryReport
+        */
+        MemoryReport getMemoryReport();
+
+        //! Sets the memory budget enforced by enforceMemoryBudget().
+        /*! \param bytes the most bytes the memory report may total; 0 turns the budget off
+        */
+        void setMemoryBudget(std::size_t bytes) {memoryBudget = bytes;}
+
+        //! Gets the memory budget in bytes, or 0 if there is none.
+        std::size_t getMemoryBudget() const {return memoryBudget;}
+
+        //! Frees caches until the memory report fits in the memory budget.
+        /*! Caches are freed one at a time, those quickest to rebuild first: the page cache pages out of view and the prefetched pages,
+         * the save buffers, the geometry store, and the shape batches. Each is rebuilt when it is next needed.
+         * The shapes, the style tables, the indexes, and the undo history are never freed, so a document larger than the budget stays over it.
+         * The memory report is measured once; the bytes of each freed cache are subtracted from it. Since a freed cache is rebuilt
+         * by the next table refresh or save, this is only called when the budget is set, not after every change.
+         * \param bytesInUse receives the bytes the document uses after freeing, if not nullptr
+         * \returns The number of bytes freed.
+         * \sa MainWindow::on_actionSet_Memory_Budget_triggered()
+        */
+        std::size_t enforceMemoryBudget(std::size_t *bytesInUse = nullptr);
+
 private:
+
+        //! Records an edit in the command log, unless it left the shape as it was.
+        /*! \param shape the edited shape
+         * \param before the state of the shape captured before the edit
+        */
+        void recordEdit(Shape *shape, const EditCommand::State &before);
+
+        //! Updates the ID allocator and the caches after an undo or redo, then tells the observer.
+        /*! \param change what the undo or redo did
+        */
+        void applyChange(const ShapeChange &change);
+
+        //! Tells the observer, if there is one, about a change.
+        void notify(const ShapeChange &change) {if(observer) observer(change);}
+
         myVector::vector<Shape*> v_Shapes;  /*!< The custom vector of Shape pointers. */
         Parser shapeParser;                 /*!< COMPOSITION - Object of class Parser used to parse the shapes file. */
-        int shapeCount;                     /*!< The current number of shapes in the vector. */
-        int currentID;                      /*!< The current largest ID number in the vector. */
+        ParseReport parseReport;            /*!< The errors found by the last parse of the shapes file. */
+        IdAllocator ids;                    /*!< The IDs in use, and the IDs of deleted shapes to hand out again. */
         QPaintDevice *device;               /*!< The pointer to a QPaintDevice that allows rendering of shapes. */
+        GeometryStore geometry;             /*!< The struct of arrays copy of all shape geometry. */
+        bool geometryDirty;                 /*!< TRUE if the geometry store no longer matches the shape vector. */
+        ShapeBatches batches;               /*!< The closed set representation of the shape vector. */
+        bool batchesDirty;                  /*!< TRUE if the shape batches no longer match the shape vector. */
+        std::vector<char> saveBuffer;       /*!< The output buffer reused by every sequential save. */
+        ParallelSaver saver;                /*!< The chunk buffers and threads used by the parallel save mode. */
+        bool parallelSave;                  /*!< TRUE if large documents are saved with the parallel save mode. */
+        SaveTimings lastSave;               /*!< The counters recorded by the last save. */
+        PageCache pageCache;                /*!< The resident pages of a paged document, if one is open. */
+        std::size_t memoryBudget;           /*!< The most bytes the memory report may total, or 0 for no budget. */
+        CommandLog commands;                /*!< The undo and redo stacks of the edits to the shape vector. */
+        std::function<void(const ShapeChange &)> observer; /*!< The function told about every change, if any. */
 };
 
 #endif /*ALLSHAPES_H_*/
@@ -1,10 +1,12 @@
 #include "canvas.h"
+#include "allocationtracker.h"
+#include "tracing.h"
 
 //! Constructor
 /*! Sets the canvas's pointer.
  * Sets minimum and maximum canvas sizes.
  * Sets the color of the canvas to white. */
-canvas::canvas(QWidget *parent) : QWidget(parent)
+canvas::canvas(QWidget *parent) : QWidget(parent), pageCache{nullptr}, viewOrigin{0, 0}, panning{false}
 {
     setMinimumSize(1000, 500);
     setMaximumSize(1000, 500);
@@ -13,22 +15,177 @@ canvas::canvas(QWidget *parent) : QWidget(parent)
 }
 
 //! Gets the shape vector and assigns it to the local shape vector.
-void canvas::getShapes(myVector::vector<Shape*> shapes)
+void canvas::getShapes(const myVector::vector<Shape*> &shapes)
 {
-    v_Shapes = shapes;
+    TRACE_SCOPE("canvas", "getShapes");
+
+    this -> shapes.rebuild(shapes);
+    update();
+}
+
+//! Sets the page cache used to render paged documents.
+void canvas::setPageCache(PageCache *pageCache)
+{
+    this -> pageCache = pageCache;
+    setViewOrigin(viewOrigin);
+}
+
+//! Sets the scroll position of paged documents and loads the pages in view.
+void canvas::setViewOrigin(const QPoint &origin)
+{
+    viewOrigin = origin;
+
+    if(isPaged())
+    {
+        pageCache -> setViewport(rect().translated(viewOrigin));
+    }
+
     update();
 }
 
+//! Starts a pan.
+void canvas::mousePressEvent(QMouseEvent *event)
+{
+    if(isPaged() && event -> button() == Qt::LeftButton)
+    {
+        panning = true;
+        panPosition = event -> pos();
+        setCursor(Qt::ClosedHandCursor);
+    }
+}
+
+//! Pans by the mouse movement since the last step; the document follows the mouse.
+void canvas::mouseMoveEvent(QMouseEvent *event)
+{
+    if(panning && isPaged())
+    {
+        setViewOrigin(viewOrigin - (event -> pos() - panPosition));
+        panPosition = event -> pos();
+    }
+}
+
+//! Ends a pan.
+void canvas::mouseReleaseEvent(QMouseEvent *event)
+{
+    if(panning && event -> button() == Qt::LeftButton)
+    {
+        panning = false;
+        unsetCursor();
+    }
+}
+
+//! Scrolls by the wheel movement.
+/*! One notch of a standard wheel (120 eighths of a degree) scrolls 60 pixels. */
+void canvas::wheelEvent(QWheelEvent *event)
+{
+    if(!isPaged())
+    {
+        event -> ignore();
+        return;
+    }
+
+    QPoint delta = event -> angleDelta() / 2;
+
+    if(event -> modifiers() & Qt::ShiftModifier)
+    {
+        delta = QPoint(delta.y(), delta.x());
+    }
+
+    setViewOrigin(viewOrigin - delta);
+    event -> accept();
+}
+
 //! Renders all shapes to the canvas.
-void canvas::paintEvent(QPaintEvent * /*event*/)
+void canvas::paintEvent(QPaintEvent *event)
 {
-    for(myVector::vector<Shape*>::iterator it = v_Shapes.begin(); it != v_Shapes.end(); ++it)
+    TRACE_SCOPE("canvas", "paint");
+    PERF_SCOPE(PAINT);
+    ALLOC_SCOPE(PAINT);
+
+    /*! One painter is shared by every shape for the whole paint event */
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+
+    int drawn{0};
+    int culled{0};
+
+    auto drawShape = [&painter, &drawn, &culled](auto &shape, const QRect &region)
     {
-        (*it) -> getPainter().begin(this);
-        (*it) -> getPainter().setRenderHint(QPainter::Antialiasing, true);
-        (*it) -> getPainter().save();
-        (*it) -> draw();
-        (*it) -> getPainter().restore();
-        (*it) -> getPainter().end();
+        if(!shape.getPaintBounds().intersects(region))
+        {
+            ++culled;
+            return;
+        }
+
+        painter.save();
+        shape.draw(painter);
+        painter.restore();
+        ++drawn;
+    };
+
+    /*! A paged document only has the shapes of the pages in view resident; setViewOrigin() loaded them */
+    if(isPaged())
+    {
+        painter.translate(-viewOrigin);
+
+        QRect region = event -> rect().translated(viewOrigin);
+
+        for(Shape *p_Shape : pageCache -> getVisibleShapes())
+        {
+            std::visit([&drawShape, &region](auto *p_Derived){drawShape(*p_Derived, region);}, toVariant(p_Shape));
+        }
+
+        painter.translate(viewOrigin);
     }
+    else
+    {
+        QRect region = event -> rect();
+
+        shapes.forEachInOrder([&drawShape, &region](auto &shape){drawShape(shape, region);});
+    }
+
+    PERF_COUNT(SHAPES_DRAWN, drawn);
+    PERF_COUNT(SHAPES_CULLED, culled);
+
+#ifdef SHAPE_PERF_COUNTERS
+    if(hudVisible)
+    {
+        drawHud(painter, drawn, culled);
+    }
+#endif
+}
+
+#ifdef SHAPE_PERF_COUNTERS
+//! Shows or hides the performance overlay.
+void canvas::setHudVisible(bool visible)
+{
+    hudVisible = visible;
+    update();
+}
+
+//! Draws the performance overlay.
+/*! The paint timer is only updated when the paint event returns, so the frame time shown is the previous frame's. */
+void canvas::drawHud(QPainter &painter, int drawn, int culled) const
+{
+    perf::TimerStats frame = perf::getTimer(perf::PAINT);
+    double meanFrame = frame.calls > 0 ? double(frame.totalNs) / double(frame.calls) / 1e6 : 0.0;
+
+    QString text = QString("frame %1 ms (mean %2 ms, %3 frames)\nshapes drawn %4, culled %5\nparse %6 ms, tables %7 ms, save %8 ms")
+                       .arg(double(frame.lastNs) / 1e6, 0, 'f', 2).arg(meanFrame, 0, 'f', 2).arg(frame.calls)
+                       .arg(drawn).arg(culled)
+                       .arg(double(perf::getTimer(perf::PARSE).lastNs) / 1e6, 0, 'f', 1)
+                       .arg(double(perf::getTimer(perf::UPDATE_SHAPE_TABLES).lastNs) / 1e6, 0, 'f', 1)
+                       .arg(double(perf::getTimer(perf::SAVE).lastNs) / 1e6, 0, 'f', 1);
+
+    QRect box(8, 8, 330, 56);
+
+    painter.save();
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 160));
+    painter.drawRect(box);
+    painter.setPen(Qt::white);
+    painter.setFont(QFont("Courier", 8));
+    painter.drawText(box.adjusted(6, 4, -6, -4), Qt::AlignLeft | Qt::AlignVCenter, text);
+    painter.restore();
 }
+#endif
@@ -6,10 +6,14 @@
 #ifndef CANVAS_H
 #define CANVAS_H
 
+#include <QMouseEvent>
 #include <QPen>
+#include <QWheelEvent>
 #include <QWidget>
 #include "vector.h"
-#include "shape.h"
+#include "shapevariant.h"
+#include "pagecache.h"
+#include "perfcounters.h"
 
 /*! The rendering area widget is promoted to class canvas; this is allowed since canvas is inherited from QWidget.
  * This promotion allows shapes to be rendered on the canvas using member functions located here.
@@ -25,20 +29,93 @@ public:
 
     //! Gets shapes from the shape vector
     /*! Allows for shape information to be rendered to the canvas.
+     * Converts the shapes once into a closed set representation, so painting does not go through virtual calls.
      * \param shapes the shape vector
      */
-    void getShapes(myVector::vector<Shape*> shapes);
+    void getShapes(const myVector::vector<Shape*> &shapes);
+
+    //! Gets the number of bytes used by the canvas's copy of the shapes to be rendered.
+    /*! \sa MainWindow::on_actionMemory_Report_triggered()
+     */
+    std::size_t getShapeBytes() const {return shapes.memoryBytes();}
+
+    //! Renders the pages of a paged document instead of the shape vector.
+    /*! While the page cache has a file open, the shapes of the pages in view are drawn; otherwise the shapes passed
+     * to getShapes() are drawn. The pages are loaded when the view moves, never by a paint event.
+     * \param pageCache the pointer to the page cache, or nullptr to always draw the shape vector
+     * \sa AllShapes::getPageCache()
+     */
+    void setPageCache(PageCache *pageCache);
+
+    //! Scrolls a paged document.
+    /*! Moves the page cache's viewport to the new visible part of the canvas, which loads the pages it shows
+     * and queues their neighbours for prefetching, then repaints.
+     * \param origin the canvas coordinate shown at the top left corner of the widget
+     * \sa MainWindow::on_actionOpen_Paged_Document_triggered()
+     */
+    void setViewOrigin(const QPoint &origin);
+
+    //! Gets the canvas coordinate shown at the top left corner of the widget.
+    const QPoint &getViewOrigin() const {return viewOrigin;}
+
+#ifdef SHAPE_PERF_COUNTERS
+    //! Shows or hides the performance overlay.
+    /*! The overlay lists the time of the previous frame, the shapes drawn and culled by the current one,
+     * and the last parse, table refresh, and save times.
+     * \param visible TRUE to draw the overlay over the shapes
+     * \sa perf
+     */
+    void setHudVisible(bool visible);
+
+    //! Checks whether the performance overlay is shown.
+    bool isHudVisible() const {return hudVisible;}
+#endif
 
 protected:
 
     //! Overrides Qt's default paint event to allow for shape rendering.
     /*! Every time something is changed in the front end, the rendering area will reflect the implementation in this function.
+     * Shapes whose paint bounds, which hold the ID label and the pen, miss the region being repainted are skipped.
+     * \sa Shape::getPaintBounds()
      * \param event the pointer to the current QPaintEvent
      */
     void paintEvent(QPaintEvent *event) override;
 
+    //! Starts panning a paged document when the left mouse button is pressed.
+    void mousePressEvent(QMouseEvent *event) override;
+
+    //! Pans a paged document by the distance the mouse moved while the left button is held.
+    void mouseMoveEvent(QMouseEvent *event) override;
+
+    //! Stops panning.
+    void mouseReleaseEvent(QMouseEvent *event) override;
+
+    //! Scrolls a paged document with the mouse wheel; horizontally while Shift is held.
+    void wheelEvent(QWheelEvent *event) override;
+
 private:
-    myVector::vector<Shape *> v_Shapes; /*!< the custom vector of shapes */
+
+    //! Checks whether a paged document is shown.
+    bool isPaged() const {return pageCache != nullptr && pageCache -> isOpen();}
+
+#ifdef SHAPE_PERF_COUNTERS
+    //! Draws the performance overlay in the top left corner.
+    /*! \param painter the painter of the paint event, without a view translation
+     * \param drawn the number of shapes drawn by this frame
+     * \param culled the number of shapes skipped by this frame
+     */
+    void drawHud(QPainter &painter, int drawn, int culled) const;
+#endif
+
+    ShapeBatches shapes;    /*!< the shapes to be rendered, in drawing order */
+    PageCache *pageCache;   /*!< the page cache of a paged document, or nullptr */
+    QPoint viewOrigin;      /*!< the canvas coordinate shown at the top left corner of the widget, used by paged documents */
+    QPoint panPosition;     /*!< the mouse position of the last pan step */
+    bool panning;           /*!< TRUE while the left mouse button drags a paged document */
+
+#ifdef SHAPE_PERF_COUNTERS
+    bool hudVisible{false}; /*!< TRUE if the performance overlay is drawn */
+#endif
 };
 
 
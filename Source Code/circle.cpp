@@ -1,13 +1,13 @@
 #include "circle.h"
 
 //! Sets the QPainter object to draw a circle according to the Circle object's specifications.
-void Circle::draw()
+void Circle::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawEllipse(position.x(), position.y(), shapeDimensions[int(Specifications::RADIUS)], shapeDimensions[int(Specifications::RADIUS)]);
     painter.setPen(Qt::black);
-    painter.drawText(position.x(), position.y(), 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the circle.
@@ -15,6 +15,7 @@ void Circle::move(const QPoint &shift)
 {
     position += shift;
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Calculates and returns the perimeter of the circle.
@@ -19,28 +19,27 @@ const int NUM_CIRCLE_SPECS = 3;
 
 /*! Derived from abstract base class Shape.
  */
-class Circle: public Shape
+class Circle final : public Shape
 {
 public:
 
     //! Default constructor
     /*! Sets the position of the top left of the circle to a default location
      */
-    Circle() : position{0,0} {}
+    Circle() : Shape(ShapeLabels::CIRCLE), position{0,0} {}
 
     //! Alternate constructor
     /*! Passes in all circle data to be implemented upon construction.
      * Initializes the circle and base class data via a base member initialization list.
      * Sets the QPoint value of the top left of the circle
-     * \sa MainWindow::on_circleSave_clicked()
+     * \sa MainWindow::circleSaveClicked()
      * \sa Circle::setPosition()
      * \param shapeId the ID number of the new circle
-     * \param shapeType the string representing a circle
      * \param numDimensions the number of dimensions a circle has
      * \param *shapeDimensions the pointer to the array of circle dimensions
      */
-    Circle(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-          :Shape(shapeId, shapeType, numDimensions, shapeDimensions)
+    Circle(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+          :Shape(shapeId, ShapeLabels::CIRCLE, numDimensions, shapeDimensions)
           {setPosition();}
 
     //! Destructor
@@ -50,8 +49,9 @@ public:
 
     //! Draws the circle according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a circle.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the circle by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a circle.
@@ -69,6 +69,13 @@ public:
      */
     dim::area calcArea() const override;
 
+    //! Finds the bounding box of the circle.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: the circle is drawn inside a rectangle with the radius as its width and height.
+     */
+    QRect calcBoundingBox() const override {return QRect(shapeDimensions[int(Specifications::X1)], shapeDimensions[int(Specifications::Y1)],
+                                                         shapeDimensions[int(Specifications::RADIUS)], shapeDimensions[int(Specifications::RADIUS)]);}
+
     //! Sets the QPoint data member to the position of the top left corner of the circle.
     /*! Overrides the pure virtual function from the base class to set the position of a circle.
      */
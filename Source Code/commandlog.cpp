@@ -0,0 +1,331 @@
+#include "commandlog.h"
+#include "shapevariant.h"
+#include "text.h"
+#include <algorithm>
+
+namespace
+{
+    //! Removes a shape from the shape vector without deleting it.
+    /*! The table sorts reorder the vector after every step, so the shape's position is not known ahead of time and its pointer
+     * is looked for. The last pointer then takes its slot, so no other pointer is moved; the order of the vector does not matter,
+     * since the tables sort it again after the step. */
+    void removeShape(myVector::vector<Shape*> &shapes, Shape *shape)
+    {
+        myVector::vector<Shape*>::iterator it = shapes.begin();
+
+        while(it != shapes.end() && *it != shape)
+        {
+            ++it;
+        }
+
+        if(it != shapes.end())
+        {
+            *it = *(shapes.end() - 1);
+            shapes.erase(shapes.end() - 1);
+        }
+    }
+
+    //! Labels a step with its verb and the type and ID of its shape, such as "Move Circle 4".
+    std::string label(const char *verb, Shape *shape)
+    {
+        return std::string(verb) + " " + shape -> getType() + " " + std::to_string(shape -> getID());
+    }
+}
+
+ShapeChange ShapeCommand::undoneChange() const
+{
+    switch(kind)
+    {
+    case ShapeChange::ADDED: return {ShapeChange::REMOVED, shapeId};
+    case ShapeChange::REMOVED: return {ShapeChange::ADDED, shapeId};
+    default: return {ShapeChange::CHANGED, shapeId};
+    }
+}
+
+AddCommand::~AddCommand()
+{
+    if(owned)
+    {
+        delete shape;
+    }
+}
+
+void AddCommand::undo(myVector::vector<Shape*> &shapes)
+{
+    removeShape(shapes, shape);
+    owned = true;
+}
+
+void AddCommand::redo(myVector::vector<Shape*> &shapes)
+{
+    shapes.push_back(shape);
+    owned = false;
+}
+
+std::size_t AddCommand::memoryBytes() const
+{
+    /*! A shape in the vector is counted with the shapes; an undone one only here */
+    return sizeof(*this) + (owned ? footprintBytes(shape) : 0);
+}
+
+std::string AddCommand::describe() const
+{
+    return label("Add", shape);
+}
+
+DeleteCommand::~DeleteCommand()
+{
+    if(owned)
+    {
+        delete shape;
+    }
+}
+
+void DeleteCommand::undo(myVector::vector<Shape*> &shapes)
+{
+    /*! The shape goes back at the end of the vector; the tables sort it into place */
+    shapes.push_back(shape);
+    owned = false;
+}
+
+void DeleteCommand::redo(myVector::vector<Shape*> &shapes)
+{
+    removeShape(shapes, shape);
+    owned = true;
+}
+
+std::size_t DeleteCommand::memoryBytes() const
+{
+    return sizeof(*this) + (owned ? footprintBytes(shape) : 0);
+}
+
+std::string DeleteCommand::describe() const
+{
+    return label("Delete", shape);
+}
+
+void MoveCommand::undo(myVector::vector<Shape*> &)
+{
+    shape -> move(-shift);
+}
+
+void MoveCommand::redo(myVector::vector<Shape*> &)
+{
+    shape -> move(shift);
+}
+
+std::string MoveCommand::describe() const
+{
+    return label("Move", shape);
+}
+
+EditCommand::State EditCommand::capture(Shape *shape)
+{
+    State state;
+    dim::specs *dimensions = shape -> getDimensions();
+
+    state.dimensions.assign(dimensions, dimensions + shape -> getNumDimensions());
+    state.penId = shape -> getPenId();
+    state.brushId = shape -> getBrushId();
+    state.fontId = 0;
+    state.flag = Qt::AlignLeft;
+
+    if(shape -> getShapeType() == ShapeLabels::TEXT)
+    {
+        Text *p_Text = static_cast<Text*>(shape);
+
+        state.fontId = p_Text -> getFontId();
+        state.flag = p_Text -> getFlag();
+        state.text = p_Text -> getText();
+    }
+
+    return state;
+}
+
+EditCommand::EditCommand(Shape *shape, const State &before, const State &after)
+    : ShapeCommand(ShapeChange::CHANGED, shape -> getID()), shape{shape},
+      penBefore{before.penId}, penAfter{after.penId}, brushBefore{before.brushId}, brushAfter{after.brushId},
+      fontBefore{before.fontId}, fontAfter{after.fontId}, flagBefore{before.flag}, flagAfter{after.flag},
+      textChanged{before.text != after.text}
+{
+    if(before.dimensions.size() == after.dimensions.size())
+    {
+        for(std::size_t i = 0; i < before.dimensions.size(); ++i)
+        {
+            if(before.dimensions[i] != after.dimensions[i])
+            {
+                changes.push_back({int(i), before.dimensions[i], after.dimensions[i]});
+            }
+        }
+
+        changes.shrink_to_fit();
+    }
+    else
+    {
+        dimensionsBefore = before.dimensions;
+        dimensionsAfter = after.dimensions;
+    }
+
+    if(textChanged)
+    {
+        textBefore = before.text;
+        textAfter = after.text;
+    }
+}
+
+bool EditCommand::isEmpty() const
+{
+    return changes.empty() && dimensionsBefore.empty() && dimensionsAfter.empty() && penBefore == penAfter && brushBefore == brushAfter
+           && fontBefore == fontAfter && flagBefore == flagAfter && !textChanged;
+}
+
+void EditCommand::undo(myVector::vector<Shape*> &)
+{
+    apply(true);
+}
+
+void EditCommand::redo(myVector::vector<Shape*> &)
+{
+    apply(false);
+}
+
+void EditCommand::apply(bool undoing)
+{
+    /*! Both dimension lists are only kept when the number of dimensions changed */
+    if(!dimensionsBefore.empty())
+    {
+        const std::vector<dim::specs> &dimensions = undoing ? dimensionsBefore : dimensionsAfter;
+
+        shape -> setBaseInfo(shapeId, int(dimensions.size()), const_cast<dim::specs*>(dimensions.data()));
+    }
+    else
+    {
+        for(const DimensionChange &change : changes)
+        {
+            shape -> setShapeDimension(change.index, undoing ? change.before : change.after);
+        }
+    }
+
+    /*! Shapes keep their position and points apart from the dimensions, so they are derived again */
+    shape -> setPosition();
+    shape -> setPenId(undoing ? penBefore : penAfter);
+    shape -> setBrushId(undoing ? brushBefore : brushAfter);
+
+    if(shape -> getShapeType() == ShapeLabels::TEXT)
+    {
+        Text *p_Text = static_cast<Text*>(shape);
+
+        p_Text -> setFontId(undoing ? fontBefore : fontAfter);
+        p_Text -> setAlignment(undoing ? flagBefore : flagAfter);
+
+        if(textChanged)
+        {
+            p_Text -> setText(undoing ? textBefore : textAfter);
+        }
+    }
+}
+
+std::size_t EditCommand::memoryBytes() const
+{
+    return sizeof(*this) + changes.capacity() * sizeof(DimensionChange)
+           + (dimensionsBefore.capacity() + dimensionsAfter.capacity()) * sizeof(dim::specs)
+           + (textChanged ? textBefore.capacity() + textAfter.capacity() : 0);
+}
+
+std::string EditCommand::describe() const
+{
+    return label("Edit", shape);
+}
+
+void CommandLog::record(ShapeCommand *command)
+{
+    for(ShapeCommand *step : redoSteps)
+    {
+        delete step;
+    }
+
+    redoSteps.clear();
+    undoSteps.push_back(command);
+
+    if(int(undoSteps.size()) > limit)
+    {
+        delete undoSteps.front();
+        undoSteps.pop_front();
+    }
+}
+
+const ShapeCommand *CommandLog::undo(myVector::vector<Shape*> &shapes)
+{
+    if(undoSteps.empty())
+    {
+        return nullptr;
+    }
+
+    ShapeCommand *command = undoSteps.back();
+
+    undoSteps.pop_back();
+    command -> undo(shapes);
+    redoSteps.push_back(command);
+
+    return command;
+}
+
+const ShapeCommand *CommandLog::redo(myVector::vector<Shape*> &shapes)
+{
+    if(redoSteps.empty())
+    {
+        return nullptr;
+    }
+
+    ShapeCommand *command = redoSteps.back();
+
+    redoSteps.pop_back();
+    command -> redo(shapes);
+    undoSteps.push_back(command);
+
+    return command;
+}
+
+void CommandLog::setLimit(int steps)
+{
+    limit = std::max(steps, 1);
+
+    while(int(undoSteps.size()) > limit)
+    {
+        delete undoSteps.front();
+        undoSteps.pop_front();
+    }
+}
+
+std::size_t CommandLog::memoryBytes() const
+{
+    std::size_t bytes = undoSteps.size() * sizeof(ShapeCommand*) + redoSteps.capacity() * sizeof(ShapeCommand*);
+
+    for(const ShapeCommand *step : undoSteps)
+    {
+        bytes += step -> memoryBytes();
+    }
+
+    for(const ShapeCommand *step : redoSteps)
+    {
+        bytes += step -> memoryBytes();
+    }
+
+    return bytes;
+}
+
+void CommandLog::clear()
+{
+    for(ShapeCommand *step : undoSteps)
+    {
+        delete step;
+    }
+
+    for(ShapeCommand *step : redoSteps)
+    {
+        delete step;
+    }
+
+    undoSteps.clear();
+    redoSteps.clear();
+}
@@ -0,0 +1,329 @@
+/*!
+ * \file    commandlog.h
+ * \brief   The undo and redo history of the shape vector, kept as a log of commands that record only what each edit changed.
+*/
+
+#ifndef COMMANDLOG_H
+#define COMMANDLOG_H
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+#include "shape.h"
+#include "vector.h"
+
+/*! \struct ShapeChange
+ * \brief Tells an observer of the shape vector which shape a new edit, an undo, or a redo affected.
+ * \sa AllShapes::setObserver()
+ */
+struct ShapeChange
+{
+    /*! \enum Kind
+     * What happened to the shape */
+    enum Kind
+    {
+        ADDED,      /*!< the shape was added to the vector */
+        REMOVED,    /*!< the shape was removed from the vector */
+        CHANGED     /*!< the shape's dimensions, position, or styles changed */
+    };
+
+    Kind kind;      /*!< what happened to the shape */
+    int shapeId;    /*!< the ID of the shape */
+};
+
+/*! \class ShapeCommand
+ * \brief One reversible step of the command log.
+ *
+ * A command is recorded after its edit was applied, so it starts out done. undo() and redo() each touch only the shape
+ * the command holds and the data it recorded; the shape is held by pointer, so no step looks a shape up by ID. Moves and edits
+ * never touch the vector. Undoing an addition or redoing a deletion scans the vector once for the shape's pointer, since
+ * the table sorts reorder it after every step, and then fills the slot with the last pointer.
+ */
+class ShapeCommand
+{
+public:
+
+    //! Constructor
+    /*! \param kind what the edit did to the shape
+     * \param shapeId the ID of the shape
+     */
+    ShapeCommand(ShapeChange::Kind kind, int shapeId) : kind{kind}, shapeId{shapeId} {}
+
+    //! Destructor
+    virtual ~ShapeCommand() {}
+
+    //! Removes functionality of a copy constructor.
+    ShapeCommand(const ShapeCommand &otherCommand) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    ShapeCommand& operator=(const ShapeCommand &otherCommand) = delete;
+
+    //! Reverts the edit.
+    /*! \param shapes the shape vector
+     */
+    virtual void undo(myVector::vector<Shape*> &shapes) = 0;
+
+    //! Applies the edit again after it was undone.
+    /*! \param shapes the shape vector
+     */
+    virtual void redo(myVector::vector<Shape*> &shapes) = 0;
+
+    //! Gets the bytes held by the command, including the data it allocated.
+    virtual std::size_t memoryBytes() const = 0;
+
+    //! Gets a short description of the edit, such as "Move Circle 4", used to label the undo and redo actions.
+    virtual std::string describe() const = 0;
+
+    //! Gets the change made by the edit.
+    ShapeChange doneChange() const {return {kind, shapeId};}
+
+    //! Gets the change made by undoing the edit: an added shape is removed, and a removed shape is added back.
+    ShapeChange undoneChange() const;
+
+protected:
+    ShapeChange::Kind kind; /*!< what the edit did to the shape */
+    int shapeId;            /*!< the ID of the shape */
+};
+
+/*! \class AddCommand
+ * \brief Adds a new shape to the vector.
+ *
+ * While the addition is undone the shape is out of the vector, and the command owns it.
+ */
+class AddCommand : public ShapeCommand
+{
+public:
+
+    //! Constructor
+    /*! \param shape the shape that was added
+     */
+    explicit AddCommand(Shape *shape) : ShapeCommand(ShapeChange::ADDED, shape -> getID()), shape{shape}, owned{false} {}
+
+    //! Destructor
+    /*! Deletes the shape if the addition was undone.
+     */
+    ~AddCommand() override;
+
+    void undo(myVector::vector<Shape*> &shapes) override;
+    void redo(myVector::vector<Shape*> &shapes) override;
+    std::size_t memoryBytes() const override;
+    std::string describe() const override;
+
+private:
+    Shape *shape;   /*!< the added shape */
+    bool owned;     /*!< TRUE while the shape is out of the vector */
+};
+
+/*! \class DeleteCommand
+ * \brief Removes a shape from the vector.
+ *
+ * The shape is kept whole rather than copied, so undoing the deletion puts the same object back. While the deletion is done
+ * the shape is out of the vector, and the command owns it.
+ */
+class DeleteCommand : public ShapeCommand
+{
+public:
+
+    //! Constructor
+    /*! \param shape the shape that was removed
+     */
+    explicit DeleteCommand(Shape *shape) : ShapeCommand(ShapeChange::REMOVED, shape -> getID()), shape{shape}, owned{true} {}
+
+    //! Destructor
+    /*! Deletes the shape unless the deletion was undone.
+     */
+    ~DeleteCommand() override;
+
+    void undo(myVector::vector<Shape*> &shapes) override;
+    void redo(myVector::vector<Shape*> &shapes) override;
+    std::size_t memoryBytes() const override;
+    std::string describe() const override;
+
+private:
+    Shape *shape;   /*!< the removed shape */
+    bool owned;     /*!< TRUE while the shape is out of the vector */
+};
+
+/*! \class MoveCommand
+ * \brief Moves a shape; only the shift is recorded, since moving back by the opposite shift restores every coordinate.
+ */
+class MoveCommand : public ShapeCommand
+{
+public:
+
+    //! Constructor
+    /*! \param shape the moved shape
+     * \param shift the x and y shift of the move
+     */
+    MoveCommand(Shape *shape, const QPoint &shift) : ShapeCommand(ShapeChange::CHANGED, shape -> getID()), shape{shape}, shift{shift} {}
+
+    void undo(myVector::vector<Shape*> &shapes) override;
+    void redo(myVector::vector<Shape*> &shapes) override;
+    std::size_t memoryBytes() const override {return sizeof(*this);}
+    std::string describe() const override;
+
+private:
+    Shape *shape;   /*!< the moved shape */
+    QPoint shift;   /*!< the x and y shift of the move */
+};
+
+/*! \class EditCommand
+ * \brief Edits the dimensions and styles of a shape, recording only the values the edit changed.
+ *
+ * The state of the shape is captured before and after the edit, and the two are compared once. A changed dimension is kept
+ * as its index and its old and new values; only an edit that changes the number of dimensions, such as adding a point to
+ * a polyline, keeps both dimension lists. Styles are kept as their style table IDs, and the text of a text box only if it changed.
+ */
+class EditCommand : public ShapeCommand
+{
+public:
+
+    /*! \struct State
+     * \brief A full copy of the editable values of a shape, used only while an edit is recorded.
+     */
+    struct State
+    {
+        std::vector<dim::specs> dimensions;     /*!< the shape dimensions */
+        int penId;                              /*!< the pen ID */
+        int brushId;                            /*!< the brush ID */
+        int fontId;                             /*!< the font ID of a text box, or 0 */
+        Qt::AlignmentFlag flag;                 /*!< the alignment of a text box */
+        std::string text;                       /*!< the text of a text box */
+    };
+
+    //! Copies the editable values of a shape.
+    /*! \param shape the shape about to be edited, or just edited
+     */
+    static State capture(Shape *shape);
+
+    //! Constructor
+    /*! \param shape the edited shape
+     * \param before the state captured before the edit
+     * \param after the state captured after the edit
+     */
+    EditCommand(Shape *shape, const State &before, const State &after);
+
+    //! Checks whether the edit left every value as it was, so there is nothing to undo.
+    bool isEmpty() const;
+
+    void undo(myVector::vector<Shape*> &shapes) override;
+    void redo(myVector::vector<Shape*> &shapes) override;
+    std::size_t memoryBytes() const override;
+    std::string describe() const override;
+
+private:
+
+    /*! \struct DimensionChange
+     * \brief One dimension changed by the edit.
+     */
+    struct DimensionChange
+    {
+        int index;              /*!< the position of the dimension in the dimension array */
+        dim::specs before;      /*!< the value before the edit */
+        dim::specs after;       /*!< the value after the edit */
+    };
+
+    //! Sets the recorded values of one side of the edit on the shape.
+    /*! \param undoing TRUE to set the values from before the edit, FALSE for those after it
+     */
+    void apply(bool undoing);
+
+    Shape *shape;                                   /*!< the edited shape */
+    std::vector<DimensionChange> changes;           /*!< the changed dimensions, if their number stayed the same */
+    std::vector<dim::specs> dimensionsBefore;       /*!< every dimension before the edit, only if their number changed */
+    std::vector<dim::specs> dimensionsAfter;        /*!< every dimension after the edit, only if their number changed */
+    int penBefore, penAfter;                        /*!< the pen IDs */
+    int brushBefore, brushAfter;                    /*!< the brush IDs */
+    int fontBefore, fontAfter;                      /*!< the font IDs */
+    Qt::AlignmentFlag flagBefore, flagAfter;        /*!< the alignments */
+    bool textChanged;                               /*!< TRUE if the text of a text box changed */
+    std::string textBefore, textAfter;              /*!< the texts, only if they changed */
+};
+
+/*! \class CommandLog
+ * \brief The undo and redo stacks of the commands applied to the shape vector.
+ *
+ * Recording a command clears the redo stack, since the undone steps no longer follow from the current state. Undoing pops
+ * a command from the undo stack onto the redo stack, and redoing moves it back. Undoing or redoing an edit or a move costs
+ * the size of the values it recorded; adding a shape back appends its pointer, and removing one scans the vector for its pointer
+ * and moves the last pointer into its slot.
+ * Once the undo stack holds more steps than the limit, the oldest one is dropped. Steps are always undone and redone
+ * in stack order, so a shape a step refers to is either in the vector or owned by the add or delete step before it.
+ * \sa AllShapes::undo()
+ * \sa AllShapes::redo()
+ */
+class CommandLog
+{
+public:
+
+    //! The default number of steps that can be undone.
+    static const int DEFAULT_LIMIT = 1000;
+
+    //! Default constructor
+    CommandLog() : limit{DEFAULT_LIMIT} {}
+
+    //! Destructor
+    /*! Deletes every command, and with them the shapes they own.
+     */
+    ~CommandLog() {clear();}
+
+    //! Removes functionality of a copy constructor.
+    CommandLog(const CommandLog &otherLog) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    CommandLog& operator=(const CommandLog &otherLog) = delete;
+
+    //! Adds a command whose edit was just applied, and clears the redo stack.
+    /*! \param command the command; the log takes ownership of it
+     */
+    void record(ShapeCommand *command);
+
+    //! Undoes the most recent step.
+    /*! \param shapes the shape vector
+     * \returns The command undone, or nullptr if there is nothing to undo.
+     */
+    const ShapeCommand *undo(myVector::vector<Shape*> &shapes);
+
+    //! Redoes the most recently undone step.
+    /*! \param shapes the shape vector
+     * \returns The command redone, or nullptr if there is nothing to redo.
+     */
+    const ShapeCommand *redo(myVector::vector<Shape*> &shapes);
+
+    //! Checks whether there is a step to undo.
+    bool canUndo() const {return !undoSteps.empty();}
+
+    //! Checks whether there is a step to redo.
+    bool canRedo() const {return !redoSteps.empty();}
+
+    //! Gets the description of the step undo() would revert, or an empty string if there is none.
+    std::string undoText() const {return undoSteps.empty() ? std::string() : undoSteps.back() -> describe();}
+
+    //! Gets the description of the step redo() would apply, or an empty string if there is none.
+    std::string redoText() const {return redoSteps.empty() ? std::string() : redoSteps.back() -> describe();}
+
+    //! Gets the number of steps that can be undone and redone.
+    int getStepCount() const {return int(undoSteps.size() + redoSteps.size());}
+
+    //! Sets the number of steps that can be undone, dropping the oldest steps beyond it.
+    /*! \param steps the limit; at least one step is kept
+     */
+    void setLimit(int steps);
+
+    //! Gets the number of steps that can be undone.
+    int getLimit() const {return limit;}
+
+    //! Gets the bytes held by the stacks and every command.
+    std::size_t memoryBytes() const;
+
+    //! Deletes every step.
+    void clear();
+
+private:
+    std::deque<ShapeCommand*> undoSteps;    /*!< the steps that can be undone, most recent at the back */
+    std::vector<ShapeCommand*> redoSteps;   /*!< the steps that can be redone, most recently undone at the back */
+    int limit;                              /*!< the most steps the undo stack holds */
+};
+
+#endif // COMMANDLOG_H
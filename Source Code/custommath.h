@@ -87,7 +87,10 @@ dim::specs multiply(T A, U B, V C, W D){return A * B * C * D;}
 template <typename T>
 double distance(T x0, T x1, T y0, T y1)
 {
-    return sqrt(pow(float(x1 - x0),2.0) + pow(float(y1 - y0),2.0));
+    double dx = double(x1) - double(x0);
+    double dy = double(y1) - double(y0);
+
+    return sqrt(dx * dx + dy * dy);
 }
 
 //! Templated function that calculates the determinant of a 2x2 matrix
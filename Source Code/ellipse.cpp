@@ -1,13 +1,13 @@
 #include "ellipse.h"
 
 //! Sets the QPainter object to draw an ellipse according to the Ellipse object's specifications.
-void Ellipse::draw()
+void Ellipse::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawEllipse(position.x(), position.y(), shapeDimensions[int(Specifications::A)], shapeDimensions[int(Specifications::B)]);
     painter.setPen(Qt::black);
-    painter.drawText(position.x(), position.y(), 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the ellipse.
@@ -15,6 +15,7 @@ void Ellipse::move(const QPoint &shift)
 {
     position += shift;
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Calculates and returns the perimeter of the ellipse.
@@ -16,28 +16,27 @@ const int NUM_ELLIPSE_SPECS = 4;
 
 /*! Derived from abstract base class Shape.
  */
-class Ellipse: public Shape
+class Ellipse final : public Shape
 {
 public:
 
     //! Default constructor
     /*! Sets the position of the top left of the ellipse to a default location
      */
-    Ellipse() : position{0,0} {}
+    Ellipse() : Shape(ShapeLabels::ELLIPSE), position{0,0} {}
 
     //! Alternate constructor
     /*! Passes in all ellipse data to be implemented upon construction.
      * Initializes the ellipse and base class data via a base member initialization list.
      * Sets the QPoint value of the top left of the ellipse
-     * \sa MainWindow::on_ellipseSave_clicked()
+     * \sa MainWindow::ellipseSaveClicked()
      * \sa Ellipse::setPosition()
      * \param shapeId the ID number of the new ellipse
-     * \param shapeType the string representing a ellipse
      * \param numDimensions the number of dimensions an ellipse has
      * \param *shapeDimensions the pointer to the array of ellipse dimensions
      */
-    Ellipse(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-          :Shape(shapeId, shapeType, numDimensions, shapeDimensions)
+    Ellipse(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+          :Shape(shapeId, ShapeLabels::ELLIPSE, numDimensions, shapeDimensions)
           {setPosition();}
 
     //! Destructor
@@ -47,8 +46,9 @@ public:
 
     //! Draws the ellipse according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw an ellipse.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the ellipse by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move an ellipse.
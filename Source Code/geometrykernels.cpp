@@ -0,0 +1,405 @@
+#include "geometrykernels.h"
+#include "custommath.h"
+#include <algorithm>
+
+#if !defined(GEOMETRY_KERNELS_SCALAR)
+    #if defined(__AVX2__)
+        #define GEOMETRY_KERNELS_AVX2
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define GEOMETRY_KERNELS_SSE2
+        #include <emmintrin.h>
+    #endif
+#endif
+
+/******************************************************************************
+ * SCALAR KERNELS
+ *****************************************************************************/
+
+//! Sums the segment lengths one segment at a time.
+double geometry::scalar::segmentLengthSum(const int *x, const int *y, int count, bool closed)
+{
+    double length{0.0};
+
+    for(int i = 0; i + 1 < count; ++i)
+    {
+        double dx = double(x[i + 1]) - double(x[i]);
+        double dy = double(y[i + 1]) - double(y[i]);
+
+        length += std::sqrt(dx * dx + dy * dy);
+    }
+
+    if(closed && count > 1)
+    {
+        double dx = double(x[0]) - double(x[count - 1]);
+        double dy = double(y[0]) - double(y[count - 1]);
+
+        length += std::sqrt(dx * dx + dy * dy);
+    }
+
+    return length;
+}
+
+//! Sums the shoelace determinants one edge at a time.
+double geometry::scalar::shoelaceArea(const int *x, const int *y, int count)
+{
+    if(count < 3)
+    {
+        return 0.0;
+    }
+
+    double twiceArea{0.0};
+
+    for(int i = 0; i + 1 < count; ++i)
+    {
+        twiceArea += determinant(double(x[i]), double(x[i + 1]), double(y[i]), double(y[i + 1]));
+    }
+
+    twiceArea += determinant(double(x[count - 1]), double(x[0]), double(y[count - 1]), double(y[0]));
+
+    return std::fabs(twiceArea / 2.0);
+}
+
+//! Computes segment lengths one segment at a time.
+void geometry::scalar::lineLengths(const int *x1, const int *y1, const int *x2, const int *y2, int count, double *length)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        double dx = double(x2[i]) - double(x1[i]);
+        double dy = double(y2[i]) - double(y1[i]);
+
+        length[i] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+//! Computes ellipse metrics one ellipse at a time.
+void geometry::scalar::ellipseMetrics(const int *a, const int *b, int count, double *perimeter, double *area)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        double aValue = double(a[i]);
+        double bValue = double(b[i]);
+
+        perimeter[i] = dim::PI * (3.0 * (aValue + bValue) - std::sqrt((3.0 * aValue + bValue) * (aValue + 3.0 * bValue)));
+        area[i] = dim::PI * aValue * bValue;
+    }
+}
+
+//! Computes circle metrics one circle at a time.
+void geometry::scalar::circleMetrics(const int *r, int count, double *perimeter, double *area)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        double radius = double(r[i]);
+
+        perimeter[i] = 2.0 * dim::PI * radius;
+        area[i] = dim::PI * radius * radius;
+    }
+}
+
+//! Finds the bounding box one point at a time.
+void geometry::scalar::boundingBox(const int *x, const int *y, int count, int &minX, int &minY, int &maxX, int &maxY)
+{
+    if(count < 1)
+    {
+        return;
+    }
+
+    minX = maxX = x[0];
+    minY = maxY = y[0];
+
+    for(int i = 1; i < count; ++i)
+    {
+        minX = std::min(minX, x[i]);
+        maxX = std::max(maxX, x[i]);
+        minY = std::min(minY, y[i]);
+        maxY = std::max(maxY, y[i]);
+    }
+}
+
+/******************************************************************************
+ * VECTOR PRIMITIVES
+ *****************************************************************************/
+
+#if defined(GEOMETRY_KERNELS_AVX2) || defined(GEOMETRY_KERNELS_SSE2)
+namespace
+{
+#if defined(GEOMETRY_KERNELS_AVX2)
+    typedef __m256d Vec;        /*!< a register of doubles */
+    typedef __m256i IntVec;     /*!< a register of ints */
+    const int WIDTH = 4;        /*!< the number of doubles in a Vec */
+    const int INT_WIDTH = 8;    /*!< the number of ints in an IntVec */
+
+    //! Loads WIDTH ints and converts them to doubles.
+    inline Vec loadInts(const int *p) {return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));}
+    inline Vec splat(double value) {return _mm256_set1_pd(value);}
+    inline Vec zero() {return _mm256_setzero_pd();}
+    inline Vec add(Vec a, Vec b) {return _mm256_add_pd(a, b);}
+    inline Vec sub(Vec a, Vec b) {return _mm256_sub_pd(a, b);}
+    inline Vec mul(Vec a, Vec b) {return _mm256_mul_pd(a, b);}
+    inline Vec root(Vec a) {return _mm256_sqrt_pd(a);}
+    inline void store(double *p, Vec v) {_mm256_storeu_pd(p, v);}
+
+    //! Adds the lanes of a register together.
+    inline double sumLanes(Vec v)
+    {
+        __m128d half = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+    }
+
+    inline IntVec loadIntVec(const int *p) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));}
+    inline IntVec minInts(IntVec a, IntVec b) {return _mm256_min_epi32(a, b);}
+    inline IntVec maxInts(IntVec a, IntVec b) {return _mm256_max_epi32(a, b);}
+    inline void storeInts(int *p, IntVec v) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);}
+#else
+    typedef __m128d Vec;        /*!< a register of doubles */
+    typedef __m128i IntVec;     /*!< a register of ints */
+    const int WIDTH = 2;        /*!< the number of doubles in a Vec */
+    const int INT_WIDTH = 4;    /*!< the number of ints in an IntVec */
+
+    //! Loads WIDTH ints and converts them to doubles.
+    inline Vec loadInts(const int *p) {return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));}
+    inline Vec splat(double value) {return _mm_set1_pd(value);}
+    inline Vec zero() {return _mm_setzero_pd();}
+    inline Vec add(Vec a, Vec b) {return _mm_add_pd(a, b);}
+    inline Vec sub(Vec a, Vec b) {return _mm_sub_pd(a, b);}
+    inline Vec mul(Vec a, Vec b) {return _mm_mul_pd(a, b);}
+    inline Vec root(Vec a) {return _mm_sqrt_pd(a);}
+    inline void store(double *p, Vec v) {_mm_storeu_pd(p, v);}
+
+    //! Adds the lanes of a register together.
+    inline double sumLanes(Vec v) {return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));}
+
+    inline IntVec loadIntVec(const int *p) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));}
+
+    //! SSE2 has no 32 bit integer min/max, so both are built from a compare and a blend.
+    inline IntVec minInts(IntVec a, IntVec b)
+    {
+        __m128i aLess = _mm_cmplt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aLess, a), _mm_andnot_si128(aLess, b));
+    }
+
+    inline IntVec maxInts(IntVec a, IntVec b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+
+    inline void storeInts(int *p, IntVec v) {_mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);}
+#endif
+}
+#endif
+
+/******************************************************************************
+ * DISPATCHED KERNELS
+ *****************************************************************************/
+
+//! Gets the instruction set the kernels were compiled for.
+const char *geometry::instructionSet()
+{
+#if defined(GEOMETRY_KERNELS_AVX2)
+    return "AVX2";
+#elif defined(GEOMETRY_KERNELS_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+#if defined(GEOMETRY_KERNELS_AVX2) || defined(GEOMETRY_KERNELS_SSE2)
+
+//! Sums the segment lengths WIDTH segments at a time.
+double geometry::segmentLengthSum(const int *x, const int *y, int count, bool closed)
+{
+    const int segments = count - 1;
+    Vec sum = zero();
+    int i{0};
+
+    for(; i + WIDTH <= segments; i += WIDTH)
+    {
+        Vec dx = sub(loadInts(x + i + 1), loadInts(x + i));
+        Vec dy = sub(loadInts(y + i + 1), loadInts(y + i));
+
+        sum = add(sum, root(add(mul(dx, dx), mul(dy, dy))));
+    }
+
+    double length = sumLanes(sum);
+
+    /*! The remaining segments and the closing edge are added by the scalar kernel */
+    if(i < segments)
+    {
+        length += scalar::segmentLengthSum(x + i, y + i, count - i, false);
+    }
+
+    if(closed && count > 1)
+    {
+        double dx = double(x[0]) - double(x[count - 1]);
+        double dy = double(y[0]) - double(y[count - 1]);
+
+        length += std::sqrt(dx * dx + dy * dy);
+    }
+
+    return length;
+}
+
+//! Sums the shoelace determinants WIDTH edges at a time.
+double geometry::shoelaceArea(const int *x, const int *y, int count)
+{
+    if(count < 3)
+    {
+        return 0.0;
+    }
+
+    const int edges = count - 1;
+    Vec sum = zero();
+    int i{0};
+
+    for(; i + WIDTH <= edges; i += WIDTH)
+    {
+        sum = add(sum, sub(mul(loadInts(x + i), loadInts(y + i + 1)), mul(loadInts(x + i + 1), loadInts(y + i))));
+    }
+
+    double twiceArea = sumLanes(sum);
+
+    for(; i < edges; ++i)
+    {
+        twiceArea += determinant(double(x[i]), double(x[i + 1]), double(y[i]), double(y[i + 1]));
+    }
+
+    twiceArea += determinant(double(x[count - 1]), double(x[0]), double(y[count - 1]), double(y[0]));
+
+    return std::fabs(twiceArea / 2.0);
+}
+
+//! Computes segment lengths WIDTH segments at a time.
+void geometry::lineLengths(const int *x1, const int *y1, const int *x2, const int *y2, int count, double *length)
+{
+    int i{0};
+
+    for(; i + WIDTH <= count; i += WIDTH)
+    {
+        Vec dx = sub(loadInts(x2 + i), loadInts(x1 + i));
+        Vec dy = sub(loadInts(y2 + i), loadInts(y1 + i));
+
+        store(length + i, root(add(mul(dx, dx), mul(dy, dy))));
+    }
+
+    scalar::lineLengths(x1 + i, y1 + i, x2 + i, y2 + i, count - i, length + i);
+}
+
+//! Computes ellipse metrics WIDTH ellipses at a time.
+void geometry::ellipseMetrics(const int *a, const int *b, int count, double *perimeter, double *area)
+{
+    const Vec pi = splat(dim::PI);
+    const Vec three = splat(3.0);
+    int i{0};
+
+    for(; i + WIDTH <= count; i += WIDTH)
+    {
+        Vec aValue = loadInts(a + i);
+        Vec bValue = loadInts(b + i);
+        Vec product = mul(add(mul(three, aValue), bValue), add(aValue, mul(three, bValue)));
+
+        store(perimeter + i, mul(pi, sub(mul(three, add(aValue, bValue)), root(product))));
+        store(area + i, mul(pi, mul(aValue, bValue)));
+    }
+
+    scalar::ellipseMetrics(a + i, b + i, count - i, perimeter + i, area + i);
+}
+
+//! Computes circle metrics WIDTH circles at a time.
+void geometry::circleMetrics(const int *r, int count, double *perimeter, double *area)
+{
+    const Vec pi = splat(dim::PI);
+    const Vec twoPi = splat(2.0 * dim::PI);
+    int i{0};
+
+    for(; i + WIDTH <= count; i += WIDTH)
+    {
+        Vec radius = loadInts(r + i);
+
+        store(perimeter + i, mul(twoPi, radius));
+        store(area + i, mul(pi, mul(radius, radius)));
+    }
+
+    scalar::circleMetrics(r + i, count - i, perimeter + i, area + i);
+}
+
+//! Finds the bounding box INT_WIDTH points at a time.
+void geometry::boundingBox(const int *x, const int *y, int count, int &minX, int &minY, int &maxX, int &maxY)
+{
+    if(count < INT_WIDTH)
+    {
+        scalar::boundingBox(x, y, count, minX, minY, maxX, maxY);
+        return;
+    }
+
+    IntVec lowX = loadIntVec(x), highX = lowX;
+    IntVec lowY = loadIntVec(y), highY = lowY;
+    int i{INT_WIDTH};
+
+    for(; i + INT_WIDTH <= count; i += INT_WIDTH)
+    {
+        IntVec xValues = loadIntVec(x + i);
+        IntVec yValues = loadIntVec(y + i);
+
+        lowX = minInts(lowX, xValues);
+        highX = maxInts(highX, xValues);
+        lowY = minInts(lowY, yValues);
+        highY = maxInts(highY, yValues);
+    }
+
+    int lanes[4][INT_WIDTH];
+
+    storeInts(lanes[0], lowX);
+    storeInts(lanes[1], lowY);
+    storeInts(lanes[2], highX);
+    storeInts(lanes[3], highY);
+
+    minX = *std::min_element(lanes[0], lanes[0] + INT_WIDTH);
+    minY = *std::min_element(lanes[1], lanes[1] + INT_WIDTH);
+    maxX = *std::max_element(lanes[2], lanes[2] + INT_WIDTH);
+    maxY = *std::max_element(lanes[3], lanes[3] + INT_WIDTH);
+
+    for(; i < count; ++i)
+    {
+        minX = std::min(minX, x[i]);
+        maxX = std::max(maxX, x[i]);
+        minY = std::min(minY, y[i]);
+        maxY = std::max(maxY, y[i]);
+    }
+}
+
+#else
+
+double geometry::segmentLengthSum(const int *x, const int *y, int count, bool closed)
+{
+    return scalar::segmentLengthSum(x, y, count, closed);
+}
+
+double geometry::shoelaceArea(const int *x, const int *y, int count)
+{
+    return scalar::shoelaceArea(x, y, count);
+}
+
+void geometry::lineLengths(const int *x1, const int *y1, const int *x2, const int *y2, int count, double *length)
+{
+    scalar::lineLengths(x1, y1, x2, y2, count, length);
+}
+
+void geometry::ellipseMetrics(const int *a, const int *b, int count, double *perimeter, double *area)
+{
+    scalar::ellipseMetrics(a, b, count, perimeter, area);
+}
+
+void geometry::circleMetrics(const int *r, int count, double *perimeter, double *area)
+{
+    scalar::circleMetrics(r, count, perimeter, area);
+}
+
+void geometry::boundingBox(const int *x, const int *y, int count, int &minX, int &minY, int &maxX, int &maxY)
+{
+    scalar::boundingBox(x, y, count, minX, minY, maxX, maxY);
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*!
+ * \file    geometrykernels.h
+ * \brief   Vectorized kernels computing lengths, areas, and bounding boxes over flattened coordinate arrays.
+ * \brief   AVX2 or SSE2 is used when the compiler targets it; every kernel also has a scalar version.
+*/
+
+#ifndef GEOMETRYKERNELS_H
+#define GEOMETRYKERNELS_H
+
+/*! \namespace geometry
+ * \brief Holds the batch kernels used by GeometryStore.
+ * Coordinates are passed as separate x and y arrays of ints, as laid out by GeometryStore.
+ * The instruction set is chosen at compile time: AVX2 when __AVX2__ is defined, SSE2 on x86-64 otherwise, and the scalar kernels everywhere else.
+ * Defining GEOMETRY_KERNELS_SCALAR forces the scalar kernels.
+ * Vectorized sums add the terms in a different order than the scalar kernels, so results may differ in the last bits.
+ * \sa GeometryStore
+ */
+namespace geometry
+{
+    //! Gets the name of the instruction set the kernels were compiled for.
+    /*! \returns "AVX2", "SSE2", or "scalar"
+     */
+    const char *instructionSet();
+
+    //! Computes the length of a chain of vertices.
+    /*! \param x the x coordinates of the vertices
+     * \param y the y coordinates of the vertices
+     * \param count the number of vertices
+     * \param closed TRUE to add the edge from the last vertex back to the first
+     * \returns The sum of all segment lengths.
+     */
+    double segmentLengthSum(const int *x, const int *y, int count, bool closed);
+
+    //! Computes the area enclosed by a polygon with the shoelace formula.
+    /*! \param x the x coordinates of the vertices
+     * \param y the y coordinates of the vertices
+     * \param count the number of vertices
+     * \returns The absolute enclosed area.
+     */
+    double shoelaceArea(const int *x, const int *y, int count);
+
+    //! Computes the lengths of independent line segments.
+    /*! \param x1 the x coordinates of the first points
+     * \param y1 the y coordinates of the first points
+     * \param x2 the x coordinates of the second points
+     * \param y2 the y coordinates of the second points
+     * \param count the number of segments
+     * \param length the output array of segment lengths
+     */
+    void lineLengths(const int *x1, const int *y1, const int *x2, const int *y2, int count, double *length);
+
+    //! Computes the perimeters and areas of ellipses.
+    /*! Uses Ramanujan's approximation for the perimeter, as Ellipse::calcPerimeter() does.
+     * \param a the semi-major axes
+     * \param b the semi-minor axes
+     * \param count the number of ellipses
+     * \param perimeter the output array of perimeters
+     * \param area the output array of areas
+     */
+    void ellipseMetrics(const int *a, const int *b, int count, double *perimeter, double *area);
+
+    //! Computes the perimeters and areas of circles.
+    /*! \param r the radii
+     * \param count the number of circles
+     * \param perimeter the output array of perimeters
+     * \param area the output array of areas
+     */
+    void circleMetrics(const int *r, int count, double *perimeter, double *area);
+
+    //! Computes the bounding box of a set of points.
+    /*! The outputs are left unchanged when count is 0.
+     * \param x the x coordinates of the points
+     * \param y the y coordinates of the points
+     * \param count the number of points
+     * \param minX the output smallest x coordinate
+     * \param minY the output smallest y coordinate
+     * \param maxX the output largest x coordinate
+     * \param maxY the output largest y coordinate
+     */
+    void boundingBox(const int *x, const int *y, int count, int &minX, int &minY, int &maxX, int &maxY);
+
+    /*! \namespace geometry::scalar
+     * \brief The scalar versions of the kernels, used for the remainders of the vectorized loops and as the reference in benchmarks.
+     */
+    namespace scalar
+    {
+        double segmentLengthSum(const int *x, const int *y, int count, bool closed);
+        double shoelaceArea(const int *x, const int *y, int count);
+        void lineLengths(const int *x1, const int *y1, const int *x2, const int *y2, int count, double *length);
+        void ellipseMetrics(const int *a, const int *b, int count, double *perimeter, double *area);
+        void circleMetrics(const int *r, int count, double *perimeter, double *area);
+        void boundingBox(const int *x, const int *y, int count, int &minX, int &minY, int &maxX, int &maxY);
+    }
+}
+
+#endif // GEOMETRYKERNELS_H
@@ -0,0 +1,263 @@
+#include "geometrystore.h"
+#include "geometrykernels.h"
+#include <algorithm>
+
+namespace
+{
+    //! Gets the number of bytes allocated by a vector.
+    template<typename T>
+    std::size_t capacityBytes(const std::vector<T> &values)
+    {
+        return values.capacity() * sizeof(T);
+    }
+}
+
+//! Gets the bytes of the arrays of one box batch.
+std::size_t GeometryStore::BoxBatch::memoryBytes() const
+{
+    return capacityBytes(ids) + capacityBytes(x) + capacityBytes(y) + capacityBytes(w) + capacityBytes(h);
+}
+
+//! Gets the bytes of the arrays of one vertex batch.
+std::size_t GeometryStore::VertexBatch::memoryBytes() const
+{
+    return capacityBytes(ids) + capacityBytes(offsets) + capacityBytes(x) + capacityBytes(y);
+}
+
+//! Appends the vertices of a polyline or polygon.
+void GeometryStore::VertexBatch::add(int id, const dim::specs *dims, int numDimensions)
+{
+    ids.push_back(id);
+
+    for(int i = 0; i + 1 < numDimensions; i += 2)
+    {
+        x.push_back(dims[i]);
+        y.push_back(dims[i + 1]);
+    }
+
+    offsets.push_back(int(x.size()));
+}
+
+//! Copies all shape geometry into the batches and computes every metric.
+void GeometryStore::rebuild(const myVector::vector<Shape*> &shapes)
+{
+    using namespace ShapeLabels;
+
+    lines.clear();
+    rectangles.clear();
+    squares.clear();
+    ellipses.clear();
+    circles.clear();
+    texts.clear();
+    polylines.clear();
+    polygons.clear();
+
+    for(int i = 0; i < shapes.size(); ++i)
+    {
+        Shape *p_Shape = shapes[i];
+        const dim::specs *dims = p_Shape -> getDimensions();
+        int id = p_Shape -> getID();
+
+        switch(p_Shape -> getShapeType())
+        {
+        case LINE:      lines.add(id, dims[0], dims[1], dims[2], dims[3]);
+                        break;
+        case POLYLINE:  polylines.add(id, dims, p_Shape -> getNumDimensions());
+                        break;
+        case POLYGON:   polygons.add(id, dims, p_Shape -> getNumDimensions());
+                        break;
+        case RECTANGLE: rectangles.add(id, dims[0], dims[1], dims[2], dims[3]);
+                        break;
+        case SQUARE:    squares.add(id, dims[0], dims[1], dims[2], dims[2]);
+                        break;
+        case ELLIPSE:   ellipses.add(id, dims[0], dims[1], dims[2], dims[3]);
+                        break;
+        case CIRCLE:    circles.add(id, dims[0], dims[1], dims[2], dims[2]);
+                        break;
+        case TEXT:      texts.add(id, dims[0], dims[1], dims[2], dims[3]);
+                        break;
+        }
+    }
+
+    assignRows();
+
+    computeLines();
+    computeBoxes(rectangles);
+    computeBoxes(squares);
+    computeEllipses();
+    computeCircles();
+    computeTexts();
+    computeVertices(polylines, false);
+    computeVertices(polygons, true);
+}
+
+//! Gets the bytes of every batch and every metric array.
+std::size_t GeometryStore::memoryBytes() const
+{
+    return lines.memoryBytes() + rectangles.memoryBytes() + squares.memoryBytes() + ellipses.memoryBytes()
+           + circles.memoryBytes() + texts.memoryBytes() + polylines.memoryBytes() + polygons.memoryBytes()
+           + capacityBytes(rowOfId) + capacityBytes(perimeters) + capacityBytes(areas)
+           + capacityBytes(boxX) + capacityBytes(boxY) + capacityBytes(boxW) + capacityBytes(boxH);
+}
+
+//! Frees every batch and metric array by replacing the store with an empty one.
+void GeometryStore::release()
+{
+    *this = GeometryStore();
+}
+
+//! Lays out the result rows and maps shape IDs to rows.
+void GeometryStore::assignRows()
+{
+    int row{0};
+
+    lines.firstRow = row;       row += int(lines.ids.size());
+    rectangles.firstRow = row;  row += int(rectangles.ids.size());
+    squares.firstRow = row;     row += int(squares.ids.size());
+    ellipses.firstRow = row;    row += int(ellipses.ids.size());
+    circles.firstRow = row;     row += int(circles.ids.size());
+    texts.firstRow = row;       row += int(texts.ids.size());
+    polylines.firstRow = row;   row += int(polylines.ids.size());
+    polygons.firstRow = row;    row += int(polygons.ids.size());
+
+    perimeters.assign(row, 0.0);
+    areas.assign(row, 0.0);
+    boxX.assign(row, 0);
+    boxY.assign(row, 0);
+    boxW.assign(row, 0);
+    boxH.assign(row, 0);
+
+    rowOfId.clear();
+
+    mapIds(lines.ids, lines.firstRow);
+    mapIds(rectangles.ids, rectangles.firstRow);
+    mapIds(squares.ids, squares.firstRow);
+    mapIds(ellipses.ids, ellipses.firstRow);
+    mapIds(circles.ids, circles.firstRow);
+    mapIds(texts.ids, texts.firstRow);
+    mapIds(polylines.ids, polylines.firstRow);
+    mapIds(polygons.ids, polygons.firstRow);
+}
+
+//! Maps the IDs of one batch to its rows.
+void GeometryStore::mapIds(const std::vector<int> &ids, int firstRow)
+{
+    for(int i = 0; i < int(ids.size()); ++i)
+    {
+        if(ids[i] >= int(rowOfId.size()))
+        {
+            rowOfId.resize(ids[i] + 1, -1);
+        }
+
+        rowOfId[ids[i]] = firstRow + i;
+    }
+}
+
+//! Computes line lengths and bounding boxes.
+void GeometryStore::computeLines()
+{
+    const int count = int(lines.ids.size());
+    const dim::coord *x1 = lines.x.data();
+    const dim::coord *y1 = lines.y.data();
+    const dim::coord *x2 = lines.w.data();
+    const dim::coord *y2 = lines.h.data();
+
+    geometry::lineLengths(x1, y1, x2, y2, count, perimeters.data() + lines.firstRow);
+
+    for(int i = 0; i < count; ++i)
+    {
+        int row = lines.firstRow + i;
+
+        boxX[row] = std::min(x1[i], x2[i]);
+        boxY[row] = std::min(y1[i], y2[i]);
+        boxW[row] = std::abs(x2[i] - x1[i]);
+        boxH[row] = std::abs(y2[i] - y1[i]);
+    }
+}
+
+//! Computes rectangle or square perimeters, areas, and bounding boxes.
+void GeometryStore::computeBoxes(const BoxBatch &batch)
+{
+    const int count = int(batch.ids.size());
+    const dim::specs *w = batch.w.data();
+    const dim::specs *h = batch.h.data();
+    double *perimeter = perimeters.data() + batch.firstRow;
+    double *area = areas.data() + batch.firstRow;
+
+    for(int i = 0; i < count; ++i)
+    {
+        perimeter[i] = 2.0 * (double(w[i]) + double(h[i]));
+        area[i] = double(w[i]) * double(h[i]);
+    }
+
+    std::copy(batch.x.begin(), batch.x.end(), boxX.begin() + batch.firstRow);
+    std::copy(batch.y.begin(), batch.y.end(), boxY.begin() + batch.firstRow);
+    std::copy(batch.w.begin(), batch.w.end(), boxW.begin() + batch.firstRow);
+    std::copy(batch.h.begin(), batch.h.end(), boxH.begin() + batch.firstRow);
+}
+
+//! Computes ellipse perimeters, areas, and bounding boxes.
+void GeometryStore::computeEllipses()
+{
+    geometry::ellipseMetrics(ellipses.w.data(), ellipses.h.data(), int(ellipses.ids.size()),
+                             perimeters.data() + ellipses.firstRow, areas.data() + ellipses.firstRow);
+
+    /*! Ellipses are drawn with their axes as the width and height of the bounding rectangle */
+    std::copy(ellipses.x.begin(), ellipses.x.end(), boxX.begin() + ellipses.firstRow);
+    std::copy(ellipses.y.begin(), ellipses.y.end(), boxY.begin() + ellipses.firstRow);
+    std::copy(ellipses.w.begin(), ellipses.w.end(), boxW.begin() + ellipses.firstRow);
+    std::copy(ellipses.h.begin(), ellipses.h.end(), boxH.begin() + ellipses.firstRow);
+}
+
+//! Computes circle perimeters, areas, and bounding boxes.
+void GeometryStore::computeCircles()
+{
+    geometry::circleMetrics(circles.w.data(), int(circles.ids.size()),
+                            perimeters.data() + circles.firstRow, areas.data() + circles.firstRow);
+
+    /*! Circles are drawn with their radius as the width and height of the bounding rectangle */
+    std::copy(circles.x.begin(), circles.x.end(), boxX.begin() + circles.firstRow);
+    std::copy(circles.y.begin(), circles.y.end(), boxY.begin() + circles.firstRow);
+    std::copy(circles.w.begin(), circles.w.end(), boxW.begin() + circles.firstRow);
+    std::copy(circles.h.begin(), circles.h.end(), boxH.begin() + circles.firstRow);
+}
+
+//! Computes text box bounding boxes; text boxes have no perimeter or area.
+void GeometryStore::computeTexts()
+{
+    std::copy(texts.x.begin(), texts.x.end(), boxX.begin() + texts.firstRow);
+    std::copy(texts.y.begin(), texts.y.end(), boxY.begin() + texts.firstRow);
+    std::copy(texts.w.begin(), texts.w.end(), boxW.begin() + texts.firstRow);
+    std::copy(texts.h.begin(), texts.h.end(), boxH.begin() + texts.firstRow);
+}
+
+//! Computes polyline or polygon lengths, areas, and bounding boxes.
+void GeometryStore::computeVertices(const VertexBatch &batch, bool closed)
+{
+    const int count = int(batch.ids.size());
+
+    for(int i = 0; i < count; ++i)
+    {
+        const int first = batch.offsets[i];
+        const int vertices = batch.offsets[i + 1] - first;
+        const dim::coord *x = batch.x.data() + first;
+        const dim::coord *y = batch.y.data() + first;
+        const int row = batch.firstRow + i;
+
+        if(vertices < 1)
+        {
+            continue;
+        }
+
+        dim::coord minX, minY, maxX, maxY;
+
+        geometry::boundingBox(x, y, vertices, minX, minY, maxX, maxY);
+
+        perimeters[row] = geometry::segmentLengthSum(x, y, vertices, closed);
+        areas[row] = closed ? geometry::shoelaceArea(x, y, vertices) : 0.0;
+        boxX[row] = minX;
+        boxY[row] = minY;
+        boxW[row] = maxX - minX;
+        boxH[row] = maxY - minY;
+    }
+}
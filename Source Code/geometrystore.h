@@ -0,0 +1,164 @@
+/*!
+ * \class   GeometryStore
+ * \brief   The class holding a struct of arrays copy of all shape geometry and computing perimeters, areas, and bounding boxes in bulk.
+*/
+
+#ifndef GEOMETRYSTORE_H
+#define GEOMETRYSTORE_H
+
+#include "shape.h"
+#include "vector.h"
+#include <QRect>
+#include <vector>
+
+/*! Every shape type gets its own batch of contiguous arrays, so the metric kernels run over plain integers instead of calling virtual functions on scattered heap objects.
+ * Polylines and polygons share the vertex batch layout: all of their vertices are flattened into one pair of coordinate arrays, with an offset array marking where each shape starts.
+ * Results are stored per row. The rows of one batch are contiguous, so every kernel writes its output in a single linear pass.
+ * Results are looked up by shape ID, since the shape vector itself is reordered whenever a table is sorted.
+ * An object of this class is maintained by AllShapes and rebuilt lazily after the shape vector changes.
+ * \sa AllShapes::getGeometry()
+ */
+class GeometryStore
+{
+public:
+
+    //! Default constructor
+    GeometryStore() {}
+
+    //! Copies the geometry of every shape into the batches and computes all metrics.
+    /*! \param shapes the vector of Shape pointers
+     */
+    void rebuild(const myVector::vector<Shape*> &shapes);
+
+    //! Gets the number of shapes in the store.
+    int size() const {return int(perimeters.size());}
+
+    //! Gets the number of bytes allocated for the batches and the computed metrics.
+    std::size_t memoryBytes() const;
+
+    //! Empties the store and frees its memory.
+    /*! The store holds no shapes afterwards and must be rebuilt before it is used again.
+     */
+    void release();
+
+    //! Checks whether the store holds metrics for a shape.
+    /*! \param shapeId the ID number of the shape
+     * \returns TRUE if the shape was in the vector when the store was last rebuilt.
+     */
+    bool contains(int shapeId) const {return shapeId >= 0 && shapeId < int(rowOfId.size()) && rowOfId[shapeId] >= 0;}
+
+    //! Gets the perimeter of a shape.
+    /*! Inline function: returns the perimeter computed by the last rebuild.
+     * \param shapeId the ID number of a shape in the store
+     * \returns The perimeter of the shape; the length for lines and polylines.
+     */
+    dim::perimeter getPerimeter(int shapeId) const {return perimeters[rowOfId[shapeId]];}
+
+    //! Gets the area of a shape.
+    /*! Inline function: returns the area computed by the last rebuild.
+     * \param shapeId the ID number of a shape in the store
+     * \returns The area of the shape; 0 for lines, polylines, and text boxes.
+     */
+    dim::area getArea(int shapeId) const {return areas[rowOfId[shapeId]];}
+
+    //! Gets the bounding box of a shape.
+    /*! Inline function: returns the extents the shape is drawn with, computed by the last rebuild.
+     * \param shapeId the ID number of a shape in the store
+     * \returns The bounding box of the shape.
+     */
+    QRect getBoundingBox(int shapeId) const {int row = rowOfId[shapeId]; return QRect(boxX[row], boxY[row], boxW[row], boxH[row]);}
+
+private:
+
+    //! The arrays of one shape type described by a position and two sizes.
+    /*! Lines store their second point in w and h. Squares store their side twice, and circles their radius twice.
+     */
+    struct BoxBatch
+    {
+        std::vector<int> ids;           /*!< the shape ID of each entry */
+        std::vector<dim::coord> x;      /*!< the x coordinates of the first point */
+        std::vector<dim::coord> y;      /*!< the y coordinates of the first point */
+        std::vector<dim::specs> w;      /*!< the widths, side lengths, axes, radii, or second x coordinates */
+        std::vector<dim::specs> h;      /*!< the heights, side lengths, axes, radii, or second y coordinates */
+        int firstRow;                   /*!< the result row of the first entry */
+
+        //! Appends one entry.
+        void add(int id, dim::specs xValue, dim::specs yValue, dim::specs wValue, dim::specs hValue)
+        {
+            ids.push_back(id); x.push_back(xValue); y.push_back(yValue); w.push_back(wValue); h.push_back(hValue);
+        }
+
+        //! Removes all entries.
+        void clear() {ids.clear(); x.clear(); y.clear(); w.clear(); h.clear();}
+
+        //! Gets the number of bytes allocated for the entries.
+        std::size_t memoryBytes() const;
+    };
+
+    //! The flattened vertices of polylines or polygons.
+    struct VertexBatch
+    {
+        std::vector<int> ids;           /*!< the shape ID of each entry */
+        std::vector<int> offsets;       /*!< the index of the first vertex of each entry, followed by the total vertex count */
+        std::vector<dim::coord> x;      /*!< the x coordinates of all vertices */
+        std::vector<dim::coord> y;      /*!< the y coordinates of all vertices */
+        int firstRow;                   /*!< the result row of the first entry */
+
+        //! Appends the vertices of one shape.
+        void add(int id, const dim::specs *dims, int numDimensions);
+
+        //! Removes all entries.
+        void clear() {ids.clear(); offsets.assign(1, 0); x.clear(); y.clear();}
+
+        //! Gets the number of bytes allocated for the entries.
+        std::size_t memoryBytes() const;
+    };
+
+    //! Lays out the result rows batch by batch and maps every shape ID to its row.
+    void assignRows();
+
+    //! Maps the IDs of one batch to its rows.
+    void mapIds(const std::vector<int> &ids, int firstRow);
+
+    //! Computes the lengths and bounding boxes of all lines.
+    void computeLines();
+
+    //! Computes the perimeters, areas, and bounding boxes of all rectangles and squares.
+    /*! \param batch the rectangles or the squares
+     */
+    void computeBoxes(const BoxBatch &batch);
+
+    //! Computes the perimeters, areas, and bounding boxes of all ellipses.
+    void computeEllipses();
+
+    //! Computes the perimeters, areas, and bounding boxes of all circles.
+    void computeCircles();
+
+    //! Computes the bounding boxes of all text boxes.
+    void computeTexts();
+
+    //! Computes the lengths or perimeters, areas, and bounding boxes of all polylines or polygons.
+    /*! \param batch the polylines or the polygons
+     * \param closed TRUE for polygons: adds the closing edge and the enclosed area
+     */
+    void computeVertices(const VertexBatch &batch, bool closed);
+
+    BoxBatch lines;         /*!< x1, y1, x2, y2 of every line */
+    BoxBatch rectangles;    /*!< x, y, width, height of every rectangle */
+    BoxBatch squares;       /*!< x, y, side, side of every square */
+    BoxBatch ellipses;      /*!< x, y, semi-major axis, semi-minor axis of every ellipse */
+    BoxBatch circles;       /*!< x, y, radius, radius of every circle */
+    BoxBatch texts;         /*!< x, y, width, height of every text box */
+    VertexBatch polylines;  /*!< the vertices of every polyline */
+    VertexBatch polygons;   /*!< the vertices of every polygon */
+
+    std::vector<int> rowOfId;                   /*!< the result row of each shape ID, or -1 */
+    std::vector<dim::perimeter> perimeters;     /*!< the perimeter of each row */
+    std::vector<dim::area> areas;               /*!< the area of each row */
+    std::vector<dim::coord> boxX;               /*!< the left edge of the bounding box of each row */
+    std::vector<dim::coord> boxY;               /*!< the top edge of the bounding box of each row */
+    std::vector<dim::specs> boxW;               /*!< the width of the bounding box of each row */
+    std::vector<dim::specs> boxH;               /*!< the height of the bounding box of each row */
+};
+
+#endif // GEOMETRYSTORE_H
@@ -0,0 +1,72 @@
+#include "idallocator.h"
+#include <algorithm>
+
+int IdAllocator::allocate()
+{
+    while(!freeIds.empty())
+    {
+        int id = freeIds.back();
+        freeIds.pop_back();
+
+        if(!isUsed(id))
+        {
+            mark(id);
+            return id;
+        }
+    }
+
+    mark(++maxId);
+
+    return maxId;
+}
+
+bool IdAllocator::reserve(int id)
+{
+    if(id < 1 || isUsed(id))
+    {
+        return false;
+    }
+
+    mark(id);
+
+    if(id > maxId)
+    {
+        maxId = id;
+    }
+
+    return true;
+}
+
+void IdAllocator::release(int id)
+{
+    if(!isUsed(id))
+    {
+        return;
+    }
+
+    usedBits[std::size_t(id >> 6)] &= ~(std::uint64_t(1) << (id & 63));
+    freeIds.push_back(id);
+    --count;
+}
+
+void IdAllocator::clear()
+{
+    usedBits.clear();
+    freeIds.clear();
+    maxId = 0;
+    count = 0;
+}
+
+void IdAllocator::mark(int id)
+{
+    std::size_t word = std::size_t(id >> 6);
+
+    if(word >= usedBits.size())
+    {
+        /*! Doubling keeps a bulk import of increasing IDs to O(1) amortized per ID */
+        usedBits.resize(std::max(word + 1, usedBits.size() * 2), 0);
+    }
+
+    usedBits[word] |= std::uint64_t(1) << (id & 63);
+    ++count;
+}
@@ -0,0 +1,67 @@
+/*!
+ * \class   IdAllocator
+ * \brief   The class handing out unique shape IDs, recycling the IDs of deleted shapes.
+*/
+
+#ifndef IDALLOCATOR_H
+#define IDALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*! One bit per ID records which IDs are in use, 64 IDs to a word, so ten million IDs take about 1.2 MB.
+ * Released IDs are pushed on a free list and handed out again, most recently released first; when the list is empty
+ * the ID after the largest one in use is handed out. Allocation, release, and the in use check are O(1),
+ * amortized over the growth of the bitmap.
+ * The parser reserves the ID of each record as it is read, so a document's IDs are known without scanning the shapes afterwards.
+ * \sa AllShapes::allocateID()
+ * \sa Parser::parseText()
+ */
+class IdAllocator
+{
+public:
+
+    //! Hands out an ID that is not in use.
+    /*! \returns The most recently released ID, or the ID after the largest one in use if none was released.
+     */
+    int allocate();
+
+    //! Marks an ID read from a file, or restored with its shape, as in use.
+    /*! \param id the ID; IDs start at 1
+     * \returns FALSE if the ID is below 1 or already in use.
+     */
+    bool reserve(int id);
+
+    //! Marks an ID as free, so it can be handed out again.
+    /*! \param id the ID of a deleted shape; nothing happens if it is not in use
+     */
+    void release(int id);
+
+    //! Checks whether an ID is in use.
+    bool isUsed(int id) const {return id > 0 && std::size_t(id >> 6) < usedBits.size() && (usedBits[std::size_t(id >> 6)] >> (id & 63) & 1) != 0;}
+
+    //! Gets the largest ID handed out or reserved, or 0 if there was none.
+    int getMaxId() const {return maxId;}
+
+    //! Gets the number of IDs in use.
+    int getCount() const {return count;}
+
+    //! Marks every ID as free and forgets the largest one.
+    void clear();
+
+    //! Gets the number of bytes held by the bitmap and the free list.
+    std::size_t memoryBytes() const {return usedBits.capacity() * sizeof(std::uint64_t) + freeIds.capacity() * sizeof(int);}
+
+private:
+
+    //! Sets the bit of an ID, growing the bitmap if needed.
+    void mark(int id);
+
+    std::vector<std::uint64_t> usedBits;    /*!< bit (id % 64) of word (id / 64) is set while the ID is in use */
+    std::vector<int> freeIds;               /*!< released IDs; an ID reserved again after its release is skipped when popped */
+    int maxId{0};                           /*!< the largest ID handed out or reserved */
+    int count{0};                           /*!< the number of IDs in use */
+};
+
+#endif // IDALLOCATOR_H
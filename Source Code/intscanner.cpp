@@ -0,0 +1,460 @@
+#include "intscanner.h"
+#include <climits>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(INT_SCANNER_SCALAR)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define INT_SCANNER_SSE2
+        #include <emmintrin.h>
+        #if defined(_MSC_VER)
+            #include <intrin.h>
+        #endif
+    #endif
+#endif
+
+namespace
+{
+    //! Checks whether a character is a space or a tab.
+    inline bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    //! Checks whether a character is a decimal digit.
+    inline bool isDigit(char c)
+    {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    //! Skips spaces and tabs.
+    inline const char *skipBlanks(const char *p, const char *last)
+    {
+        while(p < last && isBlank(*p))
+        {
+            ++p;
+        }
+
+        return p;
+    }
+
+    //! Converts a run of digits one digit at a time.
+    /*! Runs of up to nine digits cannot exceed the range of an int, so they are only checked once.
+     * \returns FALSE if the magnitude exceeds limit.
+     */
+    inline bool convertDigits(const char *p, int digits, std::uint32_t limit, std::uint32_t &magnitude)
+    {
+        std::uint64_t value{0};
+
+        if(digits <= 9)
+        {
+            for(int i = 0; i < digits; ++i)
+            {
+                value = value * 10 + std::uint64_t(p[i] - '0');
+            }
+        }
+        else
+        {
+            for(int i = 0; i < digits && value <= limit; ++i)
+            {
+                value = value * 10 + std::uint64_t(p[i] - '0');
+            }
+        }
+
+        magnitude = std::uint32_t(value);
+        return value <= limit;
+    }
+}
+
+/******************************************************************************
+ * SCALAR SCANNER
+ *****************************************************************************/
+
+//! Counts the commas one character at a time.
+int intscan::scalar::countFields(const char *first, const char *last)
+{
+    int commas{0};
+    bool blank{true};
+
+    for(const char *p = first; p < last; ++p)
+    {
+        commas += *p == ',';
+        blank = blank && isBlank(*p);
+    }
+
+    return blank ? 0 : commas + 1;
+}
+
+//! Reads the integers one character at a time.
+int intscan::scalar::parseList(const char *first, const char *last, int *values, int count)
+{
+    const char *p = first;
+
+    for(int i = 0; i < count; ++i)
+    {
+        p = skipBlanks(p, last);
+
+        bool negative = p < last && *p == '-';
+
+        if(negative)
+        {
+            ++p;
+        }
+
+        const char *digits = p;
+
+        while(p < last && isDigit(*p))
+        {
+            ++p;
+        }
+
+        std::uint32_t magnitude;
+
+        if(p == digits)
+        {
+            return int(p - first);
+        }
+
+        if(!convertDigits(digits, int(p - digits), negative ? std::uint32_t(INT_MAX) + 1 : std::uint32_t(INT_MAX), magnitude))
+        {
+            return int(digits - first) - (negative ? 1 : 0);
+        }
+
+        values[i] = negative ? int(0 - magnitude) : int(magnitude);
+        p = skipBlanks(p, last);
+
+        /*! Every integer but the last is followed by a comma */
+        if(i + 1 < count)
+        {
+            if(p == last || *p != ',')
+            {
+                return int(p - first);
+            }
+
+            ++p;
+        }
+    }
+
+    p = skipBlanks(p, last);
+
+    return p == last ? -1 : int(p - first);
+}
+
+/******************************************************************************
+ * VECTORIZED SCANNER
+ *****************************************************************************/
+
+const char *intscan::instructionSet()
+{
+#if defined(INT_SCANNER_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+#if defined(INT_SCANNER_SSE2)
+
+namespace
+{
+    const int BLOCK = 64;   /*!< the number of characters classified at once: four SSE2 registers, one bit each in a 64 bit mask */
+
+    /*! \struct BlockMasks
+     * \brief The classes of the characters of one block, one bit per character.
+     */
+    struct BlockMasks
+    {
+        std::uint64_t digits;   /*!< '0' to '9' */
+        std::uint64_t commas;   /*!< ',' */
+        std::uint64_t minus;    /*!< '-' */
+        std::uint64_t other;    /*!< anything that is not a digit, comma, minus sign, space, or tab */
+    };
+
+    //! Finds the lowest set bit of a non-zero mask.
+    inline int lowestBit(std::uint64_t mask)
+    {
+    #if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return int(index);
+    #else
+        return __builtin_ctzll(mask);
+    #endif
+    }
+
+    //! Finds the highest set bit of a non-zero mask.
+    inline int highestBit(std::uint64_t mask)
+    {
+    #if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, mask);
+        return int(index);
+    #else
+        return 63 - __builtin_clzll(mask);
+    #endif
+    }
+
+    //! Computes the parity of the bits at or below each position.
+    /*! \returns A mask with bit i set if an odd number of the bits 0 to i of mask are set.
+     */
+    inline std::uint64_t prefixParity(std::uint64_t mask)
+    {
+        mask ^= mask << 1;
+        mask ^= mask << 2;
+        mask ^= mask << 4;
+        mask ^= mask << 8;
+        mask ^= mask << 16;
+        mask ^= mask << 32;
+
+        return mask;
+    }
+
+    //! Classifies a block of characters, 16 at a time.
+    /*! In a block shorter than BLOCK characters, the last partial group of 16 is read with a load ending at the last character,
+     * whose masks are shifted into place, and the positions past the text are classified as spaces; nothing past the text is read.
+     * Text shorter than 16 characters is copied into a buffer padded with spaces.
+     */
+    inline BlockMasks classify(const char *p, int length)
+    {
+        const __m128i zeroBelow = _mm_set1_epi8('0' - 1);
+        const __m128i nineAbove = _mm_set1_epi8('9' + 1);
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i minus = _mm_set1_epi8('-');
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+
+        BlockMasks masks{0, 0, 0, 0};
+        std::uint64_t known = length < BLOCK ? ~0ULL << length : 0;
+
+        for(int i = 0; i < length; i += 16)
+        {
+            __m128i bytes;
+            int shift{0};
+
+            if(length - i >= 16)
+            {
+                bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            }
+            else if(length >= 16)
+            {
+                bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + length - 16));
+                shift = 16 - (length - i);
+            }
+            else
+            {
+                char padded[16];
+
+                for(int j = 0; j < 16; ++j)
+                {
+                    padded[j] = j < length ? p[j] : ' ';
+                }
+
+                bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(padded));
+            }
+
+            __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(bytes, zeroBelow), _mm_cmplt_epi8(bytes, nineAbove));
+            __m128i commas = _mm_cmpeq_epi8(bytes, comma);
+            __m128i minuses = _mm_cmpeq_epi8(bytes, minus);
+            __m128i blanks = _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, tab));
+            __m128i all = _mm_or_si128(_mm_or_si128(digits, commas), _mm_or_si128(minuses, blanks));
+
+            masks.digits |= std::uint64_t(unsigned(_mm_movemask_epi8(digits)) >> shift) << i;
+            masks.commas |= std::uint64_t(unsigned(_mm_movemask_epi8(commas)) >> shift) << i;
+            masks.minus |= std::uint64_t(unsigned(_mm_movemask_epi8(minuses)) >> shift) << i;
+            known |= std::uint64_t(unsigned(_mm_movemask_epi8(all)) >> shift) << i;
+        }
+
+        masks.other = ~known;
+
+        return masks;
+    }
+
+    //! Converts a run of up to eight digits with three multiplications on one 64 bit word.
+    /*! The run is shifted to the top of the word so the bytes below it read as leading zeros.
+     * Requires eight readable characters at p and a little endian target.
+     */
+    inline std::uint32_t convertEightDigits(const char *p, int digits)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+
+        const int shift = 8 * (8 - digits);
+
+        word = (word << shift) - (0x3030303030303030ULL << shift);
+        word = (word * 10) + (word >> 8);
+        word = (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+                + (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+
+        return std::uint32_t(word);
+    }
+}
+
+//! Counts the commas 16 characters at a time.
+/*! Each byte lane keeps its own count, which is summed into the total before it can overflow.
+ * The last partial group of 16 is read with a load ending at the last character, and its characters already counted are masked off.
+ */
+int intscan::countFields(const char *first, const char *last)
+{
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i zero = _mm_setzero_si128();
+
+    if(last - first < 16)
+    {
+        return scalar::countFields(first, last);
+    }
+
+    const char *p = first;
+    long long commas{0};
+    unsigned nonBlank{0};
+
+    while(last - p >= 16)
+    {
+        __m128i laneCounts = zero;
+
+        for(int i = 0; i < 255 && last - p >= 16; ++i, p += 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i blanks = _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, tab));
+
+            laneCounts = _mm_sub_epi8(laneCounts, _mm_cmpeq_epi8(bytes, comma));
+            nonBlank |= ~unsigned(_mm_movemask_epi8(blanks)) & 0xFFFF;
+        }
+
+        __m128i sums = _mm_sad_epu8(laneCounts, zero);
+        commas += _mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(sums, sums));
+    }
+
+    if(p < last)
+    {
+        const unsigned fresh = 0xFFFFu << (16 - (last - p)) & 0xFFFF;
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last - 16));
+        __m128i blanks = _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, tab));
+        unsigned tailCommas = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, comma))) & fresh;
+
+        while(tailCommas != 0)
+        {
+            ++commas;
+            tailCommas &= tailCommas - 1;
+        }
+
+        nonBlank |= ~unsigned(_mm_movemask_epi8(blanks)) & fresh;
+    }
+
+    return nonBlank != 0 ? int(commas) + 1 : 0;
+}
+
+/*! The text is classified BLOCK characters at a time and each block is checked as a whole with bit operations:
+ * the starts of digit runs and the commas must alternate, beginning and ending with an integer, and a minus sign may only come right before a run.
+ * The integers are then read from the run starts, so nothing is checked per integer but its length.
+ * Only valid lists are read here: anything unexpected, including a number out of range, hands the whole list to the scalar scanner,
+ * which finds the position of the problem.
+ */
+int intscan::parseList(const char *first, const char *last, int *values, int count)
+{
+    const char *p = first;
+    int found{0};
+    std::uint64_t afterInteger{0};  // all ones if the last integer or comma read was an integer
+
+    while(p < last)
+    {
+        const bool finalBlock = last - p <= BLOCK;
+        const BlockMasks masks = classify(p, finalBlock ? int(last - p) : BLOCK);
+
+        if(masks.other != 0)
+        {
+            return scalar::parseList(first, last, values, count);
+        }
+
+        std::uint64_t starts = masks.digits & ~(masks.digits << 1);
+
+        /*! A block other than the last ends one character early, so a minus sign in its last bit is checked with the next block.
+         * A run reaching its end is left for the next block, which starts at the run or at its minus sign.
+         */
+        int consumed = finalBlock ? BLOCK : BLOCK - 1;
+
+        if(!finalBlock && (masks.digits >> (BLOCK - 1)) != 0)
+        {
+            const int start = starts != 0 ? highestBit(starts) : 0;
+
+            consumed = start > 0 ? start - int((masks.minus >> (start - 1)) & 1) : 0;
+        }
+
+        if(consumed == 0)
+        {
+            return scalar::parseList(first, last, values, count);
+        }
+
+        const std::uint64_t window = consumed == BLOCK ? ~0ULL : (1ULL << consumed) - 1;
+        const std::uint64_t commas = masks.commas & window;
+
+        starts &= window;
+
+        /*! Counting integers and commas in order, integers must have even positions and commas odd ones */
+        const std::uint64_t parity = prefixParity(starts | commas) ^ afterInteger;
+
+        if((starts & ~parity) != 0 || (commas & parity) != 0 || (masks.minus & window & ~(starts >> 1)) != 0)
+        {
+            return scalar::parseList(first, last, values, count);
+        }
+
+        afterInteger = 0 - (parity >> (BLOCK - 1));
+
+        while(starts != 0)
+        {
+            const int start = lowestBit(starts);
+            const std::uint64_t nonDigits = ~masks.digits >> start;
+            const int digits = nonDigits != 0 ? lowestBit(nonDigits) : BLOCK - start;
+            const bool negative = start > 0 && ((masks.minus >> (start - 1)) & 1) != 0;
+            const char *run = p + start;
+            std::uint32_t magnitude;
+
+            if(found == count)
+            {
+                return scalar::parseList(first, last, values, count);
+            }
+
+            if(digits <= 8 && last - run >= 8)
+            {
+                magnitude = convertEightDigits(run, digits);
+            }
+            else if(digits > 10 || !convertDigits(run, digits, negative ? std::uint32_t(INT_MAX) + 1 : std::uint32_t(INT_MAX), magnitude))
+            {
+                return scalar::parseList(first, last, values, count);
+            }
+
+            values[found++] = negative ? int(0 - magnitude) : int(magnitude);
+            starts &= starts - 1;
+        }
+
+        if(finalBlock)
+        {
+            break;
+        }
+
+        p += consumed;
+    }
+
+    /*! The list must not end with a comma */
+    if(found != count || (found > 0 && afterInteger == 0))
+    {
+        return scalar::parseList(first, last, values, count);
+    }
+
+    return -1;
+}
+
+#else
+
+int intscan::countFields(const char *first, const char *last)
+{
+    return scalar::countFields(first, last);
+}
+
+int intscan::parseList(const char *first, const char *last, int *values, int count)
+{
+    return scalar::parseList(first, last, values, count);
+}
+
+#endif
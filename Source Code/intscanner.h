@@ -0,0 +1,55 @@
+/*!
+ * \file    intscanner.h
+ * \brief   Reads comma separated lists of integers, such as the ShapeDimensions lines of a shape file, straight into an int array.
+ * \brief   SSE2 is used to classify digits when the compiler targets it; every function also has a scalar version.
+*/
+
+#ifndef INTSCANNER_H
+#define INTSCANNER_H
+
+/*! \namespace intscan
+ * \brief Holds the integer list scanner used by Parser.
+ * A list is read in two passes over the text: countFields() counts the separators, so the caller can size the output storage
+ * (such as a shape's dimensions) first, and parseList() then writes each integer into it, with no container in between.
+ * An integer is an optional minus sign followed by decimal digits, and must fit in an int. Spaces and tabs may surround each one.
+ * The vectorized parseList() finds the length of each run of digits with one 16 byte comparison, and converts runs of up to
+ * eight digits with a few 64 bit multiplications instead of one multiplication per digit.
+ * The instruction set is chosen at compile time: SSE2 on x86-64, and the scalar functions everywhere else.
+ * Defining INT_SCANNER_SCALAR forces the scalar functions.
+ * \sa Parser::readDimensions()
+ */
+namespace intscan
+{
+    //! Gets the name of the instruction set the scanner was compiled for.
+    /*! \returns "SSE2" or "scalar"
+     */
+    const char *instructionSet();
+
+    //! Counts the fields of a comma separated list.
+    /*! \param first the first character of the list
+     * \param last one past the last character of the list
+     * \returns The number of commas plus one, or 0 if the text holds nothing but spaces and tabs.
+     */
+    int countFields(const char *first, const char *last);
+
+    //! Reads a comma separated list of integers.
+    /*! \param first the first character of the list
+     * \param last one past the last character of the list
+     * \param values the output array; receives count integers
+     * \param count the number of integers in the list, as counted by countFields()
+     * \returns -1 if count integers were read and only spaces and tabs follow them,
+     * otherwise the position of the first character that is not part of a valid list.
+     */
+    int parseList(const char *first, const char *last, int *values, int count);
+
+    /*! \namespace intscan::scalar
+     * \brief The scalar versions of the scanner, used on targets without SSE2 and as the reference in benchmarks.
+     */
+    namespace scalar
+    {
+        int countFields(const char *first, const char *last);
+        int parseList(const char *first, const char *last, int *values, int count);
+    }
+}
+
+#endif // INTSCANNER_H
@@ -0,0 +1,224 @@
+/*!
+ * \file    keywordtables.h
+ * \brief   Compile time perfect hash tables mapping the keywords of the shapes file to their enumeration values and back.
+ * \brief   Free of Qt, so standalone tools and benchmarks can use the same tables as the application.
+*/
+
+#ifndef KEYWORDTABLES_H
+#define KEYWORDTABLES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/*! \namespace keywords
+ * \brief Holds one KeywordTable per group of keywords in the shapes file.
+ * The values are the Qt enumeration values (or ShapeLabels::eShapes for shape types); qtconversions.cpp and parser.cpp check them against Qt at compile time.
+ * The entries of each table are listed in the same order as the matching string array in qtconversions.h.
+ */
+namespace keywords
+{
+    //! One keyword and its enumeration value.
+    struct Keyword
+    {
+        std::string_view name;  /*!< the keyword as written in the shapes file */
+        int value;              /*!< the enumeration value of the keyword */
+    };
+
+    //! A perfect hash table over a fixed set of keywords, built entirely at compile time.
+    /*! The constructor searches for a hash seed that gives every keyword its own bucket, so a lookup costs one hash and one string comparison.
+     * Nothing is allocated; a table that cannot be built fails to compile.
+     * \tparam N the number of keywords
+     */
+    template<std::size_t N>
+    class KeywordTable
+    {
+    public:
+
+        static constexpr std::size_t BUCKETS = 64;  /*!< the number of hash buckets; a power of two well above N */
+
+        static_assert(N * 4 <= BUCKETS, "Too many keywords for one table");
+
+        //! Constructor
+        /*! Copies the keywords and finds a collision free hash seed.
+         * \param list the keywords, in the order of the matching string array
+         */
+        constexpr explicit KeywordTable(const Keyword (&list)[N]) : entries{}, buckets{}, seed{0}
+        {
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                entries[i] = list[i];
+            }
+
+            for(seed = 0; seed < 100000; ++seed)
+            {
+                if(fillBuckets())
+                {
+                    return;
+                }
+            }
+
+            throw "No perfect hash seed found for this keyword table";
+        }
+
+        //! Finds the enumeration value of a keyword.
+        /*! \param name the keyword
+         * \param notFound the value returned if the keyword is not in the table
+         * \returns The enumeration value of the keyword, or notFound.
+         */
+        constexpr int find(std::string_view name, int notFound = -1) const
+        {
+            int index = indexOf(name);
+
+            return index < 0 ? notFound : entries[index].value;
+        }
+
+        //! Finds the position of a keyword in the table.
+        /*! \param name the keyword
+         * \returns The position of the keyword in the list the table was built from, or -1.
+         */
+        constexpr int indexOf(std::string_view name) const
+        {
+            int index = buckets[hash(name, seed) & (BUCKETS - 1)] - 1;
+
+            return (index >= 0 && entries[index].name == name) ? index : -1;
+        }
+
+        //! Finds the position of an enumeration value in the table.
+        /*! \param value the enumeration value
+         * \param notFound the position returned if no keyword has the value
+         * \returns The position of the first keyword with the value, or notFound.
+         */
+        constexpr int indexOfValue(int value, int notFound = -1) const
+        {
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                if(entries[i].value == value)
+                {
+                    return int(i);
+                }
+            }
+
+            return notFound;
+        }
+
+        //! Gets the keyword at a position in the table.
+        constexpr std::string_view nameAt(int index) const {return entries[index].name;}
+
+        //! Gets the number of keywords in the table.
+        constexpr std::size_t size() const {return N;}
+
+    private:
+
+        //! Hashes a keyword from its length and its first, middle, and last characters.
+        /*! Reading a fixed number of characters keeps a lookup cheaper than comparing the keyword with each entry.
+         * Keywords that share all four values cannot be told apart; the constructor then fails to compile.
+         */
+        static constexpr std::uint32_t hash(std::string_view name, std::uint32_t seed)
+        {
+            const std::size_t length = name.size();
+
+            if(length == 0)
+            {
+                return seed;
+            }
+
+            std::uint32_t h = std::uint32_t(length)
+                            | std::uint32_t(std::uint8_t(name[0])) << 8
+                            | std::uint32_t(std::uint8_t(name[length / 2])) << 16
+                            | std::uint32_t(std::uint8_t(name[length - 1])) << 24;
+
+            h = (h ^ seed) * 2654435761u;
+
+            return h ^ (h >> 15);
+        }
+
+        //! Places every keyword in its bucket with the current seed.
+        /*! \returns FALSE if two keywords collide.
+         */
+        constexpr bool fillBuckets()
+        {
+            for(std::size_t s = 0; s < BUCKETS; ++s)
+            {
+                buckets[s] = 0;
+            }
+
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                std::size_t s = hash(entries[i].name, seed) & (BUCKETS - 1);
+
+                if(buckets[s] != 0)
+                {
+                    return false;
+                }
+
+                buckets[s] = int(i) + 1;
+            }
+
+            return true;
+        }
+
+        Keyword entries[N];     /*!< the keywords, in the order they were listed */
+        int buckets[BUCKETS];   /*!< the position of the keyword in each bucket plus one, or 0 for an empty bucket */
+        std::uint32_t seed;     /*!< the hash seed that places every keyword in its own bucket */
+    };
+
+    //! Qt::GlobalColor values; "green" is Qt::darkGreen.
+    inline constexpr Keyword COLOR_KEYWORDS[] = {
+        {"white", 3}, {"black", 2}, {"red", 7}, {"green", 14}, {"blue", 9},
+        {"cyan", 10}, {"magenta", 11}, {"yellow", 12}, {"gray", 5}
+    };
+
+    //! Qt::PenStyle values.
+    inline constexpr Keyword PEN_STYLE_KEYWORDS[] = {
+        {"NoPen", 0}, {"SolidLine", 1}, {"DashLine", 2}, {"DotLine", 3}, {"DashDotLine", 4}, {"DashDotDotLine", 5}
+    };
+
+    //! Qt::PenCapStyle values.
+    inline constexpr Keyword CAP_STYLE_KEYWORDS[] = {
+        {"FlatCap", 0x00}, {"SquareCap", 0x10}, {"RoundCap", 0x20}
+    };
+
+    //! Qt::PenJoinStyle values.
+    inline constexpr Keyword JOIN_STYLE_KEYWORDS[] = {
+        {"MiterJoin", 0x00}, {"BevelJoin", 0x40}, {"RoundJoin", 0x80}
+    };
+
+    //! Qt::BrushStyle values.
+    inline constexpr Keyword BRUSH_STYLE_KEYWORDS[] = {
+        {"SolidPattern", 1}, {"HorPattern", 9}, {"VerPattern", 10}, {"NoBrush", 0}
+    };
+
+    //! Qt::AlignmentFlag values.
+    inline constexpr Keyword ALIGNMENT_KEYWORDS[] = {
+        {"AlignLeft", 0x01}, {"AlignRight", 0x02}, {"AlignTop", 0x20}, {"AlignBottom", 0x40}, {"AlignCenter", 0x84}
+    };
+
+    //! QFont::Style values.
+    inline constexpr Keyword FONT_STYLE_KEYWORDS[] = {
+        {"StyleNormal", 0}, {"StyleItalic", 1}, {"StyleOblique", 2}
+    };
+
+    //! QFont::Weight values (Qt 5).
+    inline constexpr Keyword FONT_WEIGHT_KEYWORDS[] = {
+        {"Thin", 0}, {"Light", 25}, {"Normal", 50}, {"Bold", 75}
+    };
+
+    //! ShapeLabels::eShapes values.
+    inline constexpr Keyword SHAPE_TYPE_KEYWORDS[] = {
+        {"Line", 0}, {"Polyline", 1}, {"Polygon", 2}, {"Rectangle", 3},
+        {"Square", 4}, {"Ellipse", 5}, {"Circle", 6}, {"Text", 7}
+    };
+
+    inline constexpr KeywordTable<9> COLOR_TABLE{COLOR_KEYWORDS};               /*!< the supported colors */
+    inline constexpr KeywordTable<6> PEN_STYLE_TABLE{PEN_STYLE_KEYWORDS};       /*!< the supported pen styles */
+    inline constexpr KeywordTable<3> CAP_STYLE_TABLE{CAP_STYLE_KEYWORDS};       /*!< the supported pen cap styles */
+    inline constexpr KeywordTable<3> JOIN_STYLE_TABLE{JOIN_STYLE_KEYWORDS};     /*!< the supported pen join styles */
+    inline constexpr KeywordTable<4> BRUSH_STYLE_TABLE{BRUSH_STYLE_KEYWORDS};   /*!< the supported brush styles */
+    inline constexpr KeywordTable<5> ALIGNMENT_TABLE{ALIGNMENT_KEYWORDS};       /*!< the supported text alignments */
+    inline constexpr KeywordTable<3> FONT_STYLE_TABLE{FONT_STYLE_KEYWORDS};     /*!< the supported font styles */
+    inline constexpr KeywordTable<4> FONT_WEIGHT_TABLE{FONT_WEIGHT_KEYWORDS};   /*!< the supported font weights */
+    inline constexpr KeywordTable<8> SHAPE_TYPE_TABLE{SHAPE_TYPE_KEYWORDS};     /*!< the shape types */
+}
+
+#endif // KEYWORDTABLES_H
@@ -0,0 +1,95 @@
+/*!
+ * \file    lazyform.h
+ * \brief   Builds a form designed in its own .ui file into a placeholder page the first time the form is used.
+*/
+
+#ifndef LAZYFORM_H
+#define LAZYFORM_H
+
+#include <QWidget>
+#include <functional>
+
+/*! \class LazyForm
+ * \brief Holds the widgets of one add or edit form, which are only created when the form is first used.
+ *
+ * The main window keeps an empty page for each form. Accessing a widget through operator->() builds the form into
+ * its page with the form's generated setupUi(), and later accesses reuse it. Functions that only reset a form check
+ * isBuilt() first, since a form that was never built is still in its initial state. The signals of the form's widgets
+ * are connected right after they are built. Their slots are not named on_<object name>_<signal>, since the window's
+ * setupUi() would try to auto-connect them to widgets that do not exist yet and warn about each one.
+ * \tparam Form the class generated by uic from the form's .ui file
+ * \sa MainWindow::on_addShapeType_currentIndexChanged()
+ */
+template<typename Form>
+class LazyForm
+{
+public:
+
+    //! Default constructor
+    LazyForm() : form{nullptr}, page{nullptr} {}
+
+    //! Destructor
+    /*! The widgets belong to the page; only the pointers generated by uic are deleted.
+     */
+    ~LazyForm() {delete form;}
+
+    //! Removes functionality of a copy constructor.
+    LazyForm(const LazyForm &otherForm) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    LazyForm& operator=(const LazyForm &otherForm) = delete;
+
+    //! Sets the page the form is built into.
+    /*! \param page the empty page of the form
+     * \param connectSignals connects the signals of the form's widgets to their slots once the form is built
+     */
+    void setPage(QWidget *page, std::function<void(Form*)> connectSignals)
+    {
+        this->page = page;
+        this->connectSignals = connectSignals;
+    }
+
+    //! Builds the form if it was not built yet.
+    /*! \returns The generated form class holding the form's widgets.
+     */
+    Form *build();
+
+    //! Checks whether the form was built.
+    bool isBuilt() const {return form != nullptr;}
+
+    //! Accesses the widgets of the form, building it first if needed.
+    Form *operator->() {return build();}
+
+private:
+    Form *form;                                 /*!< the generated form class, or nullptr until the form is built */
+    QWidget *page;                              /*!< the page the form is built into */
+    std::function<void(Form*)> connectSignals;  /*!< connects the signals of the form's widgets */
+};
+
+template<typename Form>
+Form *LazyForm<Form>::build()
+{
+    if(form == nullptr)
+    {
+        bool visible = page -> isVisible();
+
+        form = new Form;
+        form -> setupUi(page);
+
+        if(connectSignals)
+        {
+            connectSignals(form);
+        }
+
+        /*! Widgets added to a page that is already shown stay hidden until the page is shown again */
+        if(visible)
+        {
+            page -> hide();
+            page -> show();
+        }
+    }
+
+    return form;
+}
+
+#endif // LAZYFORM_H
@@ -0,0 +1,165 @@
+#include "lazyshapestore.h"
+#include "shapevariant.h"
+
+LazyShapeStore::LazyShapeStore(std::size_t memoryBudget)
+    : device{nullptr}, memoryBudget{memoryBudget}, residentBytes{0}, hits{0}, loads{0}, evictions{0}
+{}
+
+LazyShapeStore::~LazyShapeStore()
+{
+    close();
+}
+
+bool LazyShapeStore::open(const std::string &fileName, QPaintDevice *device)
+{
+    close();
+
+    if(!index.open(fileName))
+    {
+        return false;
+    }
+
+    file.open(fileName, std::ios::in | std::ios::binary);
+
+    if(!file.is_open())
+    {
+        index = ShapeIndex();
+        return false;
+    }
+
+    this -> fileName = fileName;
+    this -> device = device;
+    parseReport = ParseReport();
+
+    return true;
+}
+
+void LazyShapeStore::close()
+{
+    for(std::pair<const int, Resident> &resident : residents)
+    {
+        delete resident.second.p_Shape;
+    }
+
+    residents.clear();
+    recency.clear();
+    residentBytes = 0;
+
+    if(file.is_open())
+    {
+        file.close();
+    }
+
+    index = ShapeIndex();
+    fileName.clear();
+}
+
+Shape *LazyShapeStore::getShape(int shapeId)
+{
+    std::unordered_map<int, Resident>::iterator it = residents.find(shapeId);
+
+    if(it != residents.end())
+    {
+        ++hits;
+        recency.splice(recency.begin(), recency, it -> second.position);
+
+        return it -> second.p_Shape;
+    }
+
+    const ShapeIndexEntry *p_Entry = index.find(shapeId);
+
+    if(p_Entry == nullptr)
+    {
+        return nullptr;
+    }
+
+    Shape *p_Shape = load(*p_Entry);
+
+    if(p_Shape == nullptr)
+    {
+        return nullptr;
+    }
+
+    recency.push_front(shapeId);
+
+    Resident resident{p_Shape, estimateBytes(p_Shape), false, recency.begin()};
+
+    residentBytes += resident.bytes;
+    residents.emplace(shapeId, resident);
+
+    evict(shapeId);
+
+    return p_Shape;
+}
+
+void LazyShapeStore::setPinned(int shapeId, bool pinned)
+{
+    std::unordered_map<int, Resident>::iterator it = residents.find(shapeId);
+
+    if(it != residents.end())
+    {
+        it -> second.pinned = pinned;
+    }
+
+    if(!pinned)
+    {
+        evict(-1);
+    }
+}
+
+void LazyShapeStore::setMemoryBudget(std::size_t bytes)
+{
+    memoryBudget = bytes;
+    evict(-1);
+}
+
+std::size_t LazyShapeStore::estimateBytes(Shape *p_Shape)
+{
+    return footprintBytes(p_Shape);
+}
+
+/*! The record is read in one block and parsed from memory, so a load costs one seek and one read. */
+Shape *LazyShapeStore::load(const ShapeIndexEntry &entry)
+{
+    recordBuffer.resize(std::size_t(entry.length));
+
+    file.clear();
+    file.seekg(entry.offset);
+
+    file.read(&recordBuffer[0], std::streamsize(entry.length));
+    recordBuffer.resize(std::size_t(file.gcount()));
+
+    if(recordBuffer.empty())
+    {
+        return nullptr;
+    }
+
+    ++loads;
+
+    return parser.parseRecord(recordBuffer, device, parseReport);
+}
+
+/*! Walks the recency list from the least recently used end, skipping pinned shapes and the shape just loaded. */
+void LazyShapeStore::evict(int keepId)
+{
+    std::list<int>::iterator it = recency.end();
+
+    while(residentBytes > memoryBudget && it != recency.begin())
+    {
+        --it;
+
+        std::unordered_map<int, Resident>::iterator resident = residents.find(*it);
+
+        if(*it == keepId || resident -> second.pinned)
+        {
+            continue;
+        }
+
+        residentBytes -= resident -> second.bytes;
+        delete resident -> second.p_Shape;
+        residents.erase(resident);
+
+        it = recency.erase(it);
+        ++evictions;
+    }
+}
@@ -0,0 +1,161 @@
+/*!
+ * \class   LazyShapeStore
+ * \brief   Opens a shape file through its offset index and constructs shapes only when they are asked for.
+*/
+
+#ifndef LAZYSHAPESTORE_H
+#define LAZYSHAPESTORE_H
+
+#include "parser.h"
+#include "shapeindex.h"
+#include <cstddef>
+#include <fstream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*! Opening a document only reads (or builds) its ShapeIndex; no shape is constructed.
+ * getShape() seeks to the shape's record, parses that record alone, and keeps the shape resident.
+ * Resident shapes are kept in least recently used order. When their estimated size exceeds the memory budget,
+ * the least recently used shapes are deleted; they are parsed again if they are asked for again.
+ * Pinned shapes (such as shapes being edited) are never evicted.
+ * Questions about position, such as which shapes lie in a region, are answered from the index without loading anything.
+ * \sa ShapeIndex
+ * Records with errors load as nullptr and are listed in the parse report.
+ * \sa Parser::parseRecord()
+ * The application does not use the store yet; AllShapes::addShapesFromFile() still parses the whole file.
+ * It is built and checked by Benchmarks/lazystore.
+ */
+class LazyShapeStore
+{
+public:
+
+    static constexpr std::size_t DEFAULT_MEMORY_BUDGET = std::size_t(64) << 20;    /*!< The memory budget used when none is given: 64 MiB */
+
+    //! Constructor
+    /*! \param memoryBudget the largest number of bytes resident shapes may use before some are evicted
+     */
+    explicit LazyShapeStore(std::size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    //! Destructor
+    /*! Deletes every resident shape.
+     */
+    ~LazyShapeStore();
+
+    //! Removes functionality of a copy constructor.
+    LazyShapeStore(const LazyShapeStore &otherStore) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    LazyShapeStore& operator=(const LazyShapeStore &otherStore) = delete;
+
+    //! Opens a shape file.
+    /*! Closes the current file first.
+     * \param fileName the path of the shape file
+     * \param device the pointer to the QPaintDevice shapes are created for
+     * \returns FALSE if the file cannot be read.
+     * \sa ShapeIndex::open()
+     */
+    bool open(const std::string &fileName, QPaintDevice *device);
+
+    //! Deletes every resident shape and forgets the current file.
+    void close();
+
+    //! Gets the index of the open file.
+    const ShapeIndex &getIndex() const {return index;}
+
+    //! Gets a shape, parsing its record if it is not resident.
+    /*! Loading a shape may evict others, which deletes them; a pointer returned earlier stays valid only while its shape is pinned
+     * or until the next call to getShape().
+     * \param shapeId the ID of the shape
+     * \returns The shape, owned by the store, or nullptr if the file has no shape with the ID.
+     */
+    Shape *getShape(int shapeId);
+
+    //! Checks whether a shape is resident.
+    bool isResident(int shapeId) const {return residents.count(shapeId) > 0;}
+
+    //! Pins or unpins a resident shape.
+    /*! \param shapeId the ID of the shape
+     * \param pinned TRUE to keep the shape resident regardless of the memory budget
+     */
+    void setPinned(int shapeId, bool pinned);
+
+    //! Finds the shapes whose bounding boxes intersect a region, without loading any shape.
+    /*! \sa ShapeIndex::query()
+     */
+    std::vector<int> queryRegion(const QRect &region) const {return index.query(region);}
+
+    //! Changes the memory budget and evicts shapes until the resident shapes fit.
+    void setMemoryBudget(std::size_t bytes);
+
+    //! Gets the memory budget in bytes.
+    std::size_t getMemoryBudget() const {return memoryBudget;}
+
+    //! Gets the estimated number of bytes used by resident shapes.
+    std::size_t getResidentBytes() const {return residentBytes;}
+
+    //! Gets the number of resident shapes.
+    int getResidentCount() const {return int(residents.size());}
+
+    //! Gets the number of getShape() calls answered by a resident shape.
+    long long getHitCount() const {return hits;}
+
+    //! Gets the number of records parsed.
+    long long getLoadCount() const {return loads;}
+
+    //! Gets the number of shapes evicted.
+    long long getEvictionCount() const {return evictions;}
+
+    //! Gets the errors found in the records parsed since the file was opened.
+    const ParseReport &getParseReport() const {return parseReport;}
+
+    //! Estimates the bytes a shape occupies, including its heap data.
+    /*! \param p_Shape the pointer to the shape
+     * \returns sizeof() the derived shape, plus dynamic shape dimensions, points, and text.
+     * \sa footprintBytes()
+     */
+    static std::size_t estimateBytes(Shape *p_Shape);
+
+private:
+
+    /*! \struct Resident
+     * \brief A shape held in memory and its place in the recency list.
+     */
+    struct Resident
+    {
+        Shape *p_Shape;                     /*!< the shape, owned by the store */
+        std::size_t bytes;                  /*!< the estimated size of the shape */
+        bool pinned;                        /*!< TRUE if the shape must not be evicted */
+        std::list<int>::iterator position;  /*!< the shape's place in the recency list */
+    };
+
+    //! Parses the record of an indexed shape.
+    /*! \returns The new shape, or nullptr if the record cannot be read or has an error.
+     */
+    Shape *load(const ShapeIndexEntry &entry);
+
+    //! Evicts least recently used shapes until the resident shapes fit in the budget.
+    /*! \param keepId the ID of a shape that must stay resident, or -1
+     */
+    void evict(int keepId);
+
+    std::string fileName;                           /*!< the path of the open shape file */
+    std::ifstream file;                             /*!< the open shape file, in binary mode */
+    QPaintDevice *device;                           /*!< the pointer to the QPaintDevice shapes are created for */
+    Parser parser;                                  /*!< the parser of single records; also caches style lookups */
+    ShapeIndex index;                               /*!< the offset index of the open file */
+    std::string recordBuffer;                       /*!< the bytes of the record being parsed, reused by every load */
+    ParseReport parseReport;                        /*!< the errors found in the records parsed since the file was opened */
+
+    std::unordered_map<int, Resident> residents;    /*!< the resident shapes by shape ID */
+    std::list<int> recency;                         /*!< the IDs of resident shapes, most recently used first */
+    std::size_t memoryBudget;                       /*!< the largest number of bytes resident shapes may use */
+    std::size_t residentBytes;                      /*!< the estimated number of bytes used by resident shapes */
+
+    long long hits;         /*!< the number of getShape() calls answered by a resident shape */
+    long long loads;        /*!< the number of records parsed */
+    long long evictions;    /*!< the number of shapes evicted */
+};
+
+#endif // LAZYSHAPESTORE_H
@@ -1,15 +1,15 @@
 #include "line.h"
-#include <sstream>
+#include "shapewriter.h"
 #include "qtconversions.h"
 
 //! Sets the QPainter object to draw a line according to the Line object's specifications.
-void Line::draw()
+void Line::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawLine(point1, point2);
     painter.setPen(Qt::black);
-    painter.drawText(point1.x(), point1.y(), 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the line.
@@ -18,6 +18,7 @@ void Line::move(const QPoint &shift)
     point1 += shift;
     point2 += shift;
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Calculates and returns the length of the line.
@@ -45,33 +46,10 @@ void Line::setPosition()
     point2 = {shapeDimensions[int(Specifications::X2)], shapeDimensions[int(Specifications::Y2)]};
 }
 
-//! Prints the line specifications as one string to be used in the AllShapes class.
+//! Overrides the serialize function to leave out the brush, which a line does not use.
 /*! \sa AllShapes::printAll() */
-std::string Line::print() const
+void Line::serialize(ShapeWriter &writer) const
 {
-    using std::endl;
-
-    std::ostringstream oss;
-
-    oss << "ShapeId: " << shapeId << endl;
-    oss << "ShapeType: " << shapeType << endl;
-    oss << "ShapeDimensions: ";
-    for(int i = 0; i < numDimensions; ++i)
-    {
-         oss << shapeDimensions[i];
-
-         if(i < numDimensions - 1)
-         {
-             oss << ", ";
-         }
-    }
-    oss << endl;
-
-    oss << "PenColor: " << getColorAsString(pen.color()) << endl;
-    oss << "PenWidth: " << pen.width() << endl;
-    oss << "PenStyle: " << getPenStyleAsString(pen.style()) << endl;
-    oss << "PenCapStyle: " << getCapStyleAsString(pen.capStyle()) << endl;
-    oss << "PenJoinStyle: " << getJoinStyleAsString(pen.joinStyle()) << endl;
-
-    return oss.str();
+    serializeHeader(writer);
+    serializePen(writer);
 }
@@ -19,28 +19,27 @@ const int NUM_LINE_SPECS = 4;
 
 /*! Derived from abstract base class Shape.
  */
-class Line: public Shape
+class Line final : public Shape
 {
 public:
 
     //! Default constructor
     /*! Sets both points of the line to a default location
      */
-    Line() : point1{0,0}, point2{0,0} {}
+    Line() : Shape(ShapeLabels::LINE), point1{0,0}, point2{0,0} {}
 
     //! Alternate constructor
     /*! Passes in all line data to be implemented upon construction.
      * Initializes the line and base class data via a base member initialization list.
      * Sets the QPoint values of the two points on the line.
-     * \sa MainWindow::on_lineSave_clicked()
+     * \sa MainWindow::lineSaveClicked()
      * \sa Line::setPosition()
      * \param shapeId the ID number of the new line
-     * \param shapeType the string representing a line
      * \param numDimensions the number of dimensions a line has
      * \param *shapeDimensions the pointer to the array of line dimensions
      */
-    Line(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-          :Shape(shapeId, shapeType, numDimensions, shapeDimensions)
+    Line(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+          :Shape(shapeId, ShapeLabels::LINE, numDimensions, shapeDimensions)
           {setPosition();}
 
     //! Destructor
@@ -50,8 +49,9 @@ public:
 
     //! Draws the line according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a line.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the line by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a line.
@@ -69,6 +69,12 @@ public:
      */
     dim::area calcArea() const override {return 0;}
 
+    //! Finds the bounding box of the line.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: returns the rectangle spanned by the two points.
+     */
+    QRect calcBoundingBox() const override {return calcVertexBoundingBox();}
+
     //! Updates the shape dimensions array with the current line dimensions.
     /*! This function is called whenever the line is moved to account for shifts in its dimensions.
      * Overrides the virtual function from the base class.
@@ -82,12 +88,13 @@ public:
      */
     void setPosition() override;
 
-    //! Prints the line specifications.
-    /*! Stores the entire set of line specifications as a string to be printed to an output file via the AllShapes class.
+    //! Writes the line specifications.
+    /*! Writes the entire set of line specifications to an output file via the AllShapes class.
      * Overrides the virtual function from the base class.
+     * \param writer the writer that receives the fields
      * \sa AllShapes::printAll()
      */
-    std::string print() const override;
+    void serialize(ShapeWriter &writer) const override;
 
 private:
     QPoint point1;  /*!< the position of the first point in the line */
@@ -1,10 +1,143 @@
 #include "mainwindow.h"
+#include "tracing.h"
 #include <QApplication>
+#include <QImage>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    /*! \struct MemoryReportOptions
+     * \brief The command line settings of the memory report.
+     */
+    struct MemoryReportOptions
+    {
+        bool enabled{false};        /*!< TRUE if --memory-report was given */
+        std::size_t budget{0};      /*!< the memory budget in bytes, or 0 for none */
+        std::string pagedFile;      /*!< a paged shape file to open in the page cache, or empty */
+        bool json{false};           /*!< TRUE to print JSON instead of tables */
+    };
+
+    //! Reads the memory report options; other arguments are left to the application.
+    /*! \returns FALSE if an option is missing its value.
+     */
+    bool readMemoryReportOptions(int argc, char *argv[], MemoryReportOptions &options)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            if(std::strcmp(argv[i], "--memory-report") == 0)
+            {
+                options.enabled = true;
+            }
+            else if(std::strcmp(argv[i], "--json") == 0)
+            {
+                options.json = true;
+            }
+            else if(std::strcmp(argv[i], "--memory-budget") == 0)
+            {
+                if(++i >= argc)
+                {
+                    return false;
+                }
+
+                options.budget = std::size_t(std::strtoull(argv[i], nullptr, 10)) << 20;
+            }
+            else if(std::strcmp(argv[i], "--paged") == 0)
+            {
+                if(++i >= argc)
+                {
+                    return false;
+                }
+
+                options.pagedFile = argv[i];
+            }
+        }
+
+        return true;
+    }
+
+    //! Prints a memory report.
+    void printReport(const MemoryReport &report, bool json)
+    {
+        cout << (json ? report.toJson() : report.toString());
+    }
+
+    //! Loads shapes.txt as the application does, prints its memory report, and enforces the budget if one is given.
+    /*! \returns The exit status: 0, or 1 if the document is over the budget even without its caches.
+     */
+    int runMemoryReport(const MemoryReportOptions &options)
+    {
+        QImage device(1000, 500, QImage::Format_ARGB32_Premultiplied);
+        AllShapes allShapes(&device);
+
+        allShapes.addShapesFromFile();
+
+        /*! Builds the caches the application builds on start up */
+        allShapes.getGeometry();
+        allShapes.getBatches();
+
+        if(!options.pagedFile.empty())
+        {
+            if(!allShapes.getPageCache().open(options.pagedFile, &device))
+            {
+                cerr << "cannot open paged file " << options.pagedFile << endl;
+                return 1;
+            }
+
+            allShapes.getPageCache().setViewport(QRect(0, 0, 1000, 500));
+        }
+
+        if(!options.json)
+        {
+            cout << shapeMemoryReport() << endl;
+        }
+
+        MemoryReport report = allShapes.getMemoryReport();
+        printReport(report, options.json);
+
+        if(options.budget == 0)
+        {
+            return 0;
+        }
+
+        allShapes.setMemoryBudget(options.budget);
+        std::size_t freed = allShapes.enforceMemoryBudget();
+
+        report = allShapes.getMemoryReport();
+
+        if(!options.json)
+        {
+            cout << endl << "After enforcing a budget of " << options.budget << " bytes (" << freed << " bytes freed):" << endl;
+        }
+
+        printReport(report, options.json);
+
+        return report.totalBytes() > options.budget ? 1 : 0;
+    }
+}
 
 int main(int argc, char *argv[])
 {
     /*! \brief Opens the application */
     QApplication a(argc, argv);
+    TRACE_THREAD_NAME("GUI");
+
+    /*! \brief Prints the memory report instead of opening the window when asked to on the command line
+     * Usage: ClassProjv1 --memory-report [--memory-budget MiB] [--paged FILE] [--json]
+     */
+    MemoryReportOptions reportOptions;
+
+    if(!readMemoryReportOptions(argc, argv, reportOptions))
+    {
+        cerr << "usage: " << argv[0] << " --memory-report [--memory-budget MiB] [--paged FILE] [--json]" << endl;
+        return 1;
+    }
+
+    if(reportOptions.enabled)
+    {
+        return runMemoryReport(reportOptions);
+    }
+
     MainWindow w;
     w.show();
 
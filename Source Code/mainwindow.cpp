@@ -1,6 +1,25 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "canvas.h"
+#include "allocationtracker.h"
+#include "perfcounters.h"
+#include "tracing.h"
+#include "ui_addlineform.h"
+#include "ui_addpolylineform.h"
+#include "ui_addpolygonform.h"
+#include "ui_addrectangleform.h"
+#include "ui_addsquareform.h"
+#include "ui_addellipseform.h"
+#include "ui_addcircleform.h"
+#include "ui_addtextform.h"
+#include "ui_editlineform.h"
+#include "ui_editpolylineform.h"
+#include "ui_editpolygonform.h"
+#include "ui_editrectangleform.h"
+#include "ui_editsquareform.h"
+#include "ui_editellipseform.h"
+#include "ui_editcircleform.h"
+#include "ui_edittextform.h"
 #include <QMessageBox>
 #include <QtWidgets>
 #include <QTableWidget>
@@ -11,13 +30,106 @@ MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow),
     allShapes(ui->renderArea),
-    accessLevel{NONE}
+    accessLevel{NONE},
+    skippedRecordsConfirmed{false}
 {
-    // FILE IO - Populates allShape's shape vector from file backup
-    allShapes.addShapesFromFile();
+    TRACE_SCOPE("ui", "MainWindow");
+
     // UI - Sets up
-    ui->setupUi(this);
-    ui -> renderArea -> getShapes(allShapes.getVector());
+    {
+        StartupTimer::Phase phase(startup, "setupUi", "GUI");
+        ui->setupUi(this);
+    }
+
+    StartupTimer::Phase widgetsPhase(startup, "initialize widgets", "GUI");
+
+    ui -> renderArea -> setPageCache(&allShapes.getPageCache());
+
+    // FORMS - Each add and edit form is built into its page the first time it is used, and its buttons are connected then
+    addLineForm.setPage(ui -> addLine, [this](Ui::AddLineForm *form)
+    {
+        connect(form -> lineSave, &QPushButton::clicked, this, &MainWindow::lineSaveClicked);
+        connect(form -> lineCancel, &QPushButton::clicked, this, &MainWindow::lineCancelClicked);
+    });
+    addPolylineForm.setPage(ui -> addPolyline, [this](Ui::AddPolylineForm *form)
+    {
+        connect(form -> polylineSave, &QPushButton::clicked, this, &MainWindow::polylineSaveClicked);
+        connect(form -> polylineCancel, &QPushButton::clicked, this, &MainWindow::polylineCancelClicked);
+        connect(form -> addPolylineNumPoints, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::addPolylineNumPointsChanged);
+    });
+    addPolygonForm.setPage(ui -> addPolygon, [this](Ui::AddPolygonForm *form)
+    {
+        connect(form -> polygonSave, &QPushButton::clicked, this, &MainWindow::polygonSaveClicked);
+        connect(form -> polygonCancel, &QPushButton::clicked, this, &MainWindow::polygonCancelClicked);
+        connect(form -> addPolygonNumPoints, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::addPolygonNumPointsChanged);
+    });
+    addRectangleForm.setPage(ui -> addRectangle, [this](Ui::AddRectangleForm *form)
+    {
+        connect(form -> rectangleSave, &QPushButton::clicked, this, &MainWindow::rectangleSaveClicked);
+        connect(form -> rectangleCancel, &QPushButton::clicked, this, &MainWindow::rectangleCancelClicked);
+    });
+    addSquareForm.setPage(ui -> addSquare, [this](Ui::AddSquareForm *form)
+    {
+        connect(form -> squareSave, &QPushButton::clicked, this, &MainWindow::squareSaveClicked);
+        connect(form -> squareCancel, &QPushButton::clicked, this, &MainWindow::squareCancelClicked);
+    });
+    addEllipseForm.setPage(ui -> addEllipse, [this](Ui::AddEllipseForm *form)
+    {
+        connect(form -> ellipseSave, &QPushButton::clicked, this, &MainWindow::ellipseSaveClicked);
+        connect(form -> ellipseCancel, &QPushButton::clicked, this, &MainWindow::ellipseCancelClicked);
+    });
+    addCircleForm.setPage(ui -> addCircle, [this](Ui::AddCircleForm *form)
+    {
+        connect(form -> circleSave, &QPushButton::clicked, this, &MainWindow::circleSaveClicked);
+        connect(form -> circleCancel, &QPushButton::clicked, this, &MainWindow::circleCancelClicked);
+    });
+    addTextForm.setPage(ui -> addText, [this](Ui::AddTextForm *form)
+    {
+        connect(form -> textSave, &QPushButton::clicked, this, &MainWindow::textSaveClicked);
+        connect(form -> textCancel, &QPushButton::clicked, this, &MainWindow::textCancelClicked);
+    });
+    editLineForm.setPage(ui -> editLine, [this](Ui::EditLineForm *form)
+    {
+        connect(form -> editLineSave, &QPushButton::clicked, this, &MainWindow::editLineSaveClicked);
+        connect(form -> editLineCancel, &QPushButton::clicked, this, &MainWindow::editLineCancelClicked);
+    });
+    editPolylineForm.setPage(ui -> editPolyline, [this](Ui::EditPolylineForm *form)
+    {
+        connect(form -> editPolylineSave, &QPushButton::clicked, this, &MainWindow::editPolylineSaveClicked);
+        connect(form -> editPolylineCancel, &QPushButton::clicked, this, &MainWindow::editPolylineCancelClicked);
+        connect(form -> editPolylineNumPoints, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::editPolylineNumPointsChanged);
+    });
+    editPolygonForm.setPage(ui -> editPolygon, [this](Ui::EditPolygonForm *form)
+    {
+        connect(form -> editPolygonSave, &QPushButton::clicked, this, &MainWindow::editPolygonSaveClicked);
+        connect(form -> editPolygonCancel, &QPushButton::clicked, this, &MainWindow::editPolygonCancelClicked);
+        connect(form -> editPolygonNumPoints, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::editPolygonNumPointsChanged);
+    });
+    editRectangleForm.setPage(ui -> editRectangle, [this](Ui::EditRectangleForm *form)
+    {
+        connect(form -> editRectangleSave, &QPushButton::clicked, this, &MainWindow::editRectangleSaveClicked);
+        connect(form -> editRectangleCancel, &QPushButton::clicked, this, &MainWindow::editRectangleCancelClicked);
+    });
+    editSquareForm.setPage(ui -> editSquare, [this](Ui::EditSquareForm *form)
+    {
+        connect(form -> editSquareSave, &QPushButton::clicked, this, &MainWindow::editSquareSaveClicked);
+        connect(form -> editSquareCancel, &QPushButton::clicked, this, &MainWindow::editSquareCancelClicked);
+    });
+    editEllipseForm.setPage(ui -> editEllipse, [this](Ui::EditEllipseForm *form)
+    {
+        connect(form -> editEllipseSave, &QPushButton::clicked, this, &MainWindow::editEllipseSaveClicked);
+        connect(form -> editEllipseCancel, &QPushButton::clicked, this, &MainWindow::editEllipseCancelClicked);
+    });
+    editCircleForm.setPage(ui -> editCircle, [this](Ui::EditCircleForm *form)
+    {
+        connect(form -> editCircleSave, &QPushButton::clicked, this, &MainWindow::editCircleSaveClicked);
+        connect(form -> editCircleCancel, &QPushButton::clicked, this, &MainWindow::editCircleCancelClicked);
+    });
+    editTextForm.setPage(ui -> editText, [this](Ui::EditTextForm *form)
+    {
+        connect(form -> editTextSave, &QPushButton::clicked, this, &MainWindow::editTextSaveClicked);
+        connect(form -> editTextCancel, &QPushButton::clicked, this, &MainWindow::editTextCancelClicked);
+    });
     ui -> contactUs -> hide();
     ui->menuBar->hide();
     ui -> loginWindow -> show();
@@ -34,351 +146,614 @@ MainWindow::MainWindow(QWidget *parent) :
     ui -> xShiftBox -> setEnabled(false);
     ui -> yShiftBox -> setEnabled(false);
 
+    // ID SELECTORS - Both view the shared ID model, and type-ahead filters it by the digits entered
+    for(QComboBox *idBox : {ui -> editShapeID, ui -> deleteShapeID})
+    {
+        idBox -> setModel(&shapeIds);
+        idBox -> setEditable(true);
+        idBox -> setInsertPolicy(QComboBox::NoInsert);
+        idBox -> setSizeAdjustPolicy(QComboBox::AdjustToMinimumContentsLengthWithIcon);
+        idBox -> setMinimumContentsLength(8);
+        idBox -> completer() -> setCompletionMode(QCompleter::PopupCompletion);
+    }
+
+    // UNDO AND REDO - Every add, edit, move, and delete, and every undo and redo of one, keeps the ID model and the actions in step
+    allShapes.setObserver([this](const ShapeChange &change)
+    {
+        if(change.kind == ShapeChange::ADDED)
+        {
+            shapeIds.insertId(change.shapeId);
+        }
+        else if(change.kind == ShapeChange::REMOVED)
+        {
+            shapeIds.removeId(change.shapeId);
+        }
+
+        updateUndoActions();
+    });
+    updateUndoActions();
+
     on_addShapeType_currentIndexChanged("--");
 
-    ui -> editShapeID -> addItems(set_getShapeIds());
-    ui -> deleteShapeID -> addItems(set_getShapeIds());
+    // Logging in is enabled once the shapes are loaded, since every form and table depends on them
+    ui -> pushButton_Login -> setEnabled(false);
+    ui -> statusBar -> showMessage("Loading shapes...");
 
-    updateShapeTables();
+    // FILE IO - Populates allShape's shape vector from file backup on the loader thread, while the window is shown
+    loader = std::thread([this]()
+    {
+        TRACE_THREAD_NAME("Loader");
+
+        {
+            StartupTimer::Phase phase(startup, "parse shapes", "loader");
+            allShapes.addShapesFromFile();
+        }
+
+        {
+            StartupTimer::Phase phase(startup, "build caches", "loader");
+            allShapes.buildCaches();
+        }
+
+        QMetaObject::invokeMethod(this, [this]() {shapesLoaded();}, Qt::QueuedConnection);
+    });
+
+#ifdef SHAPE_PERF_COUNTERS
+    createPerformanceMenu();
+#endif
+
+#ifdef SHAPE_TRACING
+    createTraceMenu();
+#endif
 
+#ifdef SHAPE_ALLOC_TRACKING
+    createAllocationMenu();
+#endif
 }
 
 //! Destructor
 MainWindow::~MainWindow()
 {
+    if(loader.joinable())
+    {
+        loader.join();
+    }
+
     delete ui;
 }
 
+//! Fills the widgets that depend on the shapes once they are loaded.
+void MainWindow::shapesLoaded()
+{
+    TRACE_SCOPE("ui", __func__);
+
+    loader.join();
+
+    ui -> renderArea -> getShapes(allShapes.getVector());
+
+    {
+        StartupTimer::Phase phase(startup, "fill shape ID model", "GUI");
+        shapeIds.setIds(allShapes.getVector());
+    }
+
+    {
+        StartupTimer::Phase phase(startup, "fill shape tables", "GUI");
+        updateShapeTables();
+    }
+
+    ui -> pushButton_Login -> setEnabled(true);
+
+    const ParseReport &report = allShapes.getParseReport();
+
+    if(report.isClean())
+    {
+        ui -> statusBar -> showMessage(QString("Loaded %1 shapes in %2 ms").arg(allShapes.getShapeCount()).arg(int(startup.elapsedMilliseconds())), 5000);
+    }
+    else
+    {
+        ui -> statusBar -> showMessage(QString("Loaded %1 shapes in %2 ms; %3 records skipped").arg(allShapes.getShapeCount())
+                                           .arg(int(startup.elapsedMilliseconds())).arg(report.recordsSkipped));
+
+        /*! The first few errors are listed in the box; the full report is in its details */
+        const int SHOWN_ERRORS = 5;
+        QString errors;
+
+        for(int i = 0; i < int(report.errors.size()) && i < SHOWN_ERRORS; ++i)
+        {
+            const ParseError &error = report.errors[i];
+
+            errors += QString("line %1, column %2 (%3): %4\n").arg(error.line).arg(error.column)
+                          .arg(QString::fromStdString(error.field)).arg(QString::fromStdString(error.message));
+        }
+
+        QMessageBox box(QMessageBox::Warning, "Shapes File Errors",
+                        QString("%1 records of shapes.txt could not be read and were skipped. Saving will rewrite the file without them.")
+                            .arg(report.recordsSkipped), QMessageBox::Ok, this);
+        box.setInformativeText(errors);
+        box.setDetailedText(QString::fromStdString(report.toString()));
+        box.exec();
+    }
+
+#ifdef SHAPE_PERF_COUNTERS
+    cout << startup.toString();
+#endif
+}
+
+#ifdef SHAPE_PERF_COUNTERS
+//! Adds the performance menu.
+void MainWindow::createPerformanceMenu()
+{
+    QMenu *menuPerformance = ui -> menuBar -> addMenu("Performance");
+
+    QAction *actionShowOverlay = menuPerformance -> addAction("Show Overlay");
+    actionShowOverlay -> setCheckable(true);
+    connect(actionShowOverlay, &QAction::toggled, this, [this](bool checked)
+    {
+        ui -> renderArea -> setHudVisible(checked);
+    });
+
+    connect(menuPerformance -> addAction("Save Counters as JSON"), &QAction::triggered, this, [this]()
+    {
+        std::ofstream out("perfcounters.json", std::ios::out | std::ios::trunc);
+        out << perf::toJson();
+        out.close();
+
+        if(out)
+        {
+            QMessageBox::information(this, "Counters Saved", "Performance counters saved to perfcounters.json", QMessageBox::Ok);
+        }
+        else
+        {
+            QMessageBox::warning(this, "Save Failed", "Could not write perfcounters.json", QMessageBox::Ok);
+        }
+    });
+
+    connect(menuPerformance -> addAction("Reset Counters"), &QAction::triggered, this, [this]()
+    {
+        perf::reset();
+        ui -> renderArea -> update();
+    });
+}
+#endif
+
+#ifdef SHAPE_ALLOC_TRACKING
+//! Adds the allocation menu.
+void MainWindow::createAllocationMenu()
+{
+    QMenu *menuAllocations = ui -> menuBar -> addMenu("Allocations");
+
+    connect(menuAllocations -> addAction("Save Allocation Counts as JSON"), &QAction::triggered, this, [this]()
+    {
+        std::ofstream out("allocations.json", std::ios::out | std::ios::trunc);
+        out << alloc::toJson();
+        out.close();
+
+        if(out)
+        {
+            QMessageBox::information(this, "Counts Saved", "Allocation counts saved to allocations.json", QMessageBox::Ok);
+        }
+        else
+        {
+            QMessageBox::warning(this, "Save Failed", "Could not write allocations.json", QMessageBox::Ok);
+        }
+    });
+
+    connect(menuAllocations -> addAction("Reset Allocation Counts"), &QAction::triggered, this, []()
+    {
+        alloc::reset();
+    });
+}
+#endif
+
+#ifdef SHAPE_TRACING
+//! Adds the trace menu.
+void MainWindow::createTraceMenu()
+{
+    QMenu *menuTrace = ui -> menuBar -> addMenu("Trace");
+
+    connect(menuTrace -> addAction("Export Chrome Trace"), &QAction::triggered, this, [this]()
+    {
+        int spans = trace::exportChromeTrace("trace.json");
+
+        if(spans >= 0)
+        {
+            QMessageBox::information(this, "Trace Exported", QString("%1 spans saved to trace.json").arg(spans), QMessageBox::Ok);
+        }
+        else
+        {
+            QMessageBox::warning(this, "Export Failed", "Could not write trace.json", QMessageBox::Ok);
+        }
+    });
+
+    connect(menuTrace -> addAction("Clear Trace"), &QAction::triggered, this, []()
+    {
+        trace::clear();
+    });
+}
+#endif
+
 //! Sorts and updates shape tables
 void MainWindow::updateShapeTables()
 {
+    TRACE_SCOPE("tables", __func__);
+    PERF_SCOPE(UPDATE_SHAPE_TABLES);
+    ALLOC_SCOPE(SORT);
+
+#ifdef SHAPE_PERF_COUNTERS
+    Shape::resetMetricsCacheCounters();
+#endif
+
     ui -> shapeIDTable->setRowCount(allShapes.getShapeCount());
     sortIDTable();
     ui ->areaTable -> setRowCount(allShapes.getShapeCount());
     sortAreaTable();
     ui -> perimeterTable -> setRowCount(allShapes.getShapeCount());
     sortPerimeterTable();
+
+#ifdef SHAPE_PERF_COUNTERS
+    /*! Counts how many perimeter and area lookups of this refresh were answered from the shape metrics caches */
+    PERF_COUNT(METRICS_CACHE_HITS, Shape::getMetricsCacheHits());
+    PERF_COUNT(METRICS_CACHE_MISSES, Shape::getMetricsCacheMisses());
+#endif
 }
 
 //! Sorts the Shape vector by ID and fills ID table
 void MainWindow::sortIDTable()
 {
+    TRACE_SCOPE("tables", __func__);
+    PERF_SCOPE(SORT_ID_TABLE);
+    ALLOC_SCOPE(SORT);
+
     myVector::vector<Shape *>::iterator begin = allShapes.getVector().begin();
     myVector::vector<Shape *>::iterator end = allShapes.getVector().end();
 
     selectionSort(begin, end, idCompare);
 
     myVector::vector<Shape *> sortedVector = allShapes.getVector();
+    const GeometryStore &geometry = allShapes.getGeometry();
 
     for(int i = 0; i < allShapes.getVector().size(); ++i)
     {
         ui->shapeIDTable->setItem(i, TYPE, new QTableWidgetItem(QString::fromStdString((sortedVector[i]->getType()))));
         ui->shapeIDTable->setItem(i, ID, new QTableWidgetItem(QString::number(sortedVector[i]->getID())));
-        ui->shapeIDTable->setItem(i, PERIMETER, new QTableWidgetItem(QString::number(int(sortedVector[i]->calcPerimeter()))));
-        ui->shapeIDTable->setItem(i, AREA, new QTableWidgetItem(QString::number(int(sortedVector[i]->calcArea()))));
+        ui->shapeIDTable->setItem(i, PERIMETER, new QTableWidgetItem(QString::number(int(geometry.getPerimeter(sortedVector[i]->getID())))));
+        ui->shapeIDTable->setItem(i, AREA, new QTableWidgetItem(QString::number(int(geometry.getArea(sortedVector[i]->getID())))));
     }
 }
 
 //! Sorts the Shape vector by perimeter and fills perimeter table
 void MainWindow::sortPerimeterTable()
 {
+    TRACE_SCOPE("tables", __func__);
+    PERF_SCOPE(SORT_PERIMETER_TABLE);
+    ALLOC_SCOPE(SORT);
+
     myVector::vector<Shape *>::iterator begin = allShapes.getVector().begin();
     myVector::vector<Shape *>::iterator end = allShapes.getVector().end();
 
     selectionSort(begin, end, perimeterCompare);
 
     myVector::vector<Shape *> sortedVector = allShapes.getVector();
+    const GeometryStore &geometry = allShapes.getGeometry();
 
     for(int i = 0; i < allShapes.getVector().size(); ++i)
     {
         ui->perimeterTable->setItem(i, TYPE, new QTableWidgetItem(QString::fromStdString((sortedVector[i]->getType()))));
         ui->perimeterTable->setItem(i, ID, new QTableWidgetItem(QString::number(sortedVector[i]->getID())));
-        ui->perimeterTable->setItem(i, PERIMETER, new QTableWidgetItem(QString::number(int(sortedVector[i]->calcPerimeter()))));
+        ui->perimeterTable->setItem(i, PERIMETER, new QTableWidgetItem(QString::number(int(geometry.getPerimeter(sortedVector[i]->getID())))));
     }
 }
 
 //! Sorts the Shape vector by area and fills area table
 void MainWindow::sortAreaTable()
 {
+    TRACE_SCOPE("tables", __func__);
+    PERF_SCOPE(SORT_AREA_TABLE);
+    ALLOC_SCOPE(SORT);
+
     myVector::vector<Shape *>::iterator begin = allShapes.getVector().begin();
     myVector::vector<Shape *>::iterator end = allShapes.getVector().end();
 
     selectionSort(begin, end, areaCompare);
 
     myVector::vector<Shape *> sortedVector = allShapes.getVector();
+    const GeometryStore &geometry = allShapes.getGeometry();
 
     for(int i = 0; i < allShapes.getVector().size(); ++i)
     {
         ui->areaTable->setItem(i, TYPE, new QTableWidgetItem(QString::fromStdString((sortedVector[i]->getType()))));
         ui->areaTable->setItem(i, ID, new QTableWidgetItem(QString::number(sortedVector[i]->getID())));
-        ui->areaTable->setItem(i, (AREA-1), new QTableWidgetItem(QString::number(int(sortedVector[i]->calcArea()))));
+        ui->areaTable->setItem(i, (AREA-1), new QTableWidgetItem(QString::number(int(geometry.getArea(sortedVector[i]->getID())))));
     }
 }
 
 //! Disables add polyline spin boxes until number of polyline points is set
 void MainWindow::disablePolylineSpinBoxes()
 {
-    ui -> addPolylinex1 -> setEnabled(false);
-    ui -> addPolyliney1 -> setEnabled(false);
-    ui -> addPolylinex2 -> setEnabled(false);
-    ui -> addPolyliney2 -> setEnabled(false);
-    ui -> addPolylinex3 -> setEnabled(false);
-    ui -> addPolyliney3 -> setEnabled(false);
-    ui -> addPolylinex4 -> setEnabled(false);
-    ui -> addPolyliney4 -> setEnabled(false);
-    ui -> addPolylinex5 -> setEnabled(false);
-    ui -> addPolyliney5 -> setEnabled(false);
-    ui -> addPolylinex6 -> setEnabled(false);
-    ui -> addPolyliney6 -> setEnabled(false);
-    ui -> addPolylinex7 -> setEnabled(false);
-    ui -> addPolyliney7 -> setEnabled(false);
-    ui -> addPolylinex8 -> setEnabled(false);
-    ui -> addPolyliney8 -> setEnabled(false);
-    ui -> addPolylinex9 -> setEnabled(false);
-    ui -> addPolyliney9 -> setEnabled(false);
-    ui -> addPolylinex10 -> setEnabled(false);
-    ui -> addPolyliney10 -> setEnabled(false);
+    addPolylineForm -> addPolylinex1 -> setEnabled(false);
+    addPolylineForm -> addPolyliney1 -> setEnabled(false);
+    addPolylineForm -> addPolylinex2 -> setEnabled(false);
+    addPolylineForm -> addPolyliney2 -> setEnabled(false);
+    addPolylineForm -> addPolylinex3 -> setEnabled(false);
+    addPolylineForm -> addPolyliney3 -> setEnabled(false);
+    addPolylineForm -> addPolylinex4 -> setEnabled(false);
+    addPolylineForm -> addPolyliney4 -> setEnabled(false);
+    addPolylineForm -> addPolylinex5 -> setEnabled(false);
+    addPolylineForm -> addPolyliney5 -> setEnabled(false);
+    addPolylineForm -> addPolylinex6 -> setEnabled(false);
+    addPolylineForm -> addPolyliney6 -> setEnabled(false);
+    addPolylineForm -> addPolylinex7 -> setEnabled(false);
+    addPolylineForm -> addPolyliney7 -> setEnabled(false);
+    addPolylineForm -> addPolylinex8 -> setEnabled(false);
+    addPolylineForm -> addPolyliney8 -> setEnabled(false);
+    addPolylineForm -> addPolylinex9 -> setEnabled(false);
+    addPolylineForm -> addPolyliney9 -> setEnabled(false);
+    addPolylineForm -> addPolylinex10 -> setEnabled(false);
+    addPolylineForm -> addPolyliney10 -> setEnabled(false);
 }
 
 //! Disables edit polyline spin boxes until number of polyline points is set
 void MainWindow::disableEditPolylineSpinBoxes()
 {
-    ui -> editPolylinex1 -> setEnabled(false);
-    ui -> editPolyliney1 -> setEnabled(false);
-    ui -> editPolylinex2 -> setEnabled(false);
-    ui -> editPolyliney2 -> setEnabled(false);
-    ui -> editPolylinex3 -> setEnabled(false);
-    ui -> editPolyliney3 -> setEnabled(false);
-    ui -> editPolylinex4 -> setEnabled(false);
-    ui -> editPolyliney4 -> setEnabled(false);
-    ui -> editPolylinex5 -> setEnabled(false);
-    ui -> editPolyliney5 -> setEnabled(false);
-    ui -> editPolylinex6 -> setEnabled(false);
-    ui -> editPolyliney6 -> setEnabled(false);
-    ui -> editPolylinex7 -> setEnabled(false);
-    ui -> editPolyliney7 -> setEnabled(false);
-    ui -> editPolylinex8 -> setEnabled(false);
-    ui -> editPolyliney8 -> setEnabled(false);
-    ui -> editPolylinex9 -> setEnabled(false);
-    ui -> editPolyliney9 -> setEnabled(false);
-    ui -> editPolylinex10 -> setEnabled(false);
-    ui -> editPolyliney10 -> setEnabled(false);
+    editPolylineForm -> editPolylinex1 -> setEnabled(false);
+    editPolylineForm -> editPolyliney1 -> setEnabled(false);
+    editPolylineForm -> editPolylinex2 -> setEnabled(false);
+    editPolylineForm -> editPolyliney2 -> setEnabled(false);
+    editPolylineForm -> editPolylinex3 -> setEnabled(false);
+    editPolylineForm -> editPolyliney3 -> setEnabled(false);
+    editPolylineForm -> editPolylinex4 -> setEnabled(false);
+    editPolylineForm -> editPolyliney4 -> setEnabled(false);
+    editPolylineForm -> editPolylinex5 -> setEnabled(false);
+    editPolylineForm -> editPolyliney5 -> setEnabled(false);
+    editPolylineForm -> editPolylinex6 -> setEnabled(false);
+    editPolylineForm -> editPolyliney6 -> setEnabled(false);
+    editPolylineForm -> editPolylinex7 -> setEnabled(false);
+    editPolylineForm -> editPolyliney7 -> setEnabled(false);
+    editPolylineForm -> editPolylinex8 -> setEnabled(false);
+    editPolylineForm -> editPolyliney8 -> setEnabled(false);
+    editPolylineForm -> editPolylinex9 -> setEnabled(false);
+    editPolylineForm -> editPolyliney9 -> setEnabled(false);
+    editPolylineForm -> editPolylinex10 -> setEnabled(false);
+    editPolylineForm -> editPolyliney10 -> setEnabled(false);
 }
 
 //! Disables add polygon spin boxes until number of polygon points is set
 void MainWindow::disablePolygonSpinBoxes()
 {
-    ui -> addPolygonx1 -> setEnabled(false);
-    ui -> addPolygony1 -> setEnabled(false);
-    ui -> addPolygonx2 -> setEnabled(false);
-    ui -> addPolygony2 -> setEnabled(false);
-    ui -> addPolygonx3 -> setEnabled(false);
-    ui -> addPolygony3 -> setEnabled(false);
-    ui -> addPolygonx4 -> setEnabled(false);
-    ui -> addPolygony4 -> setEnabled(false);
-    ui -> addPolygonx5 -> setEnabled(false);
-    ui -> addPolygony5 -> setEnabled(false);
-    ui -> addPolygonx6 -> setEnabled(false);
-    ui -> addPolygony6 -> setEnabled(false);
-    ui -> addPolygonx7 -> setEnabled(false);
-    ui -> addPolygony7 -> setEnabled(false);
-    ui -> addPolygonx8 -> setEnabled(false);
-    ui -> addPolygony8 -> setEnabled(false);
-    ui -> addPolygonx9 -> setEnabled(false);
-    ui -> addPolygony9 -> setEnabled(false);
-    ui -> addPolygonx10 -> setEnabled(false);
-    ui -> addPolygony10 -> setEnabled(false);
+    addPolygonForm -> addPolygonx1 -> setEnabled(false);
+    addPolygonForm -> addPolygony1 -> setEnabled(false);
+    addPolygonForm -> addPolygonx2 -> setEnabled(false);
+    addPolygonForm -> addPolygony2 -> setEnabled(false);
+    addPolygonForm -> addPolygonx3 -> setEnabled(false);
+    addPolygonForm -> addPolygony3 -> setEnabled(false);
+    addPolygonForm -> addPolygonx4 -> setEnabled(false);
+    addPolygonForm -> addPolygony4 -> setEnabled(false);
+    addPolygonForm -> addPolygonx5 -> setEnabled(false);
+    addPolygonForm -> addPolygony5 -> setEnabled(false);
+    addPolygonForm -> addPolygonx6 -> setEnabled(false);
+    addPolygonForm -> addPolygony6 -> setEnabled(false);
+    addPolygonForm -> addPolygonx7 -> setEnabled(false);
+    addPolygonForm -> addPolygony7 -> setEnabled(false);
+    addPolygonForm -> addPolygonx8 -> setEnabled(false);
+    addPolygonForm -> addPolygony8 -> setEnabled(false);
+    addPolygonForm -> addPolygonx9 -> setEnabled(false);
+    addPolygonForm -> addPolygony9 -> setEnabled(false);
+    addPolygonForm -> addPolygonx10 -> setEnabled(false);
+    addPolygonForm -> addPolygony10 -> setEnabled(false);
 }
 
 //! Disables edit polygon spin boxes until number of polygon points is set
 void MainWindow::disableEditPolygonSpinBoxes()
 {
-    ui -> editPolygonx1 -> setEnabled(false);
-    ui -> editPolygony1 -> setEnabled(false);
-    ui -> editPolygonx2 -> setEnabled(false);
-    ui -> editPolygony2 -> setEnabled(false);
-    ui -> editPolygonx3 -> setEnabled(false);
-    ui -> editPolygony3 -> setEnabled(false);
-    ui -> editPolygonx4 -> setEnabled(false);
-    ui -> editPolygony4 -> setEnabled(false);
-    ui -> editPolygonx5 -> setEnabled(false);
-    ui -> editPolygony5 -> setEnabled(false);
-    ui -> editPolygonx6 -> setEnabled(false);
-    ui -> editPolygony6 -> setEnabled(false);
-    ui -> editPolygonx7 -> setEnabled(false);
-    ui -> editPolygony7 -> setEnabled(false);
-    ui -> editPolygonx8 -> setEnabled(false);
-    ui -> editPolygony8 -> setEnabled(false);
-    ui -> editPolygonx9 -> setEnabled(false);
-    ui -> editPolygony9 -> setEnabled(false);
-    ui -> editPolygonx10 -> setEnabled(false);
-    ui -> editPolygony10 -> setEnabled(false);
+    editPolygonForm -> editPolygonx1 -> setEnabled(false);
+    editPolygonForm -> editPolygony1 -> setEnabled(false);
+    editPolygonForm -> editPolygonx2 -> setEnabled(false);
+    editPolygonForm -> editPolygony2 -> setEnabled(false);
+    editPolygonForm -> editPolygonx3 -> setEnabled(false);
+    editPolygonForm -> editPolygony3 -> setEnabled(false);
+    editPolygonForm -> editPolygonx4 -> setEnabled(false);
+    editPolygonForm -> editPolygony4 -> setEnabled(false);
+    editPolygonForm -> editPolygonx5 -> setEnabled(false);
+    editPolygonForm -> editPolygony5 -> setEnabled(false);
+    editPolygonForm -> editPolygonx6 -> setEnabled(false);
+    editPolygonForm -> editPolygony6 -> setEnabled(false);
+    editPolygonForm -> editPolygonx7 -> setEnabled(false);
+    editPolygonForm -> editPolygony7 -> setEnabled(false);
+    editPolygonForm -> editPolygonx8 -> setEnabled(false);
+    editPolygonForm -> editPolygony8 -> setEnabled(false);
+    editPolygonForm -> editPolygonx9 -> setEnabled(false);
+    editPolygonForm -> editPolygony9 -> setEnabled(false);
+    editPolygonForm -> editPolygonx10 -> setEnabled(false);
+    editPolygonForm -> editPolygony10 -> setEnabled(false);
 }
 
 //! Resets add line form specifications
 void MainWindow::clearAddLine()
 {
-    ui -> addLinex1 -> setValue(0);
-    ui -> addLiney1 -> setValue(0);
-    ui -> addLinex2 -> setValue(0);
-    ui -> addLiney2 -> setValue(0);
-    ui -> addLinePenColor -> setCurrentIndex(0);
-    ui -> addLinePenWidth -> setValue(0);
-    ui -> addLinePenStyle -> setCurrentIndex(0);
-    ui -> addLineCapStyle -> setCurrentIndex(0);
-    ui -> addLineJoinStyle -> setCurrentIndex(0);
+    if(addLineForm.isBuilt())
+    {
+        addLineForm -> addLinex1 -> setValue(0);
+        addLineForm -> addLiney1 -> setValue(0);
+        addLineForm -> addLinex2 -> setValue(0);
+        addLineForm -> addLiney2 -> setValue(0);
+        addLineForm -> addLinePenColor -> setCurrentIndex(0);
+        addLineForm -> addLinePenWidth -> setValue(0);
+        addLineForm -> addLinePenStyle -> setCurrentIndex(0);
+        addLineForm -> addLineCapStyle -> setCurrentIndex(0);
+        addLineForm -> addLineJoinStyle -> setCurrentIndex(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add polyline form specifications
 void MainWindow::clearAddPolyline()
 {
-    ui -> addPolylineNumPoints -> setCurrentIndex(0);
-    ui -> addPolylinePenColor -> setCurrentIndex(0);
-    ui -> addPolylinePenWidth -> setValue(0);
-    ui -> addPolylinePenStyle -> setCurrentIndex(0);
-    ui -> addPolylineCapStyle -> setCurrentIndex(0);
-    ui -> addPolylineJoinStyle -> setCurrentIndex(0);
-    ui -> addPolylinex1 -> setValue(0);
-    ui -> addPolyliney1 -> setValue(0);
-    ui -> addPolylinex2 -> setValue(0);
-    ui -> addPolyliney2 -> setValue(0);
-    ui -> addPolylinex3 -> setValue(0);
-    ui -> addPolyliney3 -> setValue(0);
-    ui -> addPolylinex4 -> setValue(0);
-    ui -> addPolyliney4 -> setValue(0);
-    ui -> addPolylinex5 -> setValue(0);
-    ui -> addPolyliney5 -> setValue(0);
-    ui -> addPolylinex6 -> setValue(0);
-    ui -> addPolyliney6 -> setValue(0);
-    ui -> addPolylinex7 -> setValue(0);
-    ui -> addPolyliney7 -> setValue(0);
-    ui -> addPolylinex8 -> setValue(0);
-    ui -> addPolyliney8 -> setValue(0);
-    ui -> addPolylinex9 -> setValue(0);
-    ui -> addPolyliney9 -> setValue(0);
-    ui -> addPolylinex10 -> setValue(0);
-    ui -> addPolyliney10 -> setValue(0);
+    if(addPolylineForm.isBuilt())
+    {
+        addPolylineForm -> addPolylineNumPoints -> setCurrentIndex(0);
+        addPolylineForm -> addPolylinePenColor -> setCurrentIndex(0);
+        addPolylineForm -> addPolylinePenWidth -> setValue(0);
+        addPolylineForm -> addPolylinePenStyle -> setCurrentIndex(0);
+        addPolylineForm -> addPolylineCapStyle -> setCurrentIndex(0);
+        addPolylineForm -> addPolylineJoinStyle -> setCurrentIndex(0);
+        addPolylineForm -> addPolylinex1 -> setValue(0);
+        addPolylineForm -> addPolyliney1 -> setValue(0);
+        addPolylineForm -> addPolylinex2 -> setValue(0);
+        addPolylineForm -> addPolyliney2 -> setValue(0);
+        addPolylineForm -> addPolylinex3 -> setValue(0);
+        addPolylineForm -> addPolyliney3 -> setValue(0);
+        addPolylineForm -> addPolylinex4 -> setValue(0);
+        addPolylineForm -> addPolyliney4 -> setValue(0);
+        addPolylineForm -> addPolylinex5 -> setValue(0);
+        addPolylineForm -> addPolyliney5 -> setValue(0);
+        addPolylineForm -> addPolylinex6 -> setValue(0);
+        addPolylineForm -> addPolyliney6 -> setValue(0);
+        addPolylineForm -> addPolylinex7 -> setValue(0);
+        addPolylineForm -> addPolyliney7 -> setValue(0);
+        addPolylineForm -> addPolylinex8 -> setValue(0);
+        addPolylineForm -> addPolyliney8 -> setValue(0);
+        addPolylineForm -> addPolylinex9 -> setValue(0);
+        addPolylineForm -> addPolyliney9 -> setValue(0);
+        addPolylineForm -> addPolylinex10 -> setValue(0);
+        addPolylineForm -> addPolyliney10 -> setValue(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add polygon form specifications
 void MainWindow::clearAddPolygon()
 {
-    ui -> addPolygonNumPoints -> setCurrentIndex(0);
-    ui -> addPolygonPenColor -> setCurrentIndex(0);
-    ui -> addPolygonPenWidth -> setValue(0);
-    ui -> addPolygonPenStyle ->setCurrentIndex(0);
-    ui -> addPolygonCapStyle -> setCurrentIndex(0);
-    ui -> addPolygonJoinStyle -> setCurrentIndex(0);
-    ui -> addPolygonBrushColor ->setCurrentIndex(0);
-    ui -> addPolygonBrushStyle -> setCurrentIndex(0);
-    ui -> addPolygonx1 -> setValue(0);
-    ui -> addPolygony1 -> setValue(0);
-    ui -> addPolygonx2 -> setValue(0);
-    ui -> addPolygony2 -> setValue(0);
-    ui -> addPolygonx3 -> setValue(0);
-    ui -> addPolygony3 -> setValue(0);
-    ui -> addPolygonx4 -> setValue(0);
-    ui -> addPolygony4 -> setValue(0);
-    ui -> addPolygonx5 -> setValue(0);
-    ui -> addPolygony5 -> setValue(0);
-    ui -> addPolygonx6 -> setValue(0);
-    ui -> addPolygony6 -> setValue(0);
-    ui -> addPolygonx7 -> setValue(0);
-    ui -> addPolygony7 -> setValue(0);
-    ui -> addPolygonx8 -> setValue(0);
-    ui -> addPolygony8 -> setValue(0);
-    ui -> addPolygonx9 -> setValue(0);
-    ui -> addPolygony9 -> setValue(0);
-    ui -> addPolygonx10 -> setValue(0);
-    ui -> addPolygony10 -> setValue(0);
+    if(addPolygonForm.isBuilt())
+    {
+        addPolygonForm -> addPolygonNumPoints -> setCurrentIndex(0);
+        addPolygonForm -> addPolygonPenColor -> setCurrentIndex(0);
+        addPolygonForm -> addPolygonPenWidth -> setValue(0);
+        addPolygonForm -> addPolygonPenStyle ->setCurrentIndex(0);
+        addPolygonForm -> addPolygonCapStyle -> setCurrentIndex(0);
+        addPolygonForm -> addPolygonJoinStyle -> setCurrentIndex(0);
+        addPolygonForm -> addPolygonBrushColor ->setCurrentIndex(0);
+        addPolygonForm -> addPolygonBrushStyle -> setCurrentIndex(0);
+        addPolygonForm -> addPolygonx1 -> setValue(0);
+        addPolygonForm -> addPolygony1 -> setValue(0);
+        addPolygonForm -> addPolygonx2 -> setValue(0);
+        addPolygonForm -> addPolygony2 -> setValue(0);
+        addPolygonForm -> addPolygonx3 -> setValue(0);
+        addPolygonForm -> addPolygony3 -> setValue(0);
+        addPolygonForm -> addPolygonx4 -> setValue(0);
+        addPolygonForm -> addPolygony4 -> setValue(0);
+        addPolygonForm -> addPolygonx5 -> setValue(0);
+        addPolygonForm -> addPolygony5 -> setValue(0);
+        addPolygonForm -> addPolygonx6 -> setValue(0);
+        addPolygonForm -> addPolygony6 -> setValue(0);
+        addPolygonForm -> addPolygonx7 -> setValue(0);
+        addPolygonForm -> addPolygony7 -> setValue(0);
+        addPolygonForm -> addPolygonx8 -> setValue(0);
+        addPolygonForm -> addPolygony8 -> setValue(0);
+        addPolygonForm -> addPolygonx9 -> setValue(0);
+        addPolygonForm -> addPolygony9 -> setValue(0);
+        addPolygonForm -> addPolygonx10 -> setValue(0);
+        addPolygonForm -> addPolygony10 -> setValue(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add rectangle form specifications
 void MainWindow::clearAddRectangle()
 {
-    ui -> addRectanglePenColor -> setCurrentIndex(0);
-    ui -> addRectanglePenWidth -> setValue(0);
-    ui -> addRectanglePenStyle -> setCurrentIndex(0);
-    ui -> addRectangleCapStyle -> setCurrentIndex(0);
-    ui -> addRectangleJoinStyle -> setCurrentIndex(0);
-    ui -> addRectangleBrushColor -> setCurrentIndex(0);
-    ui -> addRectangleBrushStyle -> setCurrentIndex(0);
-    ui -> addRectanglex1 -> setValue(0);
-    ui -> addRectangley1 -> setValue(0);
-    ui -> addRectanglew -> setValue(0);
-    ui -> addRectangleh -> setValue(0);
+    if(addRectangleForm.isBuilt())
+    {
+        addRectangleForm -> addRectanglePenColor -> setCurrentIndex(0);
+        addRectangleForm -> addRectanglePenWidth -> setValue(0);
+        addRectangleForm -> addRectanglePenStyle -> setCurrentIndex(0);
+        addRectangleForm -> addRectangleCapStyle -> setCurrentIndex(0);
+        addRectangleForm -> addRectangleJoinStyle -> setCurrentIndex(0);
+        addRectangleForm -> addRectangleBrushColor -> setCurrentIndex(0);
+        addRectangleForm -> addRectangleBrushStyle -> setCurrentIndex(0);
+        addRectangleForm -> addRectanglex1 -> setValue(0);
+        addRectangleForm -> addRectangley1 -> setValue(0);
+        addRectangleForm -> addRectanglew -> setValue(0);
+        addRectangleForm -> addRectangleh -> setValue(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add square form specifications
 void MainWindow::clearAddSquare()
 {
-    ui -> addSquarePenColor->setCurrentIndex(0);
-    ui -> addSquarePenColor ->setCurrentIndex(0);
-    ui -> addSquarePenWidth ->setValue(0);
-    ui -> addSquarePenStyle -> setCurrentIndex(0);
-    ui -> addSquareCapStyle -> setCurrentIndex(0);
-    ui -> addSquareJoinStyle -> setCurrentIndex(0);
-    ui -> addSquareBrushColor -> setCurrentIndex(0);
-    ui -> addSquareBrushStyle -> setCurrentIndex(0);
-    ui -> addSquarex1 -> setValue(0);
-    ui -> addSquarey1 -> setValue(0);
-    ui -> addSquarel -> setValue(0);
+    if(addSquareForm.isBuilt())
+    {
+        addSquareForm -> addSquarePenColor->setCurrentIndex(0);
+        addSquareForm -> addSquarePenColor ->setCurrentIndex(0);
+        addSquareForm -> addSquarePenWidth ->setValue(0);
+        addSquareForm -> addSquarePenStyle -> setCurrentIndex(0);
+        addSquareForm -> addSquareCapStyle -> setCurrentIndex(0);
+        addSquareForm -> addSquareJoinStyle -> setCurrentIndex(0);
+        addSquareForm -> addSquareBrushColor -> setCurrentIndex(0);
+        addSquareForm -> addSquareBrushStyle -> setCurrentIndex(0);
+        addSquareForm -> addSquarex1 -> setValue(0);
+        addSquareForm -> addSquarey1 -> setValue(0);
+        addSquareForm -> addSquarel -> setValue(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add ellipse form specifications
 void MainWindow::clearAddEllipse()
 {
-    ui -> addEllipsePenColor->setCurrentIndex(0);
-    ui -> addEllipsePenColor ->setCurrentIndex(0);
-    ui -> addEllipsePenWidth ->setValue(0);
-    ui -> addEllipsePenStyle -> setCurrentIndex(0);
-    ui -> addEllipseCapStyle -> setCurrentIndex(0);
-    ui -> addEllipseJoinStyle -> setCurrentIndex(0);
-    ui -> addEllipseBrushColor -> setCurrentIndex(0);
-    ui -> addEllipseBrushStyle -> setCurrentIndex(0);
-    ui -> addEllipsex1 -> setValue(0);
-    ui -> addEllipsey1 -> setValue(0);
-    ui -> addEllipsea -> setValue(0);
-    ui -> addEllipseb -> setValue(0);
+    if(addEllipseForm.isBuilt())
+    {
+        addEllipseForm -> addEllipsePenColor->setCurrentIndex(0);
+        addEllipseForm -> addEllipsePenColor ->setCurrentIndex(0);
+        addEllipseForm -> addEllipsePenWidth ->setValue(0);
+        addEllipseForm -> addEllipsePenStyle -> setCurrentIndex(0);
+        addEllipseForm -> addEllipseCapStyle -> setCurrentIndex(0);
+        addEllipseForm -> addEllipseJoinStyle -> setCurrentIndex(0);
+        addEllipseForm -> addEllipseBrushColor -> setCurrentIndex(0);
+        addEllipseForm -> addEllipseBrushStyle -> setCurrentIndex(0);
+        addEllipseForm -> addEllipsex1 -> setValue(0);
+        addEllipseForm -> addEllipsey1 -> setValue(0);
+        addEllipseForm -> addEllipsea -> setValue(0);
+        addEllipseForm -> addEllipseb -> setValue(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add circle form specifications
 void MainWindow::clearAddCircle()
 {
-    ui -> addCirclePenColor->setCurrentIndex(0);
-    ui -> addCirclePenColor ->setCurrentIndex(0);
-    ui -> addCirclePenWidth ->setValue(0);
-    ui -> addCirclePenStyle -> setCurrentIndex(0);
-    ui -> addCircleCapStyle -> setCurrentIndex(0);
-    ui -> addCircleJoinStyle -> setCurrentIndex(0);
-    ui -> addCircleBrushColor -> setCurrentIndex(0);
-    ui -> addCircleBrushStyle -> setCurrentIndex(0);
-    ui -> addCirclex1 -> setValue(0);
-    ui -> addCircley1 -> setValue(0);
-    ui -> addCircler -> setValue(0);
+    if(addCircleForm.isBuilt())
+    {
+        addCircleForm -> addCirclePenColor->setCurrentIndex(0);
+        addCircleForm -> addCirclePenColor ->setCurrentIndex(0);
+        addCircleForm -> addCirclePenWidth ->setValue(0);
+        addCircleForm -> addCirclePenStyle -> setCurrentIndex(0);
+        addCircleForm -> addCircleCapStyle -> setCurrentIndex(0);
+        addCircleForm -> addCircleJoinStyle -> setCurrentIndex(0);
+        addCircleForm -> addCircleBrushColor -> setCurrentIndex(0);
+        addCircleForm -> addCircleBrushStyle -> setCurrentIndex(0);
+        addCircleForm -> addCirclex1 -> setValue(0);
+        addCircleForm -> addCircley1 -> setValue(0);
+        addCircleForm -> addCircler -> setValue(0);
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
 //! Resets add text form specifications
 void MainWindow::clearAddText()
 {
-    ui -> addTextColor->setCurrentIndex(0);
-    ui -> addTextAlignment ->setCurrentIndex(0);
-    ui -> addTextFontFamily ->setCurrentIndex(0);
-    ui -> addTextFontStyle -> setCurrentIndex(0);
-    ui -> addTextFontWeight -> setCurrentIndex(0);
-    ui -> addTextSize-> setValue(0);
-    ui -> addTextx1 -> setValue(0);
-    ui -> addTexty1 -> setValue(0);
-    ui -> addTextw -> setValue(0);
-    ui -> addTexth -> setValue(0);
-    ui -> addTexttext -> clear();
+    if(addTextForm.isBuilt())
+    {
+        addTextForm -> addTextColor->setCurrentIndex(0);
+        addTextForm -> addTextAlignment ->setCurrentIndex(0);
+        addTextForm -> addTextFontFamily ->setCurrentIndex(0);
+        addTextForm -> addTextFontStyle -> setCurrentIndex(0);
+        addTextForm -> addTextFontWeight -> setCurrentIndex(0);
+        addTextForm -> addTextSize-> setValue(0);
+        addTextForm -> addTextx1 -> setValue(0);
+        addTextForm -> addTexty1 -> setValue(0);
+        addTextForm -> addTextw -> setValue(0);
+        addTextForm -> addTexth -> setValue(0);
+        addTextForm -> addTexttext -> clear();
+    }
     ui -> addShapeType -> setCurrentIndex(0);
 }
 
@@ -398,160 +773,184 @@ void MainWindow::clearAdd()
 //! Resets edit line form specifications
 void MainWindow::clearEditLine()
 {
-    ui -> editLinex1 -> setValue(0);
-    ui -> editLiney1 -> setValue(0);
-    ui -> editLinex2 -> setValue(0);
-    ui -> editLiney2 -> setValue(0);
-    ui -> editLinePenColor -> setCurrentIndex(0);
-    ui -> editLinePenWidth -> setValue(0);
-    ui -> editLinePenStyle -> setCurrentIndex(0);
-    ui -> editLineCapStyle -> setCurrentIndex(0);
-    ui -> editLineJoinStyle -> setCurrentIndex(0);
+    if(editLineForm.isBuilt())
+    {
+        editLineForm -> editLinex1 -> setValue(0);
+        editLineForm -> editLiney1 -> setValue(0);
+        editLineForm -> editLinex2 -> setValue(0);
+        editLineForm -> editLiney2 -> setValue(0);
+        editLineForm -> editLinePenColor -> setCurrentIndex(0);
+        editLineForm -> editLinePenWidth -> setValue(0);
+        editLineForm -> editLinePenStyle -> setCurrentIndex(0);
+        editLineForm -> editLineCapStyle -> setCurrentIndex(0);
+        editLineForm -> editLineJoinStyle -> setCurrentIndex(0);
+    }
 }
 
 //! Resets edit polyline form specifications
 void MainWindow::clearEditPolyline()
 {
-    ui -> editPolylineNumPoints -> setCurrentIndex(0);
-    ui -> editPolylinePenColor -> setCurrentIndex(0);
-    ui -> editPolylinePenWidth -> setValue(0);
-    ui -> editPolylinePenStyle -> setCurrentIndex(0);
-    ui -> editPolylineCapStyle -> setCurrentIndex(0);
-    ui -> editPolylineJoinStyle -> setCurrentIndex(0);
-    ui -> editPolylinex1 -> setValue(0);
-    ui -> editPolyliney1 -> setValue(0);
-    ui -> editPolylinex2 -> setValue(0);
-    ui -> editPolyliney2 -> setValue(0);
-    ui -> editPolylinex3 -> setValue(0);
-    ui -> editPolyliney3 -> setValue(0);
-    ui -> editPolylinex4 -> setValue(0);
-    ui -> editPolyliney4 -> setValue(0);
-    ui -> editPolylinex5 -> setValue(0);
-    ui -> editPolyliney5 -> setValue(0);
-    ui -> editPolylinex6 -> setValue(0);
-    ui -> editPolyliney6 -> setValue(0);
-    ui -> editPolylinex7 -> setValue(0);
-    ui -> editPolyliney7 -> setValue(0);
-    ui -> editPolylinex8 -> setValue(0);
-    ui -> editPolyliney8 -> setValue(0);
-    ui -> editPolylinex9 -> setValue(0);
-    ui -> editPolyliney9 -> setValue(0);
-    ui -> editPolylinex10 -> setValue(0);
-    ui -> editPolyliney10 -> setValue(0);
+    if(editPolylineForm.isBuilt())
+    {
+        editPolylineForm -> editPolylineNumPoints -> setCurrentIndex(0);
+        editPolylineForm -> editPolylinePenColor -> setCurrentIndex(0);
+        editPolylineForm -> editPolylinePenWidth -> setValue(0);
+        editPolylineForm -> editPolylinePenStyle -> setCurrentIndex(0);
+        editPolylineForm -> editPolylineCapStyle -> setCurrentIndex(0);
+        editPolylineForm -> editPolylineJoinStyle -> setCurrentIndex(0);
+        editPolylineForm -> editPolylinex1 -> setValue(0);
+        editPolylineForm -> editPolyliney1 -> setValue(0);
+        editPolylineForm -> editPolylinex2 -> setValue(0);
+        editPolylineForm -> editPolyliney2 -> setValue(0);
+        editPolylineForm -> editPolylinex3 -> setValue(0);
+        editPolylineForm -> editPolyliney3 -> setValue(0);
+        editPolylineForm -> editPolylinex4 -> setValue(0);
+        editPolylineForm -> editPolyliney4 -> setValue(0);
+        editPolylineForm -> editPolylinex5 -> setValue(0);
+        editPolylineForm -> editPolyliney5 -> setValue(0);
+        editPolylineForm -> editPolylinex6 -> setValue(0);
+        editPolylineForm -> editPolyliney6 -> setValue(0);
+        editPolylineForm -> editPolylinex7 -> setValue(0);
+        editPolylineForm -> editPolyliney7 -> setValue(0);
+        editPolylineForm -> editPolylinex8 -> setValue(0);
+        editPolylineForm -> editPolyliney8 -> setValue(0);
+        editPolylineForm -> editPolylinex9 -> setValue(0);
+        editPolylineForm -> editPolyliney9 -> setValue(0);
+        editPolylineForm -> editPolylinex10 -> setValue(0);
+        editPolylineForm -> editPolyliney10 -> setValue(0);
+    }
 }
 
 //! Resets edit polygon form specifications
 void MainWindow::clearEditPolygon()
 {
-    ui -> editPolygonNumPoints -> setCurrentIndex(0);
-    ui -> editPolygonPenColor -> setCurrentIndex(0);
-    ui -> editPolygonPenWidth -> setValue(0);
-    ui -> editPolygonPenStyle ->setCurrentIndex(0);
-    ui -> editPolygonCapStyle -> setCurrentIndex(0);
-    ui -> editPolygonJoinStyle -> setCurrentIndex(0);
-    ui -> editPolygonBrushColor ->setCurrentIndex(0);
-    ui -> editPolygonBrushStyle -> setCurrentIndex(0);
-    ui -> editPolygonx1 -> setValue(0);
-    ui -> editPolygony1 -> setValue(0);
-    ui -> editPolygonx2 -> setValue(0);
-    ui -> editPolygony2 -> setValue(0);
-    ui -> editPolygonx3 -> setValue(0);
-    ui -> editPolygony3 -> setValue(0);
-    ui -> editPolygonx4 -> setValue(0);
-    ui -> editPolygony4 -> setValue(0);
-    ui -> editPolygonx5 -> setValue(0);
-    ui -> editPolygony5 -> setValue(0);
-    ui -> editPolygonx6 -> setValue(0);
-    ui -> editPolygony6 -> setValue(0);
-    ui -> editPolygonx7 -> setValue(0);
-    ui -> editPolygony7 -> setValue(0);
-    ui -> editPolygonx8 -> setValue(0);
-    ui -> editPolygony8 -> setValue(0);
-    ui -> editPolygonx9 -> setValue(0);
-    ui -> editPolygony9 -> setValue(0);
-    ui -> editPolygonx10 -> setValue(0);
-    ui -> editPolygony10 -> setValue(0);
+    if(editPolygonForm.isBuilt())
+    {
+        editPolygonForm -> editPolygonNumPoints -> setCurrentIndex(0);
+        editPolygonForm -> editPolygonPenColor -> setCurrentIndex(0);
+        editPolygonForm -> editPolygonPenWidth -> setValue(0);
+        editPolygonForm -> editPolygonPenStyle ->setCurrentIndex(0);
+        editPolygonForm -> editPolygonCapStyle -> setCurrentIndex(0);
+        editPolygonForm -> editPolygonJoinStyle -> setCurrentIndex(0);
+        editPolygonForm -> editPolygonBrushColor ->setCurrentIndex(0);
+        editPolygonForm -> editPolygonBrushStyle -> setCurrentIndex(0);
+        editPolygonForm -> editPolygonx1 -> setValue(0);
+        editPolygonForm -> editPolygony1 -> setValue(0);
+        editPolygonForm -> editPolygonx2 -> setValue(0);
+        editPolygonForm -> editPolygony2 -> setValue(0);
+        editPolygonForm -> editPolygonx3 -> setValue(0);
+        editPolygonForm -> editPolygony3 -> setValue(0);
+        editPolygonForm -> editPolygonx4 -> setValue(0);
+        editPolygonForm -> editPolygony4 -> setValue(0);
+        editPolygonForm -> editPolygonx5 -> setValue(0);
+        editPolygonForm -> editPolygony5 -> setValue(0);
+        editPolygonForm -> editPolygonx6 -> setValue(0);
+        editPolygonForm -> editPolygony6 -> setValue(0);
+        editPolygonForm -> editPolygonx7 -> setValue(0);
+        editPolygonForm -> editPolygony7 -> setValue(0);
+        editPolygonForm -> editPolygonx8 -> setValue(0);
+        editPolygonForm -> editPolygony8 -> setValue(0);
+        editPolygonForm -> editPolygonx9 -> setValue(0);
+        editPolygonForm -> editPolygony9 -> setValue(0);
+        editPolygonForm -> editPolygonx10 -> setValue(0);
+        editPolygonForm -> editPolygony10 -> setValue(0);
+    }
 }
 
 //! Resets edit rectangle form specifications
 void MainWindow::clearEditRectangle()
 {
-    ui -> editRectanglePenColor -> setCurrentIndex(0);
-    ui -> editRectanglePenWidth -> setValue(0);
-    ui -> editRectanglePenStyle -> setCurrentIndex(0);
-    ui -> editRectangleCapStyle -> setCurrentIndex(0);
-    ui -> editRectangleJoinStyle -> setCurrentIndex(0);
-    ui -> editRectangleBrushColor -> setCurrentIndex(0);
-    ui -> editRectangleBrushStyle -> setCurrentIndex(0);
-    ui -> editRectanglex1 -> setValue(0);
-    ui -> editRectangley1 -> setValue(0);
-    ui -> editRectanglew -> setValue(0);
-    ui -> editRectangleh -> setValue(0);
+    if(editRectangleForm.isBuilt())
+    {
+        editRectangleForm -> editRectanglePenColor -> setCurrentIndex(0);
+        editRectangleForm -> editRectanglePenWidth -> setValue(0);
+        editRectangleForm -> editRectanglePenStyle -> setCurrentIndex(0);
+        editRectangleForm -> editRectangleCapStyle -> setCurrentIndex(0);
+        editRectangleForm -> editRectangleJoinStyle -> setCurrentIndex(0);
+        editRectangleForm -> editRectangleBrushColor -> setCurrentIndex(0);
+        editRectangleForm -> editRectangleBrushStyle -> setCurrentIndex(0);
+        editRectangleForm -> editRectanglex1 -> setValue(0);
+        editRectangleForm -> editRectangley1 -> setValue(0);
+        editRectangleForm -> editRectanglew -> setValue(0);
+        editRectangleForm -> editRectangleh -> setValue(0);
+    }
 }
 
 //! Resets edit square form specifications
 void MainWindow::clearEditSquare()
 {
-    ui -> editSquarePenColor->setCurrentIndex(0);
-    ui -> editSquarePenColor ->setCurrentIndex(0);
-    ui -> editSquarePenWidth ->setValue(0);
-    ui -> editSquarePenStyle -> setCurrentIndex(0);
-    ui -> editSquareCapStyle -> setCurrentIndex(0);
-    ui -> editSquareJoinStyle -> setCurrentIndex(0);
-    ui -> editSquareBrushColor -> setCurrentIndex(0);
-    ui -> editSquareBrushStyle -> setCurrentIndex(0);
-    ui -> editSquarex1 -> setValue(0);
-    ui -> editSquarey1 -> setValue(0);
-    ui -> editSquarel -> setValue(0);
+    if(editSquareForm.isBuilt())
+    {
+        editSquareForm -> editSquarePenColor->setCurrentIndex(0);
+        editSquareForm -> editSquarePenColor ->setCurrentIndex(0);
+        editSquareForm -> editSquarePenWidth ->setValue(0);
+        editSquareForm -> editSquarePenStyle -> setCurrentIndex(0);
+        editSquareForm -> editSquareCapStyle -> setCurrentIndex(0);
+        editSquareForm -> editSquareJoinStyle -> setCurrentIndex(0);
+        editSquareForm -> editSquareBrushColor -> setCurrentIndex(0);
+        editSquareForm -> editSquareBrushStyle -> setCurrentIndex(0);
+        editSquareForm -> editSquarex1 -> setValue(0);
+        editSquareForm -> editSquarey1 -> setValue(0);
+        editSquareForm -> editSquarel -> setValue(0);
+    }
 }
 
 //! Resets edit ellipse form specifications
 void MainWindow::clearEditEllipse()
 {
-    ui -> editEllipsePenColor->setCurrentIndex(0);
-    ui -> editEllipsePenColor ->setCurrentIndex(0);
-    ui -> editEllipsePenWidth ->setValue(0);
-    ui -> editEllipsePenStyle -> setCurrentIndex(0);
-    ui -> editEllipseCapStyle -> setCurrentIndex(0);
-    ui -> editEllipseJoinStyle -> setCurrentIndex(0);
-    ui -> editEllipseBrushColor -> setCurrentIndex(0);
-    ui -> editEllipseBrushStyle -> setCurrentIndex(0);
-    ui -> editEllipsex1 -> setValue(0);
-    ui -> editEllipsey1 -> setValue(0);
-    ui -> editEllipsea -> setValue(0);
-    ui -> editEllipseb -> setValue(0);
+    if(editEllipseForm.isBuilt())
+    {
+        editEllipseForm -> editEllipsePenColor->setCurrentIndex(0);
+        editEllipseForm -> editEllipsePenColor ->setCurrentIndex(0);
+        editEllipseForm -> editEllipsePenWidth ->setValue(0);
+        editEllipseForm -> editEllipsePenStyle -> setCurrentIndex(0);
+        editEllipseForm -> editEllipseCapStyle -> setCurrentIndex(0);
+        editEllipseForm -> editEllipseJoinStyle -> setCurrentIndex(0);
+        editEllipseForm -> editEllipseBrushColor -> setCurrentIndex(0);
+        editEllipseForm -> editEllipseBrushStyle -> setCurrentIndex(0);
+        editEllipseForm -> editEllipsex1 -> setValue(0);
+        editEllipseForm -> editEllipsey1 -> setValue(0);
+        editEllipseForm -> editEllipsea -> setValue(0);
+        editEllipseForm -> editEllipseb -> setValue(0);
+    }
 }
 
 //! Resets edit circle form specifications
 void MainWindow::clearEditCircle()
 {
-    ui -> editCirclePenColor->setCurrentIndex(0);
-    ui -> editCirclePenColor ->setCurrentIndex(0);
-    ui -> editCirclePenWidth ->setValue(0);
-    ui -> editCirclePenStyle -> setCurrentIndex(0);
-    ui -> editCircleCapStyle -> setCurrentIndex(0);
-    ui -> editCircleJoinStyle -> setCurrentIndex(0);
-    ui -> editCircleBrushColor -> setCurrentIndex(0);
-    ui -> editCircleBrushStyle -> setCurrentIndex(0);
-    ui -> editCirclex1 -> setValue(0);
-    ui -> editCircley1 -> setValue(0);
-    ui -> editCircler -> setValue(0);
+    if(editCircleForm.isBuilt())
+    {
+        editCircleForm -> editCirclePenColor->setCurrentIndex(0);
+        editCircleForm -> editCirclePenColor ->setCurrentIndex(0);
+        editCircleForm -> editCirclePenWidth ->setValue(0);
+        editCircleForm -> editCirclePenStyle -> setCurrentIndex(0);
+        editCircleForm -> editCircleCapStyle -> setCurrentIndex(0);
+        editCircleForm -> editCircleJoinStyle -> setCurrentIndex(0);
+        editCircleForm -> editCircleBrushColor -> setCurrentIndex(0);
+        editCircleForm -> editCircleBrushStyle -> setCurrentIndex(0);
+        editCircleForm -> editCirclex1 -> setValue(0);
+        editCircleForm -> editCircley1 -> setValue(0);
+        editCircleForm -> editCircler -> setValue(0);
+    }
 }
 
 //! Resets edit text form specifications
 void MainWindow::clearEditText()
 {
-    ui -> editTextColor->setCurrentIndex(0);
-    ui -> editTextAlignment ->setCurrentIndex(0);
-    ui -> editTextFontFamily ->setCurrentIndex(0);
-    ui -> editTextFontStyle -> setCurrentIndex(0);
-    ui -> editTextFontWeight -> setCurrentIndex(0);
-    ui -> editTextSize-> setValue(0);
-    ui -> editTextx1 -> setValue(0);
-    ui -> editTexty1 -> setValue(0);
-    ui -> editTextw -> clear();
-    ui -> editTexth -> setValue(0);
-    ui -> editTexttext -> clear();
+    if(editTextForm.isBuilt())
+    {
+        editTextForm -> editTextColor->setCurrentIndex(0);
+        editTextForm -> editTextAlignment ->setCurrentIndex(0);
+        editTextForm -> editTextFontFamily ->setCurrentIndex(0);
+        editTextForm -> editTextFontStyle -> setCurrentIndex(0);
+        editTextForm -> editTextFontWeight -> setCurrentIndex(0);
+        editTextForm -> editTextSize-> setValue(0);
+        editTextForm -> editTextx1 -> setValue(0);
+        editTextForm -> editTexty1 -> setValue(0);
+        editTextForm -> editTextw -> clear();
+        editTextForm -> editTexth -> setValue(0);
+        editTextForm -> editTexttext -> clear();
+    }
 }
 
 //! Resets specifications for all edit forms
@@ -567,277 +966,274 @@ void MainWindow::clearEdit()
     clearEditText();
 }
 
-//! Returns a list of QStrings of all current shape ID's
-QStringList MainWindow::set_getShapeIds()
-{
-    QStringList ids;
-    int i{0};
-
-    for(Shape *it : allShapes.getVector())
-    {
-        ids.insert(i, QString::number(it -> getID()));
-        ++i;
-    }
-
-    return ids;
-}
-
 //! Sets edit form field with shape's current specifications
 void MainWindow::setCurrentShapeInfo()
 {
+    TRACE_SCOPE("ui", __func__);
+
     int shapeId = (ui->editShapeID->currentText()).toInt();
     Shape* p = allShapes.findShapePtr(shapeId);
     int i{0};
 
-    QPen pen = p->getPen();
-    QBrush brush = p->getBrush();
+    // The selector is editable, so its text may not be the ID of any shape
+    if(p == nullptr)
+    {
+        return;
+    }
+
+    const QPen &pen = p->getPen();
+    const QBrush &brush = p->getBrush();
 
     if(allShapes.findShape(shapeId)=="Line")
     {
-        ui ->editLinex1->setValue(p->getDimensions()[int(Line::Specifications::X1)]);
-        ui ->editLiney1->setValue(p->getDimensions()[int(Line::Specifications::Y1)]);
-        ui ->editLinex2->setValue(p->getDimensions()[int(Line::Specifications::X2)]);
-        ui ->editLiney2->setValue(p->getDimensions()[int(Line::Specifications::Y2)]);
-
-        ui ->editLinePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editLinePenWidth->setValue(pen.width());
-        ui ->editLinePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editLineCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editLineJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+        editLineForm ->editLinex1->setValue(p->getDimensions()[int(Line::Specifications::X1)]);
+        editLineForm ->editLiney1->setValue(p->getDimensions()[int(Line::Specifications::Y1)]);
+        editLineForm ->editLinex2->setValue(p->getDimensions()[int(Line::Specifications::X2)]);
+        editLineForm ->editLiney2->setValue(p->getDimensions()[int(Line::Specifications::Y2)]);
+
+        editLineForm ->editLinePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editLineForm ->editLinePenWidth->setValue(pen.width());
+        editLineForm ->editLinePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editLineForm ->editLineCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editLineForm ->editLineJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
     }
     else if(allShapes.findShape(shapeId)=="Polyline")
     {
         clearEditPolyline();
 
         int numPolylinePoints = p->getNumDimensions() / 2;
-        ui->editPolylineNumPoints->setCurrentIndex(0);
+        editPolylineForm->editPolylineNumPoints->setCurrentIndex(0);
 
         if(numPolylinePoints >= 1)
         {
-            ui->editPolylinex1->setValue(p->getDimensions()[i]);
-            ui->editPolyliney1->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex1->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney1->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 2)
         {
-            ui->editPolylinex2->setValue(p->getDimensions()[i]);
-            ui->editPolyliney2->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex2->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney2->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 3)
         {
-            ui->editPolylinex3->setValue(p->getDimensions()[i]);
-            ui->editPolyliney3->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex3->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney3->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 4)
         {
-            ui->editPolylinex4->setValue(p->getDimensions()[i]);
-            ui->editPolyliney4->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex4->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney4->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 5)
         {
-            ui->editPolylinex5->setValue(p->getDimensions()[i]);
-            ui->editPolyliney5->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex5->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney5->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 6)
         {
-            ui->editPolylinex6->setValue(p->getDimensions()[i]);
-            ui->editPolyliney6->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex6->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney6->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 7)
         {
-            ui->editPolylinex7->setValue(p->getDimensions()[i]);
-            ui->editPolyliney7->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex7->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney7->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 8)
         {
-            ui->editPolylinex8->setValue(p->getDimensions()[i]);
-            ui->editPolyliney8->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex8->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney8->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints >= 9)
         {
-            ui->editPolylinex9->setValue(p->getDimensions()[i]);
-            ui->editPolyliney9->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex9->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney9->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolylinePoints == 10)
         {
-            ui->editPolylinex10->setValue(p->getDimensions()[i]);
-            ui->editPolyliney10->setValue(p->getDimensions()[i+1]);
+            editPolylineForm->editPolylinex10->setValue(p->getDimensions()[i]);
+            editPolylineForm->editPolyliney10->setValue(p->getDimensions()[i+1]);
         }
 
-        ui ->editPolylinePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editPolylinePenWidth->setValue(pen.width());
-        ui ->editPolylinePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editPolylineCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editPolylineJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+        editPolylineForm ->editPolylinePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editPolylineForm ->editPolylinePenWidth->setValue(pen.width());
+        editPolylineForm ->editPolylinePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editPolylineForm ->editPolylineCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editPolylineForm ->editPolylineJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
     }
     else if(allShapes.findShape(shapeId)=="Polygon")
     {
         clearEditPolygon();
 
         int numPolygonPoints = p->getNumDimensions() / 2;
-        ui->editPolygonNumPoints->setCurrentIndex(0);
+        editPolygonForm->editPolygonNumPoints->setCurrentIndex(0);
 
         if(numPolygonPoints >= 1)
         {
-            ui->editPolygonx1->setValue(p->getDimensions()[i]);
-            ui->editPolygony1->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx1->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony1->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 2)
         {
-            ui->editPolygonx2->setValue(p->getDimensions()[i]);
-            ui->editPolygony2->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx2->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony2->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 3)
         {
-            ui->editPolygonx3->setValue(p->getDimensions()[i]);
-            ui->editPolygony3->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx3->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony3->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 4)
         {
-            ui->editPolygonx4->setValue(p->getDimensions()[i]);
-            ui->editPolygony4->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx4->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony4->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 5)
         {
-            ui->editPolygonx5->setValue(p->getDimensions()[i]);
-            ui->editPolygony5->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx5->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony5->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 6)
         {
-            ui->editPolygonx6->setValue(p->getDimensions()[i]);
-            ui->editPolygony6->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx6->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony6->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 7)
         {
-            ui->editPolygonx7->setValue(p->getDimensions()[i]);
-            ui->editPolygony7->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx7->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony7->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 8)
         {
-            ui->editPolygonx8->setValue(p->getDimensions()[i]);
-            ui->editPolygony8->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx8->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony8->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints >= 9)
         {
-            ui->editPolygonx9->setValue(p->getDimensions()[i]);
-            ui->editPolygony9->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx9->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony9->setValue(p->getDimensions()[i+1]);
             i += 2;
         }
         if(numPolygonPoints == 10)
         {
-            ui->editPolygonx10->setValue(p->getDimensions()[i]);
-            ui->editPolygony10->setValue(p->getDimensions()[i+1]);
+            editPolygonForm->editPolygonx10->setValue(p->getDimensions()[i]);
+            editPolygonForm->editPolygony10->setValue(p->getDimensions()[i+1]);
         }
 
-        ui ->editPolygonPenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editPolygonPenWidth->setValue(pen.width());
-        ui ->editPolygonPenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editPolygonCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editPolygonJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
-        ui ->editPolygonBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
-        ui ->editPolygonBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
+        editPolygonForm ->editPolygonPenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editPolygonForm ->editPolygonPenWidth->setValue(pen.width());
+        editPolygonForm ->editPolygonPenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editPolygonForm ->editPolygonCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editPolygonForm ->editPolygonJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+        editPolygonForm ->editPolygonBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
+        editPolygonForm ->editPolygonBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
     }
     else if(allShapes.findShape(shapeId)=="Rectangle")
     {
-        ui ->editRectanglex1->setValue(p->getDimensions()[int(Rectangle::Specifications::X1)]);
-        ui ->editRectangley1->setValue(p->getDimensions()[int(Rectangle::Specifications::Y1)]);
-        ui ->editRectanglew->setValue(p->getDimensions()[int(Rectangle::Specifications::W)]);
-        ui ->editRectangleh->setValue(p->getDimensions()[int(Rectangle::Specifications::H)]);
-
-        ui ->editRectanglePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editRectanglePenWidth->setValue(pen.width());
-        ui ->editRectanglePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editRectangleCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editRectangleJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
-
-        ui ->editRectangleBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
-        ui ->editRectangleBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
+        editRectangleForm ->editRectanglex1->setValue(p->getDimensions()[int(Rectangle::Specifications::X1)]);
+        editRectangleForm ->editRectangley1->setValue(p->getDimensions()[int(Rectangle::Specifications::Y1)]);
+        editRectangleForm ->editRectanglew->setValue(p->getDimensions()[int(Rectangle::Specifications::W)]);
+        editRectangleForm ->editRectangleh->setValue(p->getDimensions()[int(Rectangle::Specifications::H)]);
+
+        editRectangleForm ->editRectanglePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editRectangleForm ->editRectanglePenWidth->setValue(pen.width());
+        editRectangleForm ->editRectanglePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editRectangleForm ->editRectangleCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editRectangleForm ->editRectangleJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+
+        editRectangleForm ->editRectangleBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
+        editRectangleForm ->editRectangleBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
     }
     else if(allShapes.findShape(shapeId)=="Square")
     {
-        ui ->editSquarex1->setValue(p->getDimensions()[int(Square::Specifications::X1)]);
-        ui ->editSquarey1->setValue(p->getDimensions()[int(Square::Specifications::Y1)]);
-        ui ->editSquarel->setValue(p->getDimensions()[int(Square::Specifications::L)]);
-
-        ui ->editSquarePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editSquarePenWidth->setValue(pen.width());
-        ui ->editSquarePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editSquareCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editSquareJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
-
-        ui ->editSquareBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
-        ui ->editSquareBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
+        editSquareForm ->editSquarex1->setValue(p->getDimensions()[int(Square::Specifications::X1)]);
+        editSquareForm ->editSquarey1->setValue(p->getDimensions()[int(Square::Specifications::Y1)]);
+        editSquareForm ->editSquarel->setValue(p->getDimensions()[int(Square::Specifications::L)]);
+
+        editSquareForm ->editSquarePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editSquareForm ->editSquarePenWidth->setValue(pen.width());
+        editSquareForm ->editSquarePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editSquareForm ->editSquareCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editSquareForm ->editSquareJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+
+        editSquareForm ->editSquareBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
+        editSquareForm ->editSquareBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
     }
     else if(allShapes.findShape(shapeId)=="Ellipse")
     {
-        ui ->editEllipsex1->setValue(p->getDimensions()[int(Ellipse::Specifications::X1)]);
-        ui ->editEllipsey1->setValue(p->getDimensions()[int(Ellipse::Specifications::Y1)]);
-        ui ->editEllipsea->setValue(p->getDimensions()[int(Ellipse::Specifications::A)]);
-        ui ->editEllipseb->setValue(p->getDimensions()[int(Ellipse::Specifications::B)]);
-
-        ui ->editEllipsePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editEllipsePenWidth->setValue(pen.width());
-        ui ->editEllipsePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editEllipseCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editEllipseJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
-
-        ui ->editEllipseBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
-        ui ->editEllipseBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
+        editEllipseForm ->editEllipsex1->setValue(p->getDimensions()[int(Ellipse::Specifications::X1)]);
+        editEllipseForm ->editEllipsey1->setValue(p->getDimensions()[int(Ellipse::Specifications::Y1)]);
+        editEllipseForm ->editEllipsea->setValue(p->getDimensions()[int(Ellipse::Specifications::A)]);
+        editEllipseForm ->editEllipseb->setValue(p->getDimensions()[int(Ellipse::Specifications::B)]);
+
+        editEllipseForm ->editEllipsePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editEllipseForm ->editEllipsePenWidth->setValue(pen.width());
+        editEllipseForm ->editEllipsePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editEllipseForm ->editEllipseCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editEllipseForm ->editEllipseJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+
+        editEllipseForm ->editEllipseBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
+        editEllipseForm ->editEllipseBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
     }
     else if(allShapes.findShape(shapeId)=="Circle")
     {
-        ui ->editCirclex1->setValue(p->getDimensions()[int(Circle::Specifications::X1)]);
-        ui ->editCircley1->setValue(p->getDimensions()[int(Circle::Specifications::Y1)]);
-        ui ->editCircler->setValue(p->getDimensions()[int(Circle::Specifications::RADIUS)]);
-
-        ui ->editCirclePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editCirclePenWidth->setValue(pen.width());
-        ui ->editCirclePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
-        ui ->editCircleCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
-        ui ->editCircleJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
-
-        ui ->editCircleBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
-        ui ->editCircleBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
+        editCircleForm ->editCirclex1->setValue(p->getDimensions()[int(Circle::Specifications::X1)]);
+        editCircleForm ->editCircley1->setValue(p->getDimensions()[int(Circle::Specifications::Y1)]);
+        editCircleForm ->editCircler->setValue(p->getDimensions()[int(Circle::Specifications::RADIUS)]);
+
+        editCircleForm ->editCirclePenColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editCircleForm ->editCirclePenWidth->setValue(pen.width());
+        editCircleForm ->editCirclePenStyle->setCurrentText(QString::fromStdString(getPenStyleAsString(pen.style())));
+        editCircleForm ->editCircleCapStyle->setCurrentText(QString::fromStdString(getCapStyleAsString(pen.capStyle())));
+        editCircleForm ->editCircleJoinStyle->setCurrentText(QString::fromStdString(getJoinStyleAsString(pen.joinStyle())));
+
+        editCircleForm ->editCircleBrushColor->setCurrentText(QString::fromStdString(getColorAsString(brush.color())));
+        editCircleForm ->editCircleBrushStyle->setCurrentText(QString::fromStdString(getBrushStyleAsString(brush.style())));
     }
     else if(allShapes.findShape(shapeId)=="Text")
     {
-        QFont font = p->getFont();
-
-        ui ->editTextx1->setValue(p->getDimensions()[int(Text::Specifications::X1)]);
-        ui ->editTexty1->setValue(p->getDimensions()[int(Text::Specifications::Y1)]);
-        ui ->editTextw->setValue(p->getDimensions()[int(Text::Specifications::W)]);
-        ui ->editTexth->setValue(p->getDimensions()[int(Text::Specifications::H)]);
-
-        ui ->editTexttext->setText(QString::fromStdString(p->getText()));
-        ui ->editTextColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
-        ui ->editTextAlignment->setCurrentText(QString(p->getFlag()));
-        ui ->editTextSize->setValue(font.pointSize());
-        ui ->editTextFontFamily->setCurrentText(font.family());
-        ui ->editTextFontStyle->setCurrentText(QString::fromStdString(getFontStyleAsString(font.style())));
-        ui ->editTextFontWeight->setCurrentText(QString::fromStdString(getFontWeightAsString(QFont::Weight(font.weight()))));
+        Text *p_Text = static_cast<Text*>(p);
+        const QFont &font = p_Text->getFont();
+
+        editTextForm ->editTextx1->setValue(p->getDimensions()[int(Text::Specifications::X1)]);
+        editTextForm ->editTexty1->setValue(p->getDimensions()[int(Text::Specifications::Y1)]);
+        editTextForm ->editTextw->setValue(p->getDimensions()[int(Text::Specifications::W)]);
+        editTextForm ->editTexth->setValue(p->getDimensions()[int(Text::Specifications::H)]);
+
+        editTextForm ->editTexttext->setText(QString::fromStdString(p_Text->getText()));
+        editTextForm ->editTextColor->setCurrentText(QString::fromStdString(getColorAsString(pen.color())));
+        editTextForm ->editTextAlignment->setCurrentText(QString(p_Text->getFlag()));
+        editTextForm ->editTextSize->setValue(font.pointSize());
+        editTextForm ->editTextFontFamily->setCurrentText(font.family());
+        editTextForm ->editTextFontStyle->setCurrentText(QString::fromStdString(getFontStyleAsString(font.style())));
+        editTextForm ->editTextFontWeight->setCurrentText(QString::fromStdString(getFontWeightAsString(QFont::Weight(font.weight()))));
     }
 }
 
 //! Shows the appropriate add shape form based on the user-selected shape type
 void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
 {
+    TRACE_SLOT();
+
     if(arg1 == "Line"){
+        addLineForm.build();
         ui -> addLine -> show();
         ui -> addPolygon -> hide();
         ui -> addPolyline -> hide();
@@ -847,6 +1243,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addCircle -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Polyline"){
+        addPolylineForm.build();
         ui -> addPolyline -> show();
         disablePolylineSpinBoxes();
         ui -> addPolygon -> hide();
@@ -857,6 +1254,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addCircle -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Polygon"){
+        addPolygonForm.build();
         ui -> addPolygon -> show();
         disablePolygonSpinBoxes();
         ui -> addLine -> hide();
@@ -867,6 +1265,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addCircle -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Rectangle"){
+        addRectangleForm.build();
         ui -> addRectangle -> show();
         ui -> addPolygon -> hide();
         ui -> addPolyline -> hide();
@@ -876,6 +1275,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addCircle -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Square"){
+        addSquareForm.build();
         ui -> addSquare -> show();
         ui -> addLine -> hide();
         ui -> addPolyline -> hide();
@@ -885,6 +1285,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addCircle -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Ellipse"){
+        addEllipseForm.build();
         ui -> addEllipse -> show();
         ui -> addPolygon -> hide();
         ui -> addPolyline -> hide();
@@ -894,6 +1295,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addCircle -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Circle"){
+        addCircleForm.build();
         ui -> addCircle -> show();
         ui -> addPolygon -> hide();
         ui -> addPolyline -> hide();
@@ -903,6 +1305,7 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
         ui -> addLine -> hide();
         ui -> addText -> hide();}
     else if(arg1 == "Text"){
+        addTextForm.build();
         ui -> addText -> show();
         ui -> addPolygon -> hide();
         ui -> addPolyline -> hide();
@@ -923,25 +1326,27 @@ void MainWindow::on_addShapeType_currentIndexChanged(const QString &arg1)
 }
 
 //! Adds a new line to the shape vector
-void MainWindow::on_lineSave_clicked()
+void MainWindow::lineSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs lineDimensions[NUM_LINE_SPECS];
 
-    lineDimensions[int(Line::Specifications::X1)] = ui -> addLinex1 -> value();
-    lineDimensions[int(Line::Specifications::X2)] = ui -> addLinex2 -> value();
-    lineDimensions[int(Line::Specifications::Y1)] = ui -> addLiney1 -> value();
-    lineDimensions[int(Line::Specifications::Y2)] = ui -> addLiney2 -> value();
+    lineDimensions[int(Line::Specifications::X1)] = addLineForm -> addLinex1 -> value();
+    lineDimensions[int(Line::Specifications::X2)] = addLineForm -> addLinex2 -> value();
+    lineDimensions[int(Line::Specifications::Y1)] = addLineForm -> addLiney1 -> value();
+    lineDimensions[int(Line::Specifications::Y2)] = addLineForm -> addLiney2 -> value();
 
     dim::specs *dims = lineDimensions;
 
-    Shape* p_Shape = new class::Line(allShapes.incrementShapeCount(), SHAPES_LIST[LINE], NUM_LINE_SPECS, dims);
+    Shape* p_Shape = new class::Line(allShapes.allocateID(), NUM_LINE_SPECS, dims);
     QPen pen;
 
-    pen.setColor(QColor(ui -> addLinePenColor->currentText()));
-    pen.setWidth(ui -> addLinePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addLinePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addLineCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addLineJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addLineForm -> addLinePenColor->currentText()));
+    pen.setWidth(addLineForm -> addLinePenWidth -> value());
+    pen.setStyle(convertToPenStyle((addLineForm -> addLinePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addLineForm -> addLineCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addLineForm -> addLineJoinStyle -> currentText()).toStdString()));
 
     p_Shape -> setPen(pen);
     allShapes.newShape(p_Shape);
@@ -953,19 +1358,23 @@ void MainWindow::on_lineSave_clicked()
 
 //! Cancels addition of new line
 //! Resets add line form
-void MainWindow::on_lineCancel_clicked()
+void MainWindow::lineCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddLine();
 }
 
 //! Edits a line in the shape vector
-void MainWindow::on_editLineSave_clicked()
+void MainWindow::editLineSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs lineDimensions[NUM_LINE_SPECS];
-    lineDimensions[int(Line::Specifications::X1)] = ui -> editLinex1 -> value();
-    lineDimensions[int(Line::Specifications::X2)] = ui -> editLinex2 -> value();
-    lineDimensions[int(Line::Specifications::Y1)] = ui -> editLiney1 -> value();
-    lineDimensions[int(Line::Specifications::Y2)] = ui -> editLiney2 -> value();
+    lineDimensions[int(Line::Specifications::X1)] = editLineForm -> editLinex1 -> value();
+    lineDimensions[int(Line::Specifications::X2)] = editLineForm -> editLinex2 -> value();
+    lineDimensions[int(Line::Specifications::Y1)] = editLineForm -> editLiney1 -> value();
+    lineDimensions[int(Line::Specifications::Y2)] = editLineForm -> editLiney2 -> value();
 
     dim::specs *dims = lineDimensions;
     int shapeId;
@@ -974,11 +1383,11 @@ void MainWindow::on_editLineSave_clicked()
 
     QPen pen;
 
-    pen.setColor(QColor(ui -> editLinePenColor->currentText()));
-    pen.setWidth(ui -> editLinePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> editLinePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> editLineCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> editLineJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(editLineForm -> editLinePenColor->currentText()));
+    pen.setWidth(editLineForm -> editLinePenWidth -> value());
+    pen.setStyle(convertToPenStyle((editLineForm -> editLinePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((editLineForm -> editLineCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((editLineForm -> editLineJoinStyle -> currentText()).toStdString()));
 
     allShapes.editShape(shapeId, NUM_LINE_SPECS, dims, pen);
 
@@ -988,89 +1397,93 @@ void MainWindow::on_editLineSave_clicked()
 
 //! Cancels edit of a line
 //! Resets edit line form
-void MainWindow::on_editLineCancel_clicked()
+void MainWindow::editLineCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds a polyline to the shape vector
-void MainWindow::on_polylineSave_clicked()
+void MainWindow::polylineSaveClicked()
 {
-    int numPolylinePoints = ui -> addPolylineNumPoints -> currentIndex();
+    TRACE_SLOT();
+
+    int numPolylinePoints = addPolylineForm -> addPolylineNumPoints -> currentIndex();
     int numPolylineSpecs = numPolylinePoints * 2;
     int i{0};
     dim::specs polylineDimensions[numPolylineSpecs];
 
     if(numPolylinePoints >= 1)
     {
-        polylineDimensions[i] = ui -> addPolylinex1 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney1 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex1 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney1 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 2)
     {
-        polylineDimensions[i] = ui -> addPolylinex2 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney2 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex2 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney2 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 3)
     {
-        polylineDimensions[i] = ui -> addPolylinex3 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney3 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex3 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney3 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 4)
     {
-        polylineDimensions[i] = ui -> addPolylinex4 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney4 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex4 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney4 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 5)
     {
-        polylineDimensions[i] = ui -> addPolylinex5 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney5 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex5 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney5 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 6)
     {
-        polylineDimensions[i] = ui -> addPolylinex6 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney6 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex6 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney6 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 7)
     {
-        polylineDimensions[i] = ui -> addPolylinex7 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney7 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex7 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney7 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 8)
     {
-        polylineDimensions[i] = ui -> addPolylinex8 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney8 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex8 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney8 -> value();
         i += 2;
     }
     if(numPolylinePoints >= 9)
     {
-        polylineDimensions[i] = ui -> addPolylinex9 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney9 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex9 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney9 -> value();
         i += 2;
     }
     if(numPolylinePoints == 10)
     {
-        polylineDimensions[i] = ui -> addPolylinex10 -> value();
-        polylineDimensions[i+1] = ui -> addPolyliney10 -> value();
+        polylineDimensions[i] = addPolylineForm -> addPolylinex10 -> value();
+        polylineDimensions[i+1] = addPolylineForm -> addPolyliney10 -> value();
     }
 
     dim::specs *dims = polylineDimensions;
 
-    Shape* p_Shape = new class::Polyline(allShapes.incrementShapeCount(), SHAPES_LIST[POLYLINE], numPolylineSpecs, dims);
+    Shape* p_Shape = new class::Polyline(allShapes.allocateID(), numPolylineSpecs, dims);
     QPen pen;
 
-    pen.setColor(QColor(ui -> addPolylinePenColor->currentText()));
-    pen.setWidth(ui -> addPolylinePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addPolylinePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addPolylineCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addPolylineJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addPolylineForm -> addPolylinePenColor->currentText()));
+    pen.setWidth(addPolylineForm -> addPolylinePenWidth -> value());
+    pen.setStyle(convertToPenStyle((addPolylineForm -> addPolylinePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addPolylineForm -> addPolylineCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addPolylineForm -> addPolylineJoinStyle -> currentText()).toStdString()));
 
     p_Shape -> setPen(pen);
     allShapes.newShape(p_Shape);
@@ -1081,25 +1494,29 @@ void MainWindow::on_polylineSave_clicked()
 
 //! Cancels addition of a polyline to the shape vector
 //! Resets add polyline form
-void MainWindow::on_polylineCancel_clicked()
+void MainWindow::polylineCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddPolyline();
 }
 
 //! Edits a polyline in the vector
-void MainWindow::on_editPolylineSave_clicked()
+void MainWindow::editPolylineSaveClicked()
 {
+    TRACE_SLOT();
+
     const QString NO_VALUE = "--";
 
     /*! Throws an exception and outputs an error message if user has not selected a number of points for the polyline */
     try
     {
-        if(ui->editPolylineNumPoints->currentText()==NO_VALUE)
+        if(editPolylineForm->editPolylineNumPoints->currentText()==NO_VALUE)
         {
             throw(1);
         }
 
-        int numPolylinePoints = (ui -> editPolylineNumPoints -> currentText().toInt());
+        int numPolylinePoints = (editPolylineForm -> editPolylineNumPoints -> currentText().toInt());
 
         int numPolylineSpecs = numPolylinePoints * 2;
         int i{0};
@@ -1107,62 +1524,62 @@ void MainWindow::on_editPolylineSave_clicked()
 
         if(numPolylinePoints >= 1)
         {
-            polylineDimensions[i] = ui -> editPolylinex1 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney1 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex1 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney1 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 2)
         {
-            polylineDimensions[i] = ui -> editPolylinex2 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney2 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex2 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney2 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 3)
         {
-            polylineDimensions[i] = ui -> editPolylinex3 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney3 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex3 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney3 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 4)
         {
-            polylineDimensions[i] = ui -> editPolylinex4 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney4 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex4 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney4 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 5)
         {
-            polylineDimensions[i] = ui -> editPolylinex5 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney5 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex5 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney5 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 6)
         {
-            polylineDimensions[i] = ui -> editPolylinex6 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney6 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex6 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney6 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 7)
         {
-            polylineDimensions[i] = ui -> editPolylinex7 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney7 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex7 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney7 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 8)
         {
-            polylineDimensions[i] = ui -> editPolylinex8 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney8 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex8 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney8 -> value();
             i += 2;
         }
         if(numPolylinePoints >= 9)
         {
-            polylineDimensions[i] = ui -> editPolylinex9 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney9 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex9 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney9 -> value();
             i += 2;
         }
         if(numPolylinePoints == 10)
         {
-            polylineDimensions[i] = ui -> editPolylinex10 -> value();
-            polylineDimensions[i+1] = ui -> editPolyliney10 -> value();
+            polylineDimensions[i] = editPolylineForm -> editPolylinex10 -> value();
+            polylineDimensions[i+1] = editPolylineForm -> editPolyliney10 -> value();
         }
 
         dim::specs *dims = polylineDimensions;
@@ -1171,11 +1588,11 @@ void MainWindow::on_editPolylineSave_clicked()
 
         shapeId = (ui->editShapeID->currentText()).toInt();
 
-        pen.setColor(QColor(ui -> editPolylinePenColor->currentText()));
-        pen.setWidth(ui -> editPolylinePenWidth -> value());
-        pen.setStyle(convertToPenStyle((ui -> editPolylinePenStyle -> currentText()).toStdString()));
-        pen.setCapStyle(convertToPenCapStyle((ui -> editPolylineCapStyle -> currentText()).toStdString()));
-        pen.setJoinStyle(convertToPenJoinStyle((ui -> editPolylineJoinStyle -> currentText()).toStdString()));
+        pen.setColor(QColor(editPolylineForm -> editPolylinePenColor->currentText()));
+        pen.setWidth(editPolylineForm -> editPolylinePenWidth -> value());
+        pen.setStyle(convertToPenStyle((editPolylineForm -> editPolylinePenStyle -> currentText()).toStdString()));
+        pen.setCapStyle(convertToPenCapStyle((editPolylineForm -> editPolylineCapStyle -> currentText()).toStdString()));
+        pen.setJoinStyle(convertToPenJoinStyle((editPolylineForm -> editPolylineJoinStyle -> currentText()).toStdString()));
 
         allShapes.editShape(shapeId, numPolylineSpecs, dims, pen);
 
@@ -1185,21 +1602,25 @@ void MainWindow::on_editPolylineSave_clicked()
     catch(int)
     {
         QMessageBox::warning(this, "Invalid Number of Points", "Please choose a valid number of points (between 2 and 10)", QMessageBox::Ok);
-        ui->editPolylineNumPoints->setCurrentIndex(0);
+        editPolylineForm->editPolylineNumPoints->setCurrentIndex(0);
     }
 }
 
 //! Cancels edit of a polyline
 //! Resets edit polyline form
-void MainWindow::on_editPolylineCancel_clicked()
+void MainWindow::editPolylineCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds a polygon to the shape vector
-void MainWindow::on_polygonSave_clicked()
+void MainWindow::polygonSaveClicked()
 {
-    int numPolygonPoints = ui -> addPolygonNumPoints -> currentIndex();
+    TRACE_SLOT();
+
+    int numPolygonPoints = addPolygonForm -> addPolygonNumPoints -> currentIndex();
 
     int numPolygonSpecs = numPolygonPoints * 2;
     int i{0};
@@ -1207,78 +1628,78 @@ void MainWindow::on_polygonSave_clicked()
 
     if(numPolygonPoints >= 1)
     {
-        polygonDimensions[i] = ui -> addPolygonx1 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony1 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx1 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony1 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 2)
     {
-        polygonDimensions[i] = ui -> addPolygonx2 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony2 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx2 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony2 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 3)
     {
-        polygonDimensions[i] = ui -> addPolygonx3 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony3 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx3 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony3 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 4)
     {
-        polygonDimensions[i] = ui -> addPolygonx4 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony4 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx4 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony4 -> value();
         i += 2;
     }
     if(numPolygonPoints == 5)
     {
-        polygonDimensions[i] = ui -> addPolygonx5 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony5 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx5 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony5 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 6)
     {
-        polygonDimensions[i] = ui -> addPolygonx6 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony6 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx6 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony6 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 7)
     {
-        polygonDimensions[i] = ui -> addPolygonx7 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony7 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx7 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony7 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 8)
     {
-        polygonDimensions[i] = ui -> addPolygonx8 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony8 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx8 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony8 -> value();
         i += 2;
     }
     if(numPolygonPoints >= 9)
     {
-        polygonDimensions[i] = ui -> addPolygonx9 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony9 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx9 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony9 -> value();
         i += 2;
     }
     if(numPolygonPoints == 10)
     {
-        polygonDimensions[i] = ui -> addPolygonx10 -> value();
-        polygonDimensions[i+1] = ui -> addPolygony10 -> value();
+        polygonDimensions[i] = addPolygonForm -> addPolygonx10 -> value();
+        polygonDimensions[i+1] = addPolygonForm -> addPolygony10 -> value();
     }
 
     dim::specs *dims = polygonDimensions;
 
-    Shape* p_Shape = new class::Polygon(allShapes.incrementShapeCount(), SHAPES_LIST[POLYGON], numPolygonSpecs, dims);
+    Shape* p_Shape = new class::Polygon(allShapes.allocateID(), numPolygonSpecs, dims);
     QPen pen;
     QBrush brush;
 
-    pen.setColor(QColor(ui -> addPolygonPenColor->currentText()));
-    pen.setWidth(ui -> addPolygonPenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addPolygonPenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addPolygonCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addPolygonJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addPolygonForm -> addPolygonPenColor->currentText()));
+    pen.setWidth(addPolygonForm -> addPolygonPenWidth -> value());
+    pen.setStyle(convertToPenStyle((addPolygonForm -> addPolygonPenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addPolygonForm -> addPolygonCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addPolygonForm -> addPolygonJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> addPolygonBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> addPolygonBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(addPolygonForm -> addPolygonBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((addPolygonForm -> addPolygonBrushStyle -> currentText().toStdString())));
 
     p_Shape -> setPen(pen);
     p_Shape -> setBrush(brush);
@@ -1290,87 +1711,91 @@ void MainWindow::on_polygonSave_clicked()
 
 //! Cancels addition of a polygon
 //! Resets add polygon form
-void MainWindow::on_polygonCancel_clicked()
+void MainWindow::polygonCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddPolygon();
 }
 
 //! Edits a polygon in the vector
-void MainWindow::on_editPolygonSave_clicked()
+void MainWindow::editPolygonSaveClicked()
 {
+    TRACE_SLOT();
+
     const QString NO_VALUE = "--";
 
     /*! Throws an exception and outputs an error message if user has not selected a number of points for the polygon */
     try
     {
-        if(ui->editPolylineNumPoints->currentText()==NO_VALUE)
+        if(editPolylineForm->editPolylineNumPoints->currentText()==NO_VALUE)
         {
             throw(1);
         }
 
-        int numPolygonPoints = (ui -> editPolygonNumPoints -> currentText().toInt());
+        int numPolygonPoints = (editPolygonForm -> editPolygonNumPoints -> currentText().toInt());
         int numPolygonSpecs = numPolygonPoints * 2;
         int i{0};
         dim::specs polygonDimensions[numPolygonSpecs];
 
         if(numPolygonPoints >= 1)
         {
-            polygonDimensions[i] = ui -> editPolygonx1 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony1 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx1 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony1 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 2)
         {
-            polygonDimensions[i] = ui -> editPolygonx2 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony2 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx2 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony2 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 3)
         {
-            polygonDimensions[i] = ui -> editPolygonx3 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony3 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx3 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony3 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 4)
         {
-            polygonDimensions[i] = ui -> editPolygonx4 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony4 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx4 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony4 -> value();
             i += 2;
         }
         if(numPolygonPoints == 5)
         {
-            polygonDimensions[i] = ui -> editPolygonx5 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony5 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx5 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony5 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 6)
         {
-            polygonDimensions[i] = ui -> editPolygonx6 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony6 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx6 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony6 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 7)
         {
-            polygonDimensions[i] = ui -> editPolygonx7 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony7 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx7 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony7 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 8)
         {
-            polygonDimensions[i] = ui -> editPolygonx8 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony8 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx8 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony8 -> value();
             i += 2;
         }
         if(numPolygonPoints >= 9)
         {
-            polygonDimensions[i] = ui -> editPolygonx9 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony9 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx9 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony9 -> value();
             i += 2;
         }
         if(numPolygonPoints == 10)
         {
-            polygonDimensions[i] = ui -> editPolygonx10 -> value();
-            polygonDimensions[i+1] = ui -> editPolygony10 -> value();
+            polygonDimensions[i] = editPolygonForm -> editPolygonx10 -> value();
+            polygonDimensions[i+1] = editPolygonForm -> editPolygony10 -> value();
         }
 
         dim::specs *dims = polygonDimensions;
@@ -1380,14 +1805,14 @@ void MainWindow::on_editPolygonSave_clicked()
 
         shapeId = (ui->editShapeID->currentText()).toInt();
 
-        pen.setColor(QColor(ui -> editPolygonPenColor->currentText()));
-        pen.setWidth(ui -> editPolygonPenWidth -> value());
-        pen.setStyle(convertToPenStyle((ui -> editPolygonPenStyle -> currentText()).toStdString()));
-        pen.setCapStyle(convertToPenCapStyle((ui -> editPolygonCapStyle -> currentText()).toStdString()));
-        pen.setJoinStyle(convertToPenJoinStyle((ui -> editPolygonJoinStyle -> currentText()).toStdString()));
+        pen.setColor(QColor(editPolygonForm -> editPolygonPenColor->currentText()));
+        pen.setWidth(editPolygonForm -> editPolygonPenWidth -> value());
+        pen.setStyle(convertToPenStyle((editPolygonForm -> editPolygonPenStyle -> currentText()).toStdString()));
+        pen.setCapStyle(convertToPenCapStyle((editPolygonForm -> editPolygonCapStyle -> currentText()).toStdString()));
+        pen.setJoinStyle(convertToPenJoinStyle((editPolygonForm -> editPolygonJoinStyle -> currentText()).toStdString()));
 
-        brush.setColor(QColor(ui -> editPolygonBrushColor -> currentText()));
-        brush.setStyle(convertToBrushStyle((ui -> editPolygonBrushStyle -> currentText().toStdString())));
+        brush.setColor(QColor(editPolygonForm -> editPolygonBrushColor -> currentText()));
+        brush.setStyle(convertToBrushStyle((editPolygonForm -> editPolygonBrushStyle -> currentText().toStdString())));
 
         allShapes.editShape(shapeId, numPolygonSpecs, dims, pen, brush);
 
@@ -1397,40 +1822,44 @@ void MainWindow::on_editPolygonSave_clicked()
     catch(int)
     {
         QMessageBox::warning(this, "Invalid Number of Points", "Please choose a valid number of points (between 3 and 10)", QMessageBox::Ok);
-        ui->editPolygonNumPoints->setCurrentIndex(0);
+        editPolygonForm->editPolygonNumPoints->setCurrentIndex(0);
     }
 }
 
 //! Cancels edit of a polygon
 //! Resets edit polygon form
-void MainWindow::on_editPolygonCancel_clicked()
+void MainWindow::editPolygonCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds a rectangle to the shape vector
-void MainWindow::on_rectangleSave_clicked()
+void MainWindow::rectangleSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs rectangleDimensions[NUM_RECTANGLE_SPECS];
-    rectangleDimensions[int(Rectangle::Specifications::X1)] = ui -> addRectanglex1 -> value();
-    rectangleDimensions[int(Rectangle::Specifications::Y1)] = ui -> addRectangley1 -> value();
-    rectangleDimensions[int(Rectangle::Specifications::W)] = ui -> addRectanglew -> value();
-    rectangleDimensions[int(Rectangle::Specifications::H)] = ui -> addRectangleh -> value();
+    rectangleDimensions[int(Rectangle::Specifications::X1)] = addRectangleForm -> addRectanglex1 -> value();
+    rectangleDimensions[int(Rectangle::Specifications::Y1)] = addRectangleForm -> addRectangley1 -> value();
+    rectangleDimensions[int(Rectangle::Specifications::W)] = addRectangleForm -> addRectanglew -> value();
+    rectangleDimensions[int(Rectangle::Specifications::H)] = addRectangleForm -> addRectangleh -> value();
 
     dim::specs *dims = rectangleDimensions;
 
-    Shape* p_Shape = new class::Rectangle(allShapes.incrementShapeCount(), SHAPES_LIST[RECTANGLE], NUM_RECTANGLE_SPECS, dims);
+    Shape* p_Shape = new class::Rectangle(allShapes.allocateID(), NUM_RECTANGLE_SPECS, dims);
     QPen pen;
     QBrush brush;
 
-    pen.setColor(QColor(ui -> addRectanglePenColor->currentText()));
-    pen.setWidth(ui -> addRectanglePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addRectanglePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addRectangleCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addRectangleJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addRectangleForm -> addRectanglePenColor->currentText()));
+    pen.setWidth(addRectangleForm -> addRectanglePenWidth -> value());
+    pen.setStyle(convertToPenStyle((addRectangleForm -> addRectanglePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addRectangleForm -> addRectangleCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addRectangleForm -> addRectangleJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> addRectangleBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> addRectangleBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(addRectangleForm -> addRectangleBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((addRectangleForm -> addRectangleBrushStyle -> currentText().toStdString())));
 
     p_Shape -> setPen(pen);
     p_Shape -> setBrush(brush);
@@ -1442,19 +1871,23 @@ void MainWindow::on_rectangleSave_clicked()
 
 //! Cancels addition of a rectangle
 //! Resets add rectangle form
-void MainWindow::on_rectangleCancel_clicked()
+void MainWindow::rectangleCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddRectangle();
 }
 
 //! Edits a rectangle in the shape vector
-void MainWindow::on_editRectangleSave_clicked()
+void MainWindow::editRectangleSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs rectangleDimensions[NUM_RECTANGLE_SPECS];
-    rectangleDimensions[int(Rectangle::Specifications::X1)] = ui -> editRectanglex1 -> value();
-    rectangleDimensions[int(Rectangle::Specifications::Y1)] = ui -> editRectangley1 -> value();
-    rectangleDimensions[int(Rectangle::Specifications::W)] = ui -> editRectanglew -> value();
-    rectangleDimensions[int(Rectangle::Specifications::H)] = ui -> editRectangleh -> value();
+    rectangleDimensions[int(Rectangle::Specifications::X1)] = editRectangleForm -> editRectanglex1 -> value();
+    rectangleDimensions[int(Rectangle::Specifications::Y1)] = editRectangleForm -> editRectangley1 -> value();
+    rectangleDimensions[int(Rectangle::Specifications::W)] = editRectangleForm -> editRectanglew -> value();
+    rectangleDimensions[int(Rectangle::Specifications::H)] = editRectangleForm -> editRectangleh -> value();
 
     dim::specs *dims = rectangleDimensions;
     int shapeId;
@@ -1463,14 +1896,14 @@ void MainWindow::on_editRectangleSave_clicked()
 
     shapeId = (ui->editShapeID->currentText()).toInt();
 
-    pen.setColor(QColor(ui -> editRectanglePenColor->currentText()));
-    pen.setWidth(ui -> editRectanglePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> editRectanglePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> editRectangleCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> editRectangleJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(editRectangleForm -> editRectanglePenColor->currentText()));
+    pen.setWidth(editRectangleForm -> editRectanglePenWidth -> value());
+    pen.setStyle(convertToPenStyle((editRectangleForm -> editRectanglePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((editRectangleForm -> editRectangleCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((editRectangleForm -> editRectangleJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> editRectangleBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> editRectangleBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(editRectangleForm -> editRectangleBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((editRectangleForm -> editRectangleBrushStyle -> currentText().toStdString())));
 
     allShapes.editShape(shapeId, NUM_RECTANGLE_SPECS, dims, pen, brush);
     QMessageBox::information(this, "Edit Successful", "Rectangle Updated\nChanges are now visible", QMessageBox::Ok);
@@ -1480,33 +1913,37 @@ void MainWindow::on_editRectangleSave_clicked()
 
 //! Cancels edit of a rectangle
 //! Resets edit rectangle form
-void MainWindow::on_editRectangleCancel_clicked()
+void MainWindow::editRectangleCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds a square to the shape vector
-void MainWindow::on_squareSave_clicked()
+void MainWindow::squareSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs squareDimensions[NUM_SQUARE_SPECS];
-    squareDimensions[int(Square::Specifications::X1)] = ui -> addSquarex1 -> value();
-    squareDimensions[int(Square::Specifications::Y1)] = ui -> addSquarey1 -> value();
-    squareDimensions[int(Square::Specifications::L)] = ui -> addSquarel -> value();
+    squareDimensions[int(Square::Specifications::X1)] = addSquareForm -> addSquarex1 -> value();
+    squareDimensions[int(Square::Specifications::Y1)] = addSquareForm -> addSquarey1 -> value();
+    squareDimensions[int(Square::Specifications::L)] = addSquareForm -> addSquarel -> value();
 
     dim::specs *dims = squareDimensions;
 
-    Shape* p_Shape = new class::Square(allShapes.incrementShapeCount(), SHAPES_LIST[SQUARE], NUM_SQUARE_SPECS, dims);
+    Shape* p_Shape = new class::Square(allShapes.allocateID(), NUM_SQUARE_SPECS, dims);
     QPen pen;
     QBrush brush;
 
-    pen.setColor(QColor(ui -> addSquarePenColor->currentText()));
-    pen.setWidth(ui -> addSquarePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addSquarePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addSquareCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addSquareJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addSquareForm -> addSquarePenColor->currentText()));
+    pen.setWidth(addSquareForm -> addSquarePenWidth -> value());
+    pen.setStyle(convertToPenStyle((addSquareForm -> addSquarePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addSquareForm -> addSquareCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addSquareForm -> addSquareJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> addSquareBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> addSquareBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(addSquareForm -> addSquareBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((addSquareForm -> addSquareBrushStyle -> currentText().toStdString())));
 
     p_Shape -> setPen(pen);
     p_Shape -> setBrush(brush);
@@ -1518,18 +1955,22 @@ void MainWindow::on_squareSave_clicked()
 
 //! Cancels addition of a square
 //! Resets add square form
-void MainWindow::on_squareCancel_clicked()
+void MainWindow::squareCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddSquare();
 }
 
 //! Edits a square in the shape vector
-void MainWindow::on_editSquareSave_clicked()
+void MainWindow::editSquareSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs squareDimensions[NUM_SQUARE_SPECS];
-    squareDimensions[int(Square::Specifications::X1)] = ui -> editSquarex1 -> value();
-    squareDimensions[int(Square::Specifications::Y1)] = ui -> editSquarey1 -> value();
-    squareDimensions[int(Square::Specifications::L)] = ui -> editSquarel -> value();
+    squareDimensions[int(Square::Specifications::X1)] = editSquareForm -> editSquarex1 -> value();
+    squareDimensions[int(Square::Specifications::Y1)] = editSquareForm -> editSquarey1 -> value();
+    squareDimensions[int(Square::Specifications::L)] = editSquareForm -> editSquarel -> value();
 
     dim::specs *dims = squareDimensions;
     int shapeId;
@@ -1538,14 +1979,14 @@ void MainWindow::on_editSquareSave_clicked()
 
     shapeId = (ui->editShapeID->currentText()).toInt();
 
-    pen.setColor(QColor(ui -> editSquarePenColor->currentText()));
-    pen.setWidth(ui -> editSquarePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> editSquarePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> editSquareCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> editSquareJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(editSquareForm -> editSquarePenColor->currentText()));
+    pen.setWidth(editSquareForm -> editSquarePenWidth -> value());
+    pen.setStyle(convertToPenStyle((editSquareForm -> editSquarePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((editSquareForm -> editSquareCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((editSquareForm -> editSquareJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> editSquareBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> editSquareBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(editSquareForm -> editSquareBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((editSquareForm -> editSquareBrushStyle -> currentText().toStdString())));
 
     allShapes.editShape(shapeId, NUM_SQUARE_SPECS, dims, pen, brush);
 
@@ -1555,34 +1996,38 @@ void MainWindow::on_editSquareSave_clicked()
 
 //! Cancels edit of a square
 //! Resets edit square form
-void MainWindow::on_editSquareCancel_clicked()
+void MainWindow::editSquareCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds an ellipse to the shape vector
-void MainWindow::on_ellipseSave_clicked()
+void MainWindow::ellipseSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs ellipseDimensions[NUM_ELLIPSE_SPECS];
-    ellipseDimensions[int(Ellipse::Specifications::X1)] = ui -> addEllipsex1 -> value();
-    ellipseDimensions[int(Ellipse::Specifications::Y1)] = ui -> addEllipsey1 -> value();
-    ellipseDimensions[int(Ellipse::Specifications::A)] = ui -> addEllipsea -> value();
-    ellipseDimensions[int(Ellipse::Specifications::B)] = ui -> addEllipseb -> value();
+    ellipseDimensions[int(Ellipse::Specifications::X1)] = addEllipseForm -> addEllipsex1 -> value();
+    ellipseDimensions[int(Ellipse::Specifications::Y1)] = addEllipseForm -> addEllipsey1 -> value();
+    ellipseDimensions[int(Ellipse::Specifications::A)] = addEllipseForm -> addEllipsea -> value();
+    ellipseDimensions[int(Ellipse::Specifications::B)] = addEllipseForm -> addEllipseb -> value();
 
     dim::specs *dims = ellipseDimensions;
 
-    Shape* p_Shape = new class::Ellipse(allShapes.incrementShapeCount(), SHAPES_LIST[ELLIPSE], NUM_ELLIPSE_SPECS, dims);
+    Shape* p_Shape = new class::Ellipse(allShapes.allocateID(), NUM_ELLIPSE_SPECS, dims);
     QPen pen;
     QBrush brush;
 
-    pen.setColor(QColor(ui -> addEllipsePenColor->currentText()));
-    pen.setWidth(ui -> addEllipsePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addEllipsePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addEllipseCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addEllipseJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addEllipseForm -> addEllipsePenColor->currentText()));
+    pen.setWidth(addEllipseForm -> addEllipsePenWidth -> value());
+    pen.setStyle(convertToPenStyle((addEllipseForm -> addEllipsePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addEllipseForm -> addEllipseCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addEllipseForm -> addEllipseJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> addEllipseBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> addEllipseBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(addEllipseForm -> addEllipseBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((addEllipseForm -> addEllipseBrushStyle -> currentText().toStdString())));
 
     p_Shape -> setPen(pen);
     p_Shape -> setBrush(brush);
@@ -1594,19 +2039,23 @@ void MainWindow::on_ellipseSave_clicked()
 
 //! Cancels addition of an ellipse
 //! Resets add ellipse form
-void MainWindow::on_ellipseCancel_clicked()
+void MainWindow::ellipseCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddEllipse();
 }
 
 //! Edits an ellipse in the shape vector
-void MainWindow::on_editEllipseSave_clicked()
+void MainWindow::editEllipseSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs ellipseDimensions[NUM_ELLIPSE_SPECS];
-    ellipseDimensions[int(Ellipse::Specifications::X1)] = ui -> editEllipsex1 -> value();
-    ellipseDimensions[int(Ellipse::Specifications::Y1)] = ui -> editEllipsey1 -> value();
-    ellipseDimensions[int(Ellipse::Specifications::A)] = ui -> editEllipsea -> value();
-    ellipseDimensions[int(Ellipse::Specifications::B)] = ui -> editEllipseb -> value();
+    ellipseDimensions[int(Ellipse::Specifications::X1)] = editEllipseForm -> editEllipsex1 -> value();
+    ellipseDimensions[int(Ellipse::Specifications::Y1)] = editEllipseForm -> editEllipsey1 -> value();
+    ellipseDimensions[int(Ellipse::Specifications::A)] = editEllipseForm -> editEllipsea -> value();
+    ellipseDimensions[int(Ellipse::Specifications::B)] = editEllipseForm -> editEllipseb -> value();
 
     dim::specs *dims = ellipseDimensions;
 
@@ -1616,14 +2065,14 @@ void MainWindow::on_editEllipseSave_clicked()
 
     shapeId = (ui->editShapeID->currentText()).toInt();
 
-    pen.setColor(QColor(ui -> editEllipsePenColor->currentText()));
-    pen.setWidth(ui -> editEllipsePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> editEllipsePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> editEllipseCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> editEllipseJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(editEllipseForm -> editEllipsePenColor->currentText()));
+    pen.setWidth(editEllipseForm -> editEllipsePenWidth -> value());
+    pen.setStyle(convertToPenStyle((editEllipseForm -> editEllipsePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((editEllipseForm -> editEllipseCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((editEllipseForm -> editEllipseJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> editEllipseBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> editEllipseBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(editEllipseForm -> editEllipseBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((editEllipseForm -> editEllipseBrushStyle -> currentText().toStdString())));
 
     allShapes.editShape(shapeId, NUM_ELLIPSE_SPECS, dims, pen, brush);
 
@@ -1633,33 +2082,37 @@ void MainWindow::on_editEllipseSave_clicked()
 
 //! Cancels edit of an ellipse
 //! Resets edit ellipse form
-void MainWindow::on_editEllipseCancel_clicked()
+void MainWindow::editEllipseCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds a circle to the shape vector
-void MainWindow::on_circleSave_clicked()
+void MainWindow::circleSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs circleDimensions[NUM_CIRCLE_SPECS];
-    circleDimensions[int(Circle::Specifications::X1)] = ui -> addCirclex1 -> value();
-    circleDimensions[int(Circle::Specifications::Y1)] = ui -> addCircley1 -> value();
-    circleDimensions[int(Circle::Specifications::RADIUS)] = ui -> addCircler -> value();
+    circleDimensions[int(Circle::Specifications::X1)] = addCircleForm -> addCirclex1 -> value();
+    circleDimensions[int(Circle::Specifications::Y1)] = addCircleForm -> addCircley1 -> value();
+    circleDimensions[int(Circle::Specifications::RADIUS)] = addCircleForm -> addCircler -> value();
 
     dim::specs *dims = circleDimensions;
 
-    Shape* p_Shape = new class::Circle(allShapes.incrementShapeCount(), SHAPES_LIST[CIRCLE], NUM_CIRCLE_SPECS, dims);
+    Shape* p_Shape = new class::Circle(allShapes.allocateID(), NUM_CIRCLE_SPECS, dims);
     QPen pen;
     QBrush brush;
 
-    pen.setColor(QColor(ui -> addCirclePenColor->currentText()));
-    pen.setWidth(ui -> addCirclePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> addCirclePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> addCircleCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> addCircleJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(addCircleForm -> addCirclePenColor->currentText()));
+    pen.setWidth(addCircleForm -> addCirclePenWidth -> value());
+    pen.setStyle(convertToPenStyle((addCircleForm -> addCirclePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((addCircleForm -> addCircleCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((addCircleForm -> addCircleJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> addCircleBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> addCircleBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(addCircleForm -> addCircleBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((addCircleForm -> addCircleBrushStyle -> currentText().toStdString())));
 
     p_Shape -> setPen(pen);
     p_Shape -> setBrush(brush);
@@ -1671,18 +2124,22 @@ void MainWindow::on_circleSave_clicked()
 
 //! Cancels addition of a circle
 //! Resets add circle form
-void MainWindow::on_circleCancel_clicked()
+void MainWindow::circleCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddCircle();
 }
 
 //! Edits a circle in the shape vector
-void MainWindow::on_editCircleSave_clicked()
+void MainWindow::editCircleSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs circleDimensions[NUM_CIRCLE_SPECS];
-    circleDimensions[int(Circle::Specifications::X1)] = ui -> editCirclex1 -> value();
-    circleDimensions[int(Circle::Specifications::Y1)] = ui -> editCircley1 -> value();
-    circleDimensions[int(Circle::Specifications::RADIUS)] = ui -> editCircler -> value();
+    circleDimensions[int(Circle::Specifications::X1)] = editCircleForm -> editCirclex1 -> value();
+    circleDimensions[int(Circle::Specifications::Y1)] = editCircleForm -> editCircley1 -> value();
+    circleDimensions[int(Circle::Specifications::RADIUS)] = editCircleForm -> editCircler -> value();
 
     dim::specs *dims = circleDimensions;
 
@@ -1692,14 +2149,14 @@ void MainWindow::on_editCircleSave_clicked()
 
     shapeId = (ui->editShapeID->currentText()).toInt();
 
-    pen.setColor(QColor(ui -> editCirclePenColor->currentText()));
-    pen.setWidth(ui -> editCirclePenWidth -> value());
-    pen.setStyle(convertToPenStyle((ui -> editCirclePenStyle -> currentText()).toStdString()));
-    pen.setCapStyle(convertToPenCapStyle((ui -> editCircleCapStyle -> currentText()).toStdString()));
-    pen.setJoinStyle(convertToPenJoinStyle((ui -> editCircleJoinStyle -> currentText()).toStdString()));
+    pen.setColor(QColor(editCircleForm -> editCirclePenColor->currentText()));
+    pen.setWidth(editCircleForm -> editCirclePenWidth -> value());
+    pen.setStyle(convertToPenStyle((editCircleForm -> editCirclePenStyle -> currentText()).toStdString()));
+    pen.setCapStyle(convertToPenCapStyle((editCircleForm -> editCircleCapStyle -> currentText()).toStdString()));
+    pen.setJoinStyle(convertToPenJoinStyle((editCircleForm -> editCircleJoinStyle -> currentText()).toStdString()));
 
-    brush.setColor(QColor(ui -> editCircleBrushColor -> currentText()));
-    brush.setStyle(convertToBrushStyle((ui -> editCircleBrushStyle -> currentText().toStdString())));
+    brush.setColor(QColor(editCircleForm -> editCircleBrushColor -> currentText()));
+    brush.setStyle(convertToBrushStyle((editCircleForm -> editCircleBrushStyle -> currentText().toStdString())));
 
     allShapes.editShape(shapeId, NUM_CIRCLE_SPECS, dims, pen, brush);
 
@@ -1709,35 +2166,39 @@ void MainWindow::on_editCircleSave_clicked()
 
 //! Cancels edit of a circle
 //! Resets edit circle form
-void MainWindow::on_editCircleCancel_clicked()
+void MainWindow::editCircleCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Adds a text box to the shape vector
-void MainWindow::on_textSave_clicked()
+void MainWindow::textSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs textDimensions[NUM_TEXT_SPECS];
-    textDimensions[int(Text::Specifications::X1)] = ui -> addTextx1 -> value();
-    textDimensions[int(Text::Specifications::Y1)] = ui -> addTexty1 -> value();
-    textDimensions[int(Text::Specifications::W)] = ui -> addTextw -> value();
-    textDimensions[int(Text::Specifications::H)] = ui -> addTexth -> value();
+    textDimensions[int(Text::Specifications::X1)] = addTextForm -> addTextx1 -> value();
+    textDimensions[int(Text::Specifications::Y1)] = addTextForm -> addTexty1 -> value();
+    textDimensions[int(Text::Specifications::W)] = addTextForm -> addTextw -> value();
+    textDimensions[int(Text::Specifications::H)] = addTextForm -> addTexth -> value();
 
     dim::specs *dims = textDimensions;
 
     QPen pen;
     QFont font;
-    Qt::AlignmentFlag alignFlag = convertToAlignmentFlag((ui -> addTextAlignment -> currentText()).toStdString());
-    std::string newText = (ui -> addTexttext -> text()).toStdString();
+    Qt::AlignmentFlag alignFlag = convertToAlignmentFlag((addTextForm -> addTextAlignment -> currentText()).toStdString());
+    std::string newText = (addTextForm -> addTexttext -> text()).toStdString();
 
-    pen.setColor(QColor(ui -> addTextColor -> currentText()));
+    pen.setColor(QColor(addTextForm -> addTextColor -> currentText()));
 
-    font.setPointSize(ui -> addTextSize -> value());
-    font.setFamily(ui -> addTextFontFamily -> currentText());
-    font.setWeight(convertToQFontWeight((ui -> addTextFontWeight -> currentText()).toStdString()));
-    font.setStyle(convertToQFontStyle((ui -> addTextFontStyle -> currentText()).toStdString()));
+    font.setPointSize(addTextForm -> addTextSize -> value());
+    font.setFamily(addTextForm -> addTextFontFamily -> currentText());
+    font.setWeight(convertToQFontWeight((addTextForm -> addTextFontWeight -> currentText()).toStdString()));
+    font.setStyle(convertToQFontStyle((addTextForm -> addTextFontStyle -> currentText()).toStdString()));
 
-    Shape* p_Shape = new class::Text(allShapes.incrementShapeCount(), SHAPES_LIST[TEXT], NUM_TEXT_SPECS, dims, font, newText, alignFlag);
+    Shape* p_Shape = new class::Text(allShapes.allocateID(), NUM_TEXT_SPECS, dims, font, newText, alignFlag);
 
     p_Shape -> setPen(pen);
     allShapes.newShape(p_Shape);
@@ -1748,19 +2209,23 @@ void MainWindow::on_textSave_clicked()
 
 //! Cancels addition of a text box
 //! Resets text form
-void MainWindow::on_textCancel_clicked()
+void MainWindow::textCancelClicked()
 {
+    TRACE_SLOT();
+
     clearAddText();
 }
 
 //! Edits a text item in the shape vector
-void MainWindow::on_editTextSave_clicked()
+void MainWindow::editTextSaveClicked()
 {
+    TRACE_SLOT();
+
     dim::specs textDimensions[NUM_TEXT_SPECS];
-    textDimensions[int(Text::Specifications::X1)] = ui -> editTextx1 -> value();
-    textDimensions[int(Text::Specifications::Y1)] = ui -> editTexty1 -> value();
-    textDimensions[int(Text::Specifications::W)] = ui -> editTextw -> value();
-    textDimensions[int(Text::Specifications::H)] = ui -> editTexth -> value();
+    textDimensions[int(Text::Specifications::X1)] = editTextForm -> editTextx1 -> value();
+    textDimensions[int(Text::Specifications::Y1)] = editTextForm -> editTexty1 -> value();
+    textDimensions[int(Text::Specifications::W)] = editTextForm -> editTextw -> value();
+    textDimensions[int(Text::Specifications::H)] = editTextForm -> editTexth -> value();
 
     dim::specs *dims = textDimensions;
 
@@ -1769,15 +2234,15 @@ void MainWindow::on_editTextSave_clicked()
     QFont font;
 
     shapeId = (ui->editShapeID->currentText()).toInt();
-    Qt::AlignmentFlag alignFlag = convertToAlignmentFlag((ui -> editTextAlignment -> currentText()).toStdString());
-    std::string newText = (ui -> editTexttext -> text()).toStdString();
+    Qt::AlignmentFlag alignFlag = convertToAlignmentFlag((editTextForm -> editTextAlignment -> currentText()).toStdString());
+    std::string newText = (editTextForm -> editTexttext -> text()).toStdString();
 
-    pen.setColor(QColor(ui -> editTextColor -> currentText()));
+    pen.setColor(QColor(editTextForm -> editTextColor -> currentText()));
 
-    font.setPointSize(ui -> editTextSize -> value());
-    font.setFamily(ui -> editTextFontFamily -> currentText());
-    font.setWeight(convertToQFontWeight((ui -> editTextFontWeight -> currentText()).toStdString()));
-    font.setStyle(convertToQFontStyle((ui -> editTextFontStyle -> currentText()).toStdString()));
+    font.setPointSize(editTextForm -> editTextSize -> value());
+    font.setFamily(editTextForm -> editTextFontFamily -> currentText());
+    font.setWeight(convertToQFontWeight((editTextForm -> editTextFontWeight -> currentText()).toStdString()));
+    font.setStyle(convertToQFontStyle((editTextForm -> editTextFontStyle -> currentText()).toStdString()));
 
     allShapes.editShape(shapeId, NUM_TEXT_SPECS, dims, pen, font, alignFlag, newText);
 
@@ -1787,282 +2252,286 @@ void MainWindow::on_editTextSave_clicked()
 
 //! Cancels edit of a text box
 //! Resets edit text form
-void MainWindow::on_editTextCancel_clicked()
+void MainWindow::editTextCancelClicked()
 {
+    TRACE_SLOT();
+
     setCurrentShapeInfo();
 }
 
 //! Updates the canvas with the updated shape vector
 void MainWindow::on_updateButton_clicked()
 {
+    TRACE_SLOT();
+
     ui -> renderArea -> getShapes(allShapes.getVector());
-    ui -> editShapeID -> clear();
-    ui -> deleteShapeID -> clear();
-    ui -> editShapeID -> addItems(set_getShapeIds());
-    ui -> deleteShapeID -> addItems(set_getShapeIds());
     updateShapeTables();
 
     ui -> addShapeType -> clearEditText();
 }
 
 //! Enables/disables add polyline spin boxes depending on how many points the user chooses the polyline to have
-void MainWindow::on_addPolylineNumPoints_currentIndexChanged(int index)
+void MainWindow::addPolylineNumPointsChanged(int index)
 {
+    TRACE_SLOT();
+
     disablePolylineSpinBoxes();
 
     switch(index)
     {
     case 0: break;
-    case 1: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
+    case 1: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
         break;
-    case 2: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
+    case 2: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
         break;
-    case 3: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
+    case 3: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
         break;
-    case 4: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
+    case 4: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
         break;
-    case 5: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
-            ui -> addPolylinex5 -> setEnabled(true);
-            ui -> addPolyliney5 -> setEnabled(true);
+    case 5: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
+            addPolylineForm -> addPolylinex5 -> setEnabled(true);
+            addPolylineForm -> addPolyliney5 -> setEnabled(true);
         break;
-    case 6: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
-            ui -> addPolylinex5 -> setEnabled(true);
-            ui -> addPolyliney5 -> setEnabled(true);
-            ui -> addPolylinex6 -> setEnabled(true);
-            ui -> addPolyliney6 -> setEnabled(true);
+    case 6: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
+            addPolylineForm -> addPolylinex5 -> setEnabled(true);
+            addPolylineForm -> addPolyliney5 -> setEnabled(true);
+            addPolylineForm -> addPolylinex6 -> setEnabled(true);
+            addPolylineForm -> addPolyliney6 -> setEnabled(true);
         break;
-    case 7: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
-            ui -> addPolylinex5 -> setEnabled(true);
-            ui -> addPolyliney5 -> setEnabled(true);
-            ui -> addPolylinex6 -> setEnabled(true);
-            ui -> addPolyliney6 -> setEnabled(true);
-            ui -> addPolylinex7 -> setEnabled(true);
-            ui -> addPolyliney7 -> setEnabled(true);
+    case 7: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
+            addPolylineForm -> addPolylinex5 -> setEnabled(true);
+            addPolylineForm -> addPolyliney5 -> setEnabled(true);
+            addPolylineForm -> addPolylinex6 -> setEnabled(true);
+            addPolylineForm -> addPolyliney6 -> setEnabled(true);
+            addPolylineForm -> addPolylinex7 -> setEnabled(true);
+            addPolylineForm -> addPolyliney7 -> setEnabled(true);
         break;
-    case 8: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
-            ui -> addPolylinex5 -> setEnabled(true);
-            ui -> addPolyliney5 -> setEnabled(true);
-            ui -> addPolylinex6 -> setEnabled(true);
-            ui -> addPolyliney6 -> setEnabled(true);
-            ui -> addPolylinex7 -> setEnabled(true);
-            ui -> addPolyliney7 -> setEnabled(true);
-            ui -> addPolylinex8 -> setEnabled(true);
-            ui -> addPolyliney8 -> setEnabled(true);
+    case 8: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
+            addPolylineForm -> addPolylinex5 -> setEnabled(true);
+            addPolylineForm -> addPolyliney5 -> setEnabled(true);
+            addPolylineForm -> addPolylinex6 -> setEnabled(true);
+            addPolylineForm -> addPolyliney6 -> setEnabled(true);
+            addPolylineForm -> addPolylinex7 -> setEnabled(true);
+            addPolylineForm -> addPolyliney7 -> setEnabled(true);
+            addPolylineForm -> addPolylinex8 -> setEnabled(true);
+            addPolylineForm -> addPolyliney8 -> setEnabled(true);
         break;
-    case 9: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
-            ui -> addPolylinex5 -> setEnabled(true);
-            ui -> addPolyliney5 -> setEnabled(true);
-            ui -> addPolylinex6 -> setEnabled(true);
-            ui -> addPolyliney6 -> setEnabled(true);
-            ui -> addPolylinex7 -> setEnabled(true);
-            ui -> addPolyliney7 -> setEnabled(true);
-            ui -> addPolylinex8 -> setEnabled(true);
-            ui -> addPolyliney8 -> setEnabled(true);
-            ui -> addPolylinex9 -> setEnabled(true);
-            ui -> addPolyliney9 -> setEnabled(true);
+    case 9: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
+            addPolylineForm -> addPolylinex5 -> setEnabled(true);
+            addPolylineForm -> addPolyliney5 -> setEnabled(true);
+            addPolylineForm -> addPolylinex6 -> setEnabled(true);
+            addPolylineForm -> addPolyliney6 -> setEnabled(true);
+            addPolylineForm -> addPolylinex7 -> setEnabled(true);
+            addPolylineForm -> addPolyliney7 -> setEnabled(true);
+            addPolylineForm -> addPolylinex8 -> setEnabled(true);
+            addPolylineForm -> addPolyliney8 -> setEnabled(true);
+            addPolylineForm -> addPolylinex9 -> setEnabled(true);
+            addPolylineForm -> addPolyliney9 -> setEnabled(true);
         break;
-    case 10: ui -> addPolylinex1 -> setEnabled(true);
-            ui -> addPolyliney1 -> setEnabled(true);
-            ui -> addPolylinex2 -> setEnabled(true);
-            ui -> addPolyliney2 -> setEnabled(true);
-            ui -> addPolylinex3 -> setEnabled(true);
-            ui -> addPolyliney3 -> setEnabled(true);
-            ui -> addPolylinex4 -> setEnabled(true);
-            ui -> addPolyliney4 -> setEnabled(true);
-            ui -> addPolylinex5 -> setEnabled(true);
-            ui -> addPolyliney5 -> setEnabled(true);
-            ui -> addPolylinex6 -> setEnabled(true);
-            ui -> addPolyliney6 -> setEnabled(true);
-            ui -> addPolylinex7 -> setEnabled(true);
-            ui -> addPolyliney7 -> setEnabled(true);
-            ui -> addPolylinex8 -> setEnabled(true);
-            ui -> addPolyliney8 -> setEnabled(true);
-            ui -> addPolylinex9 -> setEnabled(true);
-            ui -> addPolyliney9 -> setEnabled(true);
-            ui -> addPolylinex10 -> setEnabled(true);
-            ui -> addPolyliney10 -> setEnabled(true);
+    case 10: addPolylineForm -> addPolylinex1 -> setEnabled(true);
+            addPolylineForm -> addPolyliney1 -> setEnabled(true);
+            addPolylineForm -> addPolylinex2 -> setEnabled(true);
+            addPolylineForm -> addPolyliney2 -> setEnabled(true);
+            addPolylineForm -> addPolylinex3 -> setEnabled(true);
+            addPolylineForm -> addPolyliney3 -> setEnabled(true);
+            addPolylineForm -> addPolylinex4 -> setEnabled(true);
+            addPolylineForm -> addPolyliney4 -> setEnabled(true);
+            addPolylineForm -> addPolylinex5 -> setEnabled(true);
+            addPolylineForm -> addPolyliney5 -> setEnabled(true);
+            addPolylineForm -> addPolylinex6 -> setEnabled(true);
+            addPolylineForm -> addPolyliney6 -> setEnabled(true);
+            addPolylineForm -> addPolylinex7 -> setEnabled(true);
+            addPolylineForm -> addPolyliney7 -> setEnabled(true);
+            addPolylineForm -> addPolylinex8 -> setEnabled(true);
+            addPolylineForm -> addPolyliney8 -> setEnabled(true);
+            addPolylineForm -> addPolylinex9 -> setEnabled(true);
+            addPolylineForm -> addPolyliney9 -> setEnabled(true);
+            addPolylineForm -> addPolylinex10 -> setEnabled(true);
+            addPolylineForm -> addPolyliney10 -> setEnabled(true);
         break;
     }
 }
 
 //! Enables/disables add polygon spin boxes depending on how many points the user chooses the polygon to have
-void MainWindow::on_addPolygonNumPoints_currentIndexChanged(int index)
+void MainWindow::addPolygonNumPointsChanged(int index)
 {
+    TRACE_SLOT();
+
     disablePolygonSpinBoxes();
 
     switch(index)
     {
     case 0: break;
-    case 1: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
+    case 1: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
         break;
-    case 2: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
+    case 2: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
         break;
-    case 3: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
+    case 3: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
         break;
-    case 4: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
+    case 4: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
         break;
-    case 5: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
-            ui -> addPolygonx5 -> setEnabled(true);
-            ui -> addPolygony5 -> setEnabled(true);
+    case 5: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
+            addPolygonForm -> addPolygonx5 -> setEnabled(true);
+            addPolygonForm -> addPolygony5 -> setEnabled(true);
         break;
-    case 6: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
-            ui -> addPolygonx5 -> setEnabled(true);
-            ui -> addPolygony5 -> setEnabled(true);
-            ui -> addPolygonx6 -> setEnabled(true);
-            ui -> addPolygony6 -> setEnabled(true);
+    case 6: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
+            addPolygonForm -> addPolygonx5 -> setEnabled(true);
+            addPolygonForm -> addPolygony5 -> setEnabled(true);
+            addPolygonForm -> addPolygonx6 -> setEnabled(true);
+            addPolygonForm -> addPolygony6 -> setEnabled(true);
         break;
-    case 7: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
-            ui -> addPolygonx5 -> setEnabled(true);
-            ui -> addPolygony5 -> setEnabled(true);
-            ui -> addPolygonx6 -> setEnabled(true);
-            ui -> addPolygony6 -> setEnabled(true);
-            ui -> addPolygonx7 -> setEnabled(true);
-            ui -> addPolygony7 -> setEnabled(true);
+    case 7: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
+            addPolygonForm -> addPolygonx5 -> setEnabled(true);
+            addPolygonForm -> addPolygony5 -> setEnabled(true);
+            addPolygonForm -> addPolygonx6 -> setEnabled(true);
+            addPolygonForm -> addPolygony6 -> setEnabled(true);
+            addPolygonForm -> addPolygonx7 -> setEnabled(true);
+            addPolygonForm -> addPolygony7 -> setEnabled(true);
         break;
-    case 8: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
-            ui -> addPolygonx5 -> setEnabled(true);
-            ui -> addPolygony5 -> setEnabled(true);
-            ui -> addPolygonx6 -> setEnabled(true);
-            ui -> addPolygony6 -> setEnabled(true);
-            ui -> addPolygonx7 -> setEnabled(true);
-            ui -> addPolygony7 -> setEnabled(true);
-            ui -> addPolygonx8 -> setEnabled(true);
-            ui -> addPolygony8 -> setEnabled(true);
+    case 8: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
+            addPolygonForm -> addPolygonx5 -> setEnabled(true);
+            addPolygonForm -> addPolygony5 -> setEnabled(true);
+            addPolygonForm -> addPolygonx6 -> setEnabled(true);
+            addPolygonForm -> addPolygony6 -> setEnabled(true);
+            addPolygonForm -> addPolygonx7 -> setEnabled(true);
+            addPolygonForm -> addPolygony7 -> setEnabled(true);
+            addPolygonForm -> addPolygonx8 -> setEnabled(true);
+            addPolygonForm -> addPolygony8 -> setEnabled(true);
         break;
-    case 9: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
-            ui -> addPolygonx5 -> setEnabled(true);
-            ui -> addPolygony5 -> setEnabled(true);
-            ui -> addPolygonx6 -> setEnabled(true);
-            ui -> addPolygony6 -> setEnabled(true);
-            ui -> addPolygonx7 -> setEnabled(true);
-            ui -> addPolygony7 -> setEnabled(true);
-            ui -> addPolygonx8 -> setEnabled(true);
-            ui -> addPolygony8 -> setEnabled(true);
-            ui -> addPolygonx9 -> setEnabled(true);
-            ui -> addPolygony9 -> setEnabled(true);
+    case 9: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
+            addPolygonForm -> addPolygonx5 -> setEnabled(true);
+            addPolygonForm -> addPolygony5 -> setEnabled(true);
+            addPolygonForm -> addPolygonx6 -> setEnabled(true);
+            addPolygonForm -> addPolygony6 -> setEnabled(true);
+            addPolygonForm -> addPolygonx7 -> setEnabled(true);
+            addPolygonForm -> addPolygony7 -> setEnabled(true);
+            addPolygonForm -> addPolygonx8 -> setEnabled(true);
+            addPolygonForm -> addPolygony8 -> setEnabled(true);
+            addPolygonForm -> addPolygonx9 -> setEnabled(true);
+            addPolygonForm -> addPolygony9 -> setEnabled(true);
         break;
-    case 10: ui -> addPolygonx1 -> setEnabled(true);
-            ui -> addPolygony1 -> setEnabled(true);
-            ui -> addPolygonx2 -> setEnabled(true);
-            ui -> addPolygony2 -> setEnabled(true);
-            ui -> addPolygonx3 -> setEnabled(true);
-            ui -> addPolygony3 -> setEnabled(true);
-            ui -> addPolygonx4 -> setEnabled(true);
-            ui -> addPolygony4 -> setEnabled(true);
-            ui -> addPolygonx5 -> setEnabled(true);
-            ui -> addPolygony5 -> setEnabled(true);
-            ui -> addPolygonx6 -> setEnabled(true);
-            ui -> addPolygony6 -> setEnabled(true);
-            ui -> addPolygonx7 -> setEnabled(true);
-            ui -> addPolygony7 -> setEnabled(true);
-            ui -> addPolygonx8 -> setEnabled(true);
-            ui -> addPolygony8 -> setEnabled(true);
-            ui -> addPolygonx9 -> setEnabled(true);
-            ui -> addPolygony9 -> setEnabled(true);
-            ui -> addPolygonx10 -> setEnabled(true);
-            ui -> addPolygony10 -> setEnabled(true);
+    case 10: addPolygonForm -> addPolygonx1 -> setEnabled(true);
+            addPolygonForm -> addPolygony1 -> setEnabled(true);
+            addPolygonForm -> addPolygonx2 -> setEnabled(true);
+            addPolygonForm -> addPolygony2 -> setEnabled(true);
+            addPolygonForm -> addPolygonx3 -> setEnabled(true);
+            addPolygonForm -> addPolygony3 -> setEnabled(true);
+            addPolygonForm -> addPolygonx4 -> setEnabled(true);
+            addPolygonForm -> addPolygony4 -> setEnabled(true);
+            addPolygonForm -> addPolygonx5 -> setEnabled(true);
+            addPolygonForm -> addPolygony5 -> setEnabled(true);
+            addPolygonForm -> addPolygonx6 -> setEnabled(true);
+            addPolygonForm -> addPolygony6 -> setEnabled(true);
+            addPolygonForm -> addPolygonx7 -> setEnabled(true);
+            addPolygonForm -> addPolygony7 -> setEnabled(true);
+            addPolygonForm -> addPolygonx8 -> setEnabled(true);
+            addPolygonForm -> addPolygony8 -> setEnabled(true);
+            addPolygonForm -> addPolygonx9 -> setEnabled(true);
+            addPolygonForm -> addPolygony9 -> setEnabled(true);
+            addPolygonForm -> addPolygonx10 -> setEnabled(true);
+            addPolygonForm -> addPolygony10 -> setEnabled(true);
         break;
     }
 }
@@ -2073,6 +2542,8 @@ void MainWindow::on_addPolygonNumPoints_currentIndexChanged(int index)
  * If the user is an admin, they are allowed to add, edit, and delete, so these forms become visible to them. */
 void MainWindow::on_tabs_currentChanged(int index)
 {
+    TRACE_SLOT();
+
     clearAdd();
 
     if(index == 0)
@@ -2119,6 +2590,8 @@ void MainWindow::on_tabs_currentChanged(int index)
 //! Enables move spin boxes when the user elects to move a shape
 void MainWindow::on_moveButton_clicked()
 {
+    TRACE_SLOT();
+
     ui -> xShiftBox -> setEnabled(true);
     ui -> yShiftBox -> setEnabled(true);
     ui -> editShapeSpecs -> hide();
@@ -2127,6 +2600,8 @@ void MainWindow::on_moveButton_clicked()
 //! Enables the edit form when the user elects to edit a shape
 void MainWindow::on_editButton_clicked()
 {
+    TRACE_SLOT();
+
     if(allShapes.getShapeCount()!=0)
     {
         setCurrentShapeInfo();
@@ -2139,12 +2614,15 @@ void MainWindow::on_editButton_clicked()
 //! Enables the appropriate edit shape form depending on which shape the user elects to edit.
 void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
 {
+    TRACE_SLOT();
+
     if(ui->editShapeID->count() != 0)
     {
         setCurrentShapeInfo();
     }
 
     if(allShapes.findShape((arg1).toInt()) == "Line"){
+        editLineForm.build();
         ui -> editLine -> show();
         ui -> editPolygon -> hide();
         ui -> editPolyline -> hide();
@@ -2154,6 +2632,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editCircle -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Polyline"){
+        editPolylineForm.build();
         ui -> editPolyline -> show();
         disableEditPolylineSpinBoxes();
         ui -> editPolygon -> hide();
@@ -2164,6 +2643,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editCircle -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Polygon"){
+        editPolygonForm.build();
         ui -> editPolygon -> show();
         disableEditPolygonSpinBoxes();
         ui -> editLine -> hide();
@@ -2174,6 +2654,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editCircle -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Rectangle"){
+        editRectangleForm.build();
         ui -> editRectangle -> show();
         ui -> editPolygon -> hide();
         ui -> editPolyline -> hide();
@@ -2183,6 +2664,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editCircle -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Square"){
+        editSquareForm.build();
         ui -> editSquare -> show();
         ui -> editLine -> hide();
         ui -> editPolyline -> hide();
@@ -2192,6 +2674,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editCircle -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Ellipse"){
+        editEllipseForm.build();
         ui -> editEllipse -> show();
         ui -> editPolygon -> hide();
         ui -> editPolyline -> hide();
@@ -2201,6 +2684,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editCircle -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Circle"){
+        editCircleForm.build();
         ui -> editCircle -> show();
         ui -> editPolygon -> hide();
         ui -> editPolyline -> hide();
@@ -2210,6 +2694,7 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
         ui -> editLine -> hide();
         ui -> editText -> hide();}
     else if(allShapes.findShape((arg1).toInt()) == "Text"){
+        editTextForm.build();
         ui -> editText -> show();
         ui -> editPolygon -> hide();
         ui -> editPolyline -> hide();
@@ -2221,252 +2706,256 @@ void MainWindow::on_editShapeID_currentTextChanged(const QString &arg1)
 }
 
 //! Enables/disables edit polygon spin boxes depending on how many points the user chooses the polygon to have
-void MainWindow::on_editPolygonNumPoints_currentIndexChanged(int index)
+void MainWindow::editPolygonNumPointsChanged(int index)
 {
+    TRACE_SLOT();
+
     disableEditPolygonSpinBoxes();
 
     switch(index)
     {
     case 0: break;
-    case 1: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
+    case 1: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
         break;
-    case 2: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
+    case 2: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
         break;
-    case 3: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
-            ui -> editPolygonx5 -> setEnabled(true);
-            ui -> editPolygony5 -> setEnabled(true);
+    case 3: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
+            editPolygonForm -> editPolygonx5 -> setEnabled(true);
+            editPolygonForm -> editPolygony5 -> setEnabled(true);
         break;
-    case 4: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
-            ui -> editPolygonx5 -> setEnabled(true);
-            ui -> editPolygony5 -> setEnabled(true);
-            ui -> editPolygonx6 -> setEnabled(true);
-            ui -> editPolygony6 -> setEnabled(true);
+    case 4: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
+            editPolygonForm -> editPolygonx5 -> setEnabled(true);
+            editPolygonForm -> editPolygony5 -> setEnabled(true);
+            editPolygonForm -> editPolygonx6 -> setEnabled(true);
+            editPolygonForm -> editPolygony6 -> setEnabled(true);
         break;
-    case 5: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
-            ui -> editPolygonx5 -> setEnabled(true);
-            ui -> editPolygony5 -> setEnabled(true);
-            ui -> editPolygonx6 -> setEnabled(true);
-            ui -> editPolygony6 -> setEnabled(true);
-            ui -> editPolygonx7 -> setEnabled(true);
-            ui -> editPolygony7 -> setEnabled(true);
+    case 5: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
+            editPolygonForm -> editPolygonx5 -> setEnabled(true);
+            editPolygonForm -> editPolygony5 -> setEnabled(true);
+            editPolygonForm -> editPolygonx6 -> setEnabled(true);
+            editPolygonForm -> editPolygony6 -> setEnabled(true);
+            editPolygonForm -> editPolygonx7 -> setEnabled(true);
+            editPolygonForm -> editPolygony7 -> setEnabled(true);
         break;
-    case 6: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
-            ui -> editPolygonx5 -> setEnabled(true);
-            ui -> editPolygony5 -> setEnabled(true);
-            ui -> editPolygonx6 -> setEnabled(true);
-            ui -> editPolygony6 -> setEnabled(true);
-            ui -> editPolygonx7 -> setEnabled(true);
-            ui -> editPolygony7 -> setEnabled(true);
-            ui -> editPolygonx8 -> setEnabled(true);
-            ui -> editPolygony8 -> setEnabled(true);
+    case 6: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
+            editPolygonForm -> editPolygonx5 -> setEnabled(true);
+            editPolygonForm -> editPolygony5 -> setEnabled(true);
+            editPolygonForm -> editPolygonx6 -> setEnabled(true);
+            editPolygonForm -> editPolygony6 -> setEnabled(true);
+            editPolygonForm -> editPolygonx7 -> setEnabled(true);
+            editPolygonForm -> editPolygony7 -> setEnabled(true);
+            editPolygonForm -> editPolygonx8 -> setEnabled(true);
+            editPolygonForm -> editPolygony8 -> setEnabled(true);
         break;
-    case 7: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
-            ui -> editPolygonx5 -> setEnabled(true);
-            ui -> editPolygony5 -> setEnabled(true);
-            ui -> editPolygonx6 -> setEnabled(true);
-            ui -> editPolygony6 -> setEnabled(true);
-            ui -> editPolygonx7 -> setEnabled(true);
-            ui -> editPolygony7 -> setEnabled(true);
-            ui -> editPolygonx8 -> setEnabled(true);
-            ui -> editPolygony8 -> setEnabled(true);
-            ui -> editPolygonx9 -> setEnabled(true);
-            ui -> editPolygony9 -> setEnabled(true);
+    case 7: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
+            editPolygonForm -> editPolygonx5 -> setEnabled(true);
+            editPolygonForm -> editPolygony5 -> setEnabled(true);
+            editPolygonForm -> editPolygonx6 -> setEnabled(true);
+            editPolygonForm -> editPolygony6 -> setEnabled(true);
+            editPolygonForm -> editPolygonx7 -> setEnabled(true);
+            editPolygonForm -> editPolygony7 -> setEnabled(true);
+            editPolygonForm -> editPolygonx8 -> setEnabled(true);
+            editPolygonForm -> editPolygony8 -> setEnabled(true);
+            editPolygonForm -> editPolygonx9 -> setEnabled(true);
+            editPolygonForm -> editPolygony9 -> setEnabled(true);
         break;
-    case 8: ui -> editPolygonx1 -> setEnabled(true);
-            ui -> editPolygony1 -> setEnabled(true);
-            ui -> editPolygonx2 -> setEnabled(true);
-            ui -> editPolygony2 -> setEnabled(true);
-            ui -> editPolygonx3 -> setEnabled(true);
-            ui -> editPolygony3 -> setEnabled(true);
-            ui -> editPolygonx4 -> setEnabled(true);
-            ui -> editPolygony4 -> setEnabled(true);
-            ui -> editPolygonx5 -> setEnabled(true);
-            ui -> editPolygony5 -> setEnabled(true);
-            ui -> editPolygonx6 -> setEnabled(true);
-            ui -> editPolygony6 -> setEnabled(true);
-            ui -> editPolygonx7 -> setEnabled(true);
-            ui -> editPolygony7 -> setEnabled(true);
-            ui -> editPolygonx8 -> setEnabled(true);
-            ui -> editPolygony8 -> setEnabled(true);
-            ui -> editPolygonx9 -> setEnabled(true);
-            ui -> editPolygony9 -> setEnabled(true);
-            ui -> editPolygonx10 -> setEnabled(true);
-            ui -> editPolygony10 -> setEnabled(true);
+    case 8: editPolygonForm -> editPolygonx1 -> setEnabled(true);
+            editPolygonForm -> editPolygony1 -> setEnabled(true);
+            editPolygonForm -> editPolygonx2 -> setEnabled(true);
+            editPolygonForm -> editPolygony2 -> setEnabled(true);
+            editPolygonForm -> editPolygonx3 -> setEnabled(true);
+            editPolygonForm -> editPolygony3 -> setEnabled(true);
+            editPolygonForm -> editPolygonx4 -> setEnabled(true);
+            editPolygonForm -> editPolygony4 -> setEnabled(true);
+            editPolygonForm -> editPolygonx5 -> setEnabled(true);
+            editPolygonForm -> editPolygony5 -> setEnabled(true);
+            editPolygonForm -> editPolygonx6 -> setEnabled(true);
+            editPolygonForm -> editPolygony6 -> setEnabled(true);
+            editPolygonForm -> editPolygonx7 -> setEnabled(true);
+            editPolygonForm -> editPolygony7 -> setEnabled(true);
+            editPolygonForm -> editPolygonx8 -> setEnabled(true);
+            editPolygonForm -> editPolygony8 -> setEnabled(true);
+            editPolygonForm -> editPolygonx9 -> setEnabled(true);
+            editPolygonForm -> editPolygony9 -> setEnabled(true);
+            editPolygonForm -> editPolygonx10 -> setEnabled(true);
+            editPolygonForm -> editPolygony10 -> setEnabled(true);
         break;
     }
 }
 
 //! Enables/disables edit polyline spin boxes depending on how many points the user chooses the polyline to have
-void MainWindow::on_editPolylineNumPoints_currentIndexChanged(int index)
+void MainWindow::editPolylineNumPointsChanged(int index)
 {
+    TRACE_SLOT();
+
     disableEditPolylineSpinBoxes();
 
     switch(index)
     {
     case 0: break;
-    case 1: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
+    case 1: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
         break;
-    case 2: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
+    case 2: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
         break;
-    case 3: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
+    case 3: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
         break;
-    case 4: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
-            ui -> editPolylinex5 -> setEnabled(true);
-            ui -> editPolyliney5 -> setEnabled(true);
+    case 4: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
+            editPolylineForm -> editPolylinex5 -> setEnabled(true);
+            editPolylineForm -> editPolyliney5 -> setEnabled(true);
         break;
-    case 5: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
-            ui -> editPolylinex5 -> setEnabled(true);
-            ui -> editPolyliney5 -> setEnabled(true);
-            ui -> editPolylinex6 -> setEnabled(true);
-            ui -> editPolyliney6 -> setEnabled(true);
+    case 5: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
+            editPolylineForm -> editPolylinex5 -> setEnabled(true);
+            editPolylineForm -> editPolyliney5 -> setEnabled(true);
+            editPolylineForm -> editPolylinex6 -> setEnabled(true);
+            editPolylineForm -> editPolyliney6 -> setEnabled(true);
         break;
-    case 6: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
-            ui -> editPolylinex5 -> setEnabled(true);
-            ui -> editPolyliney5 -> setEnabled(true);
-            ui -> editPolylinex6 -> setEnabled(true);
-            ui -> editPolyliney6 -> setEnabled(true);
-            ui -> editPolylinex7 -> setEnabled(true);
-            ui -> editPolyliney7 -> setEnabled(true);
+    case 6: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
+            editPolylineForm -> editPolylinex5 -> setEnabled(true);
+            editPolylineForm -> editPolyliney5 -> setEnabled(true);
+            editPolylineForm -> editPolylinex6 -> setEnabled(true);
+            editPolylineForm -> editPolyliney6 -> setEnabled(true);
+            editPolylineForm -> editPolylinex7 -> setEnabled(true);
+            editPolylineForm -> editPolyliney7 -> setEnabled(true);
         break;
-    case 7: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
-            ui -> editPolylinex5 -> setEnabled(true);
-            ui -> editPolyliney5 -> setEnabled(true);
-            ui -> editPolylinex6 -> setEnabled(true);
-            ui -> editPolyliney6 -> setEnabled(true);
-            ui -> editPolylinex7 -> setEnabled(true);
-            ui -> editPolyliney7 -> setEnabled(true);
-            ui -> editPolylinex8 -> setEnabled(true);
-            ui -> editPolyliney8 -> setEnabled(true);
+    case 7: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
+            editPolylineForm -> editPolylinex5 -> setEnabled(true);
+            editPolylineForm -> editPolyliney5 -> setEnabled(true);
+            editPolylineForm -> editPolylinex6 -> setEnabled(true);
+            editPolylineForm -> editPolyliney6 -> setEnabled(true);
+            editPolylineForm -> editPolylinex7 -> setEnabled(true);
+            editPolylineForm -> editPolyliney7 -> setEnabled(true);
+            editPolylineForm -> editPolylinex8 -> setEnabled(true);
+            editPolylineForm -> editPolyliney8 -> setEnabled(true);
         break;
-    case 8: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
-            ui -> editPolylinex5 -> setEnabled(true);
-            ui -> editPolyliney5 -> setEnabled(true);
-            ui -> editPolylinex6 -> setEnabled(true);
-            ui -> editPolyliney6 -> setEnabled(true);
-            ui -> editPolylinex7 -> setEnabled(true);
-            ui -> editPolyliney7 -> setEnabled(true);
-            ui -> editPolylinex8 -> setEnabled(true);
-            ui -> editPolyliney8 -> setEnabled(true);
-            ui -> editPolylinex9 -> setEnabled(true);
-            ui -> editPolyliney9 -> setEnabled(true);
+    case 8: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
+            editPolylineForm -> editPolylinex5 -> setEnabled(true);
+            editPolylineForm -> editPolyliney5 -> setEnabled(true);
+            editPolylineForm -> editPolylinex6 -> setEnabled(true);
+            editPolylineForm -> editPolyliney6 -> setEnabled(true);
+            editPolylineForm -> editPolylinex7 -> setEnabled(true);
+            editPolylineForm -> editPolyliney7 -> setEnabled(true);
+            editPolylineForm -> editPolylinex8 -> setEnabled(true);
+            editPolylineForm -> editPolyliney8 -> setEnabled(true);
+            editPolylineForm -> editPolylinex9 -> setEnabled(true);
+            editPolylineForm -> editPolyliney9 -> setEnabled(true);
         break;
-    case 9: ui -> editPolylinex1 -> setEnabled(true);
-            ui -> editPolyliney1 -> setEnabled(true);
-            ui -> editPolylinex2 -> setEnabled(true);
-            ui -> editPolyliney2 -> setEnabled(true);
-            ui -> editPolylinex3 -> setEnabled(true);
-            ui -> editPolyliney3 -> setEnabled(true);
-            ui -> editPolylinex4 -> setEnabled(true);
-            ui -> editPolyliney4 -> setEnabled(true);
-            ui -> editPolylinex5 -> setEnabled(true);
-            ui -> editPolyliney5 -> setEnabled(true);
-            ui -> editPolylinex6 -> setEnabled(true);
-            ui -> editPolyliney6 -> setEnabled(true);
-            ui -> editPolylinex7 -> setEnabled(true);
-            ui -> editPolyliney7 -> setEnabled(true);
-            ui -> editPolylinex8 -> setEnabled(true);
-            ui -> editPolyliney8 -> setEnabled(true);
-            ui -> editPolylinex9 -> setEnabled(true);
-            ui -> editPolyliney9 -> setEnabled(true);
-            ui -> editPolylinex10 -> setEnabled(true);
-            ui -> editPolyliney10 -> setEnabled(true);
+    case 9: editPolylineForm -> editPolylinex1 -> setEnabled(true);
+            editPolylineForm -> editPolyliney1 -> setEnabled(true);
+            editPolylineForm -> editPolylinex2 -> setEnabled(true);
+            editPolylineForm -> editPolyliney2 -> setEnabled(true);
+            editPolylineForm -> editPolylinex3 -> setEnabled(true);
+            editPolylineForm -> editPolyliney3 -> setEnabled(true);
+            editPolylineForm -> editPolylinex4 -> setEnabled(true);
+            editPolylineForm -> editPolyliney4 -> setEnabled(true);
+            editPolylineForm -> editPolylinex5 -> setEnabled(true);
+            editPolylineForm -> editPolyliney5 -> setEnabled(true);
+            editPolylineForm -> editPolylinex6 -> setEnabled(true);
+            editPolylineForm -> editPolyliney6 -> setEnabled(true);
+            editPolylineForm -> editPolylinex7 -> setEnabled(true);
+            editPolylineForm -> editPolyliney7 -> setEnabled(true);
+            editPolylineForm -> editPolylinex8 -> setEnabled(true);
+            editPolylineForm -> editPolyliney8 -> setEnabled(true);
+            editPolylineForm -> editPolylinex9 -> setEnabled(true);
+            editPolylineForm -> editPolyliney9 -> setEnabled(true);
+            editPolylineForm -> editPolylinex10 -> setEnabled(true);
+            editPolylineForm -> editPolyliney10 -> setEnabled(true);
         break;
     }
 }
@@ -2475,6 +2964,8 @@ void MainWindow::on_editPolylineNumPoints_currentIndexChanged(int index)
 //! These changes are reflected on the canvas.
 void MainWindow::on_moveUpdateButton_clicked()
 {
+    TRACE_SLOT();
+
     int shapeId = (ui->editShapeID->currentText()).toInt();
     QPoint shift;
 
@@ -2493,22 +2984,16 @@ void MainWindow::on_moveUpdateButton_clicked()
 //! These changes are reflected on the canvas.
 void MainWindow::on_deleteShapeButton_clicked()
 {
+    TRACE_SLOT();
+
     int shapeId = (ui->deleteShapeID->currentText()).toInt();
 
     if(QMessageBox::warning(this, "Delete Confirmation", "Are you sure you want to delete this shape?", QMessageBox::Yes, QMessageBox::No)
        == QMessageBox::Yes)
     {
+        // Deleting the shape removes its ID from the ID model, which moves both selectors off it and refreshes the edit form
         allShapes.deleteShape(shapeId);
         ui -> renderArea -> getShapes(allShapes.getVector());
-        ui -> editShapeID -> clear();
-        ui -> deleteShapeID -> clear();
-
-        if(allShapes.getShapeCount() != 0)
-        {
-            ui -> editShapeID -> addItems(set_getShapeIds());
-            setCurrentShapeInfo();
-            ui -> deleteShapeID -> addItems(set_getShapeIds());
-        }
 
         updateShapeTables();
 
@@ -2518,6 +3003,8 @@ void MainWindow::on_deleteShapeButton_clicked()
 //! Shows the sorted table of ID's, Perimeters, or Areas depending on the tab that is clicked.
 void MainWindow::on_sortTabs_tabBarClicked(int index)
 {
+    TRACE_SLOT();
+
     switch(index)
     {
     case 0: sortIDTable();
@@ -2532,6 +3019,8 @@ void MainWindow::on_sortTabs_tabBarClicked(int index)
 //! Displays the contact us window.
 void MainWindow::on_actionView_Contact_Info_triggered()
 {
+    TRACE_SLOT();
+
     ui->contactUs->show();
     ui->renderArea->hide();
     ui->tabs->hide();
@@ -2540,16 +3029,190 @@ void MainWindow::on_actionView_Contact_Info_triggered()
 //! Prints the new vector to the output file to save user progress.
 void MainWindow::on_actionSave_Progress_triggered()
 {
+    TRACE_SLOT();
+
     if(QMessageBox::question(this, "Save Current Progress", "Would you like to save all current shapes?", QMessageBox::Yes, QMessageBox::No)
-       == QMessageBox::Yes)
+       == QMessageBox::Yes && confirmSaveWithoutSkippedRecords())
     {
         allShapes.printAll();
+
+        const SaveTimings &timings = allShapes.getLastSaveTimings();
+
+        ui -> statusBar -> showMessage(QString("Saved %1 bytes in %2 ms (%3, %4 threads, %5 chunks; format %6 ms, write %7 ms)")
+                                           .arg(timings.bytesWritten).arg(timings.totalMilliseconds, 0, 'f', 1)
+                                           .arg(QString(timings.parallel ? "parallel" : "sequential")).arg(timings.threadCount).arg(timings.chunkCount)
+                                           .arg(timings.formatMilliseconds, 0, 'f', 1).arg(timings.writeMilliseconds, 0, 'f', 1), 10000);
     }
 }
 
+//! Asks before saving over records the load skipped; the answer is kept, so the user is only asked once.
+bool MainWindow::confirmSaveWithoutSkippedRecords()
+{
+    int skipped = allShapes.getParseReport().recordsSkipped;
+
+    if(skipped == 0 || skippedRecordsConfirmed)
+    {
+        return true;
+    }
+
+    skippedRecordsConfirmed = QMessageBox::warning(this, "Save Current Progress",
+                                                   QString("%1 records of shapes.txt could not be read when it was loaded. "
+                                                           "Saving rewrites the file without them.\n\nSave anyway?").arg(skipped),
+                                                   QMessageBox::Yes, QMessageBox::No) == QMessageBox::Yes;
+
+    return skippedRecordsConfirmed;
+}
+
+//! Shows the memory report of the document.
+void MainWindow::on_actionMemory_Report_triggered()
+{
+    TRACE_SLOT();
+
+    MemoryReport report = allShapes.getMemoryReport();
+    report.add("caches", "canvas shapes", allShapes.getShapeCount(), ui -> renderArea -> getShapeBytes());
+
+    QString summary = QString("The document uses %1 MiB, of which %2 MiB are caches that can be freed.")
+                          .arg(double(report.totalBytes()) / 1048576.0, 0, 'f', 2)
+                          .arg(double(report.evictableBytes()) / 1048576.0, 0, 'f', 2);
+
+    if(allShapes.getMemoryBudget() > 0)
+    {
+        summary += QString("\nMemory budget: %1 MiB.").arg(double(allShapes.getMemoryBudget()) / 1048576.0, 0, 'f', 2);
+
+        if(report.totalBytes() - report.evictableBytes() > allShapes.getMemoryBudget())
+        {
+            summary += "\nThe document is over the budget even without its caches.";
+        }
+    }
+
+    QMessageBox box(QMessageBox::Information, "Memory Report", summary, QMessageBox::Ok, this);
+    box.setDetailedText(QString::fromStdString(report.toString() + "\n" + shapeMemoryReport()));
+    box.exec();
+}
+
+//! Undoes the most recent change to the shapes.
+void MainWindow::on_actionUndo_triggered()
+{
+    TRACE_SLOT();
+
+    if(accessLevel == ADMIN && allShapes.undo())
+    {
+        showUndoRedo();
+    }
+}
+
+//! Redoes the most recently undone change to the shapes.
+void MainWindow::on_actionRedo_triggered()
+{
+    TRACE_SLOT();
+
+    if(accessLevel == ADMIN && allShapes.redo())
+    {
+        showUndoRedo();
+    }
+}
+
+//! Names the next undo and redo steps on their actions; only administrators may use them.
+void MainWindow::updateUndoActions()
+{
+    const CommandLog &commands = allShapes.getCommandLog();
+    bool mayEdit = accessLevel == ADMIN;
+
+    ui -> actionUndo -> setEnabled(mayEdit && commands.canUndo());
+    ui -> actionUndo -> setText(commands.canUndo() ? QString::fromStdString("Undo " + commands.undoText()) : QString("Undo"));
+    ui -> actionRedo -> setEnabled(mayEdit && commands.canRedo());
+    ui -> actionRedo -> setText(commands.canRedo() ? QString::fromStdString("Redo " + commands.redoText()) : QString("Redo"));
+}
+
+//! Refreshes the canvas, the tables, and the edit form after an undo or redo.
+void MainWindow::showUndoRedo()
+{
+    ui -> renderArea -> getShapes(allShapes.getVector());
+    updateShapeTables();
+    setCurrentShapeInfo();
+}
+
+//! Sets the memory budget and enforces it.
+void MainWindow::on_actionSet_Memory_Budget_triggered()
+{
+    TRACE_SLOT();
+
+    bool accepted{false};
+    int megabytes = QInputDialog::getInt(this, "Memory Budget", "Most MiB the document may use (0 for no budget):",
+                                         int(allShapes.getMemoryBudget() >> 20), 0, 1 << 20, 1, &accepted);
+
+    if(accepted)
+    {
+        allShapes.setMemoryBudget(std::size_t(megabytes) << 20);
+
+        std::size_t bytesInUse{0};
+        std::size_t freed = allShapes.enforceMemoryBudget(&bytesInUse);
+
+        if(bytesInUse > allShapes.getMemoryBudget())
+        {
+            QMessageBox::warning(this, "Memory Budget", QString("%1 KiB of caches freed, but the document itself uses %2 MiB, more than the budget.")
+                                     .arg(qulonglong(freed >> 10)).arg(double(bytesInUse) / 1048576.0, 0, 'f', 2), QMessageBox::Ok);
+        }
+        else if(freed > 0)
+        {
+            QMessageBox::information(this, "Memory Budget", QString("%1 KiB of caches freed").arg(qulonglong(freed >> 10)), QMessageBox::Ok);
+        }
+    }
+}
+
+//! Opens a paged document in the page cache.
+/*! Paged files are written by PagedShapeFile::paginate(), for example through scenegen --paged; choosing the page table
+ * (the paged file name followed by ".pages") opens the paged file it belongs to. */
+void MainWindow::on_actionOpen_Paged_Document_triggered()
+{
+    TRACE_SLOT();
+
+    QString fileName = QFileDialog::getOpenFileName(this, "Open Paged Document", QString(), "Paged shape files (*)");
+
+    if(fileName.isEmpty())
+    {
+        return;
+    }
+
+    std::string pagedFileName = fileName.toStdString();
+    std::string pageTableSuffix = PagedShapeFile::pageTableName("");
+
+    if(pagedFileName.size() > pageTableSuffix.size()
+       && pagedFileName.compare(pagedFileName.size() - pageTableSuffix.size(), pageTableSuffix.size(), pageTableSuffix) == 0)
+    {
+        pagedFileName.resize(pagedFileName.size() - pageTableSuffix.size());
+    }
+
+    PageCache &pageCache = allShapes.getPageCache();
+
+    if(!pageCache.open(pagedFileName, ui -> renderArea))
+    {
+        QMessageBox::warning(this, "Open Paged Document",
+                             QString("Could not open %1 or its page table.").arg(QString::fromStdString(pagedFileName)), QMessageBox::Ok);
+        return;
+    }
+
+    ui -> renderArea -> setViewOrigin(QPoint(0, 0));
+    ui -> actionClose_Paged_Document -> setEnabled(true);
+    ui -> statusBar -> showMessage(QString("Opened %1 pages; drag or scroll the canvas to move through the document")
+                                   .arg(pageCache.getPages().size()), 10000);
+}
+
+//! Closes the paged document.
+void MainWindow::on_actionClose_Paged_Document_triggered()
+{
+    TRACE_SLOT();
+
+    allShapes.getPageCache().close();
+    ui -> renderArea -> setViewOrigin(QPoint(0, 0));
+    ui -> actionClose_Paged_Document -> setEnabled(false);
+}
+
 //! Exits the contact us window.
 void MainWindow::on_exitContactUsWindow_clicked()
 {
+    TRACE_SLOT();
+
     ui->contactUs->hide();
     ui->renderArea->show();
     ui->tabs->show();
@@ -2589,7 +3252,13 @@ void MainWindow::closeEvent(QCloseEvent *event)
 
         switch(ret)
         {
-        case QMessageBox::Save: allShapes.printAll();
+        case QMessageBox::Save: if(!confirmSaveWithoutSkippedRecords())
+                                {
+                                    event->ignore();
+                                    break;
+                                }
+
+                                allShapes.printAll();
                                 QMessageBox::information(this, "Thank You", "Thank you for using the 2D Graphics Modeler!", QMessageBox::Close);
                                 event->accept();
             break;
@@ -2606,12 +3275,15 @@ void MainWindow::closeEvent(QCloseEvent *event)
 //! Logs out the user and resets all forms and access levels.
 void MainWindow::on_action_LogOut_triggered()
 {
+    TRACE_SLOT();
+
    if(accessLevel == ADMIN)
    {
        on_actionSave_Progress_triggered();
    }
 
    accessLevel = NONE;
+   updateUndoActions();
    ui->tabs->hide();
    ui->renderArea->hide();
    ui->loginWindow->show();
@@ -2622,6 +3294,8 @@ void MainWindow::on_action_LogOut_triggered()
 //! Otherwise, outputs an error message and waits for correct input.
 void MainWindow::on_pushButton_Login_clicked()
 {
+    TRACE_SLOT();
+
     QString username = ui->lineEdit_username->text();
     QString password = ui->lineEdit_password->text();
     const QString UN = "user";
@@ -2641,6 +3315,8 @@ void MainWindow::on_pushButton_Login_clicked()
         ui->adminDelete->hide();
         ui->renderArea->show();
         accessLevel = USER;                    // sets the access level to normal user
+        ui->menuEdit->menuAction()->setVisible(false); // users may not undo or redo the administrator's changes
+        updateUndoActions();
         ui->menuBar->show();
     }
     else if (username == AD && password == AD)
@@ -2657,6 +3333,8 @@ void MainWindow::on_pushButton_Login_clicked()
         ui->adminDelete->show();
         ui->renderArea->show();
         accessLevel = ADMIN;                    // sets the access level to administrator
+        ui->menuEdit->menuAction()->setVisible(true);
+        updateUndoActions();
         ui->menuBar->show();
     }
     else
@@ -2671,6 +3349,8 @@ void MainWindow::on_pushButton_Login_clicked()
 //! Quits the application.
 void MainWindow::on_pushButton_Exit_clicked()
 {
+    TRACE_SLOT();
+
     QMessageBox::information(this, "Thank You", "Thank you for using the 2D Graphics Modeler!", QMessageBox::Close);
     qApp->quit();
 }
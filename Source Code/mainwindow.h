@@ -13,14 +13,34 @@
 #include "allshapes.h"
 #include "qtconversions.h"
 #include "selectionsort.h"
+#include "startuptimer.h"
+#include "lazyform.h"
+#include "shapeidmodel.h"
+#include <thread>
 
 /*! Forward declaration of the Canvas class */
 class Canvas;
 
 /*! \namespace Ui
- * \brief Includes forward declaration of the MainWindow class */
+ * \brief Includes forward declaration of the MainWindow class and of the add and edit forms */
 namespace Ui {
 class MainWindow;
+class AddLineForm;
+class AddPolylineForm;
+class AddPolygonForm;
+class AddRectangleForm;
+class AddSquareForm;
+class AddEllipseForm;
+class AddCircleForm;
+class AddTextForm;
+class EditLineForm;
+class EditPolylineForm;
+class EditPolygonForm;
+class EditRectangleForm;
+class EditSquareForm;
+class EditEllipseForm;
+class EditCircleForm;
+class EditTextForm;
 }
 
 using namespace ShapeLabels;
@@ -112,12 +132,15 @@ public:
     //! Clears all edit forms.
     void clearEdit();
 
-    //! Sets and gets all current Shape ID's to the appropriate combo boxes.
-    QStringList set_getShapeIds();
-
     //! Sets the current shape information on the appropriate edit shape form.
     void setCurrentShapeInfo();
 
+    //! Enables the undo and redo actions for administrators when there is a step to undo or redo, and names the step in their text.
+    void updateUndoActions();
+
+    //! Shows the shapes after an undo or redo on the canvas, in the tables, and on the edit form.
+    void showUndoRedo();
+
     //! Disables all edit polyline spin boxes.
     void disableEditPolylineSpinBoxes();
 
@@ -132,112 +155,112 @@ private slots:
     void on_addShapeType_currentIndexChanged(const QString &arg1);
 
     //! Adds a new line.
-    void on_lineSave_clicked();
+    void lineSaveClicked();
 
     //! Cancels addition of a line.
-    void on_lineCancel_clicked();
+    void lineCancelClicked();
 
     //! Edits an existing line.
-    void on_editLineSave_clicked();
+    void editLineSaveClicked();
 
     //! Cancels edit of a line.
-    void on_editLineCancel_clicked();
+    void editLineCancelClicked();
 
     //! Adds a new polyline.
-    void on_polylineSave_clicked();
+    void polylineSaveClicked();
 
     //! Cancels addition of a polyline.
-    void on_polylineCancel_clicked();
+    void polylineCancelClicked();
 
     //! Changes the number of enabled spin boxes in the add polyline form depending on the number of points the user chooses to have.
-    void on_addPolylineNumPoints_currentIndexChanged(int index);
+    void addPolylineNumPointsChanged(int index);
 
     //! Edits an existing polyline.
-    void on_editPolylineSave_clicked();
+    void editPolylineSaveClicked();
 
     //! Cancels edit of a polyline.
-    void on_editPolylineCancel_clicked();
+    void editPolylineCancelClicked();
 
     //! Changes the number of enabled spin boxes in the edit polyline form depending on the number of points the user chooses to have.
-    void on_editPolylineNumPoints_currentIndexChanged(int index);
+    void editPolylineNumPointsChanged(int index);
 
     //! Adds a new polygon.
-    void on_polygonSave_clicked();
+    void polygonSaveClicked();
 
     //! Cancels addition of a polygon.
-    void on_polygonCancel_clicked();
+    void polygonCancelClicked();
 
     //! Changes the number of enabled spin boxes in the add polygon form depending on the number of sides the user chooses to have.
-    void on_addPolygonNumPoints_currentIndexChanged(int index);
+    void addPolygonNumPointsChanged(int index);
 
     //! Edits an existing polygon.
-    void on_editPolygonSave_clicked();
+    void editPolygonSaveClicked();
 
     //! Cancels edit of a polygon.
-    void on_editPolygonCancel_clicked();
+    void editPolygonCancelClicked();
 
     //! Changes the number of enabled spin boxes in the edit polygon form depending on the number of sides the user chooses to have.
-    void on_editPolygonNumPoints_currentIndexChanged(int index);
+    void editPolygonNumPointsChanged(int index);
 
     //! Adds a new rectangle.
-    void on_rectangleSave_clicked();
+    void rectangleSaveClicked();
 
     //! Cancels addition of a rectangle.
-    void on_rectangleCancel_clicked();
+    void rectangleCancelClicked();
 
     //! Edits an existing rectangle.
-    void on_editRectangleSave_clicked();
+    void editRectangleSaveClicked();
 
     //! Cancels edit of a rectangle.
-    void on_editRectangleCancel_clicked();
+    void editRectangleCancelClicked();
 
     //! Adds a new square.
-    void on_squareSave_clicked();
+    void squareSaveClicked();
 
     //! Cancels addition of a square.
-    void on_squareCancel_clicked();
+    void squareCancelClicked();
 
     //! Edits an existing square.
-    void on_editSquareSave_clicked();
+    void editSquareSaveClicked();
 
     //! Cancels edit of a square.
-    void on_editSquareCancel_clicked();
+    void editSquareCancelClicked();
 
     //! Adds a new ellipse.
-    void on_ellipseSave_clicked();
+    void ellipseSaveClicked();
 
     //! Cancels addition of an ellipse.
-    void on_ellipseCancel_clicked();
+    void ellipseCancelClicked();
 
     //! Edits an existing ellipse.
-    void on_editEllipseSave_clicked();
+    void editEllipseSaveClicked();
 
     //! Cancels edit of an ellipse.
-    void on_editEllipseCancel_clicked();
+    void editEllipseCancelClicked();
 
     //! Adds a new circle.
-    void on_circleSave_clicked();
+    void circleSaveClicked();
 
     //! Cancels addition of a circle.
-    void on_circleCancel_clicked();
+    void circleCancelClicked();
 
     //! Edits an existing circle.
-    void on_editCircleSave_clicked();
+    void editCircleSaveClicked();
 
     //! Cancels edit of a circle.
-    void on_editCircleCancel_clicked();
+    void editCircleCancelClicked();
 
     //! Adds a new text box.
-    void on_textSave_clicked();
+    void textSaveClicked();
 
     //! Cancels addition of a text box.
-    void on_textCancel_clicked();
+    void textCancelClicked();
 
     //! Edits an existing text box.
-    void on_editTextSave_clicked();
+    void editTextSaveClicked();
 
     //! Cancels edit of a text.
-    void on_editTextCancel_clicked();
+    void editTextCancelClicked();
 
     //! Updates the rendering area after changing the vector.
     void on_updateButton_clicked();
@@ -269,6 +292,24 @@ private slots:
     //! Prints the current vector to the shape file.
     void on_actionSave_Progress_triggered();
 
+    //! Shows the bytes used by each shape type, style table, cache, and index.
+    void on_actionMemory_Report_triggered();
+
+    //! Asks for a memory budget and frees caches until the document fits in it.
+    void on_actionSet_Memory_Budget_triggered();
+
+    //! Asks for a paged shape file and shows it on the canvas, which loads its pages as the canvas is panned.
+    void on_actionOpen_Paged_Document_triggered();
+
+    //! Closes the paged document and shows the shape vector again.
+    void on_actionClose_Paged_Document_triggered();
+
+    //! Undoes the most recent add, edit, move, or delete; does nothing unless an administrator is logged in.
+    void on_actionUndo_triggered();
+
+    //! Redoes the most recently undone add, edit, move, or delete; does nothing unless an administrator is logged in.
+    void on_actionRedo_triggered();
+
     //! Exits the contact us window.
     void on_exitContactUsWindow_clicked();
 
@@ -282,9 +323,71 @@ private slots:
     void on_pushButton_Exit_clicked();
 
 private:
+
+    //! Fills the widgets that depend on the shapes once the loader thread has parsed them.
+    /*! Runs on the GUI thread, queued by the loader thread. Joins the loader, hands the shapes to the canvas,
+     * fills the shape ID combo boxes and the shape tables, and enables logging in. If the shapes file had records
+     * with errors, shows how many were skipped and the first errors. Builds with SHAPE_PERF_COUNTERS
+     * also print the start up report to the console.
+     * \sa StartupTimer
+     */
+    void shapesLoaded();
+
+    //! Asks before the first save that would drop the records skipped when the shapes file was loaded.
+    /*! Saving rewrites shapes.txt from the shape vector, which does not hold the skipped records.
+     * \returns TRUE if nothing was skipped, or the user agreed to save without the skipped records.
+     * \sa AllShapes::getParseReport()
+     */
+    bool confirmSaveWithoutSkippedRecords();
+
+#ifdef SHAPE_PERF_COUNTERS
+    //! Adds the performance menu to the menu bar.
+    /*! The menu shows or hides the canvas overlay, saves every timer and counter to perfcounters.json, and resets them.
+     * \sa perf::toJson()
+     */
+    void createPerformanceMenu();
+#endif
+
+#ifdef SHAPE_TRACING
+    //! Adds the trace menu to the menu bar.
+    /*! The menu exports the recorded spans to trace.json in Chrome trace-event format, and clears them.
+     * \sa trace::exportChromeTrace()
+     */
+    void createTraceMenu();
+#endif
+
+#ifdef SHAPE_ALLOC_TRACKING
+    //! Adds the allocation menu to the menu bar.
+    /*! The menu saves the allocations charged to every operation to allocations.json, and resets them.
+     * \sa alloc::toJson()
+     */
+    void createAllocationMenu();
+#endif
+
+    StartupTimer startup;   /*!< the timings of the start up phases; declared first so it starts before the other members */
     Ui::MainWindow  *ui;    /*!< the pointer to the main window */
     AllShapes allShapes;    /*!< the object allowing access to the AllShapes controller class */
     int accessLevel;        /*!< the access level of the current user depending on their type (basic user, admin) */
+    bool skippedRecordsConfirmed;   /*!< TRUE once the user agreed to save over the records skipped by the load */
+    std::thread loader;     /*!< the thread parsing the shapes file and building the caches while the window is shown */
+    ShapeIdModel shapeIds;  /*!< the shape IDs listed by the edit and delete selectors */
+
+    LazyForm<Ui::AddLineForm> addLineForm;              /*!< the add line form, built the first time it is shown */
+    LazyForm<Ui::AddPolylineForm> addPolylineForm;      /*!< the add polyline form, built the first time it is shown */
+    LazyForm<Ui::AddPolygonForm> addPolygonForm;        /*!< the add polygon form, built the first time it is shown */
+    LazyForm<Ui::AddRectangleForm> addRectangleForm;    /*!< the add rectangle form, built the first time it is shown */
+    LazyForm<Ui::AddSquareForm> addSquareForm;          /*!< the add square form, built the first time it is shown */
+    LazyForm<Ui::AddEllipseForm> addEllipseForm;        /*!< the add ellipse form, built the first time it is shown */
+    LazyForm<Ui::AddCircleForm> addCircleForm;          /*!< the add circle form, built the first time it is shown */
+    LazyForm<Ui::AddTextForm> addTextForm;              /*!< the add text form, built the first time it is shown */
+    LazyForm<Ui::EditLineForm> editLineForm;            /*!< the edit line form, built the first time it is shown */
+    LazyForm<Ui::EditPolylineForm> editPolylineForm;    /*!< the edit polyline form, built the first time it is shown */
+    LazyForm<Ui::EditPolygonForm> editPolygonForm;      /*!< the edit polygon form, built the first time it is shown */
+    LazyForm<Ui::EditRectangleForm> editRectangleForm;  /*!< the edit rectangle form, built the first time it is shown */
+    LazyForm<Ui::EditSquareForm> editSquareForm;        /*!< the edit square form, built the first time it is shown */
+    LazyForm<Ui::EditEllipseForm> editEllipseForm;      /*!< the edit ellipse form, built the first time it is shown */
+    LazyForm<Ui::EditCircleForm> editCircleForm;        /*!< the edit circle form, built the first time it is shown */
+    LazyForm<Ui::EditTextForm> editTextForm;            /*!< the edit text form, built the first time it is shown */
 
     //! The enumeration representing the access levels of all user types.
     enum accessLevels {
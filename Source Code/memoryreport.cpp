@@ -0,0 +1,204 @@
+#include "memoryreport.h"
+#include "shape_list.h"
+#include "shapevariant.h"
+#include "styletable.h"
+#include <sstream>
+#include <iomanip>
+
+namespace
+{
+    //! Mirrors the data members the Shape base class held before type specific data moved into the derived classes.
+    /*! Only used to measure the former layout; never instantiated.
+     */
+    struct LegacyShapeLayout
+    {
+        virtual ~LegacyShapeLayout() {}
+
+        int shapeId;
+        std::string shapeType;
+        int numDimensions;
+        dim::specs* shapeDimensions;
+        dim::specs inlineDimensions[MAX_INLINE_DIMENSIONS];
+        QPainter painter;
+        QPen pen;
+        QBrush brush;
+        QFont font;
+        std::string text;
+        Qt::AlignmentFlag alignFlag;
+    };
+
+    //! The bytes the Text class now holds itself that used to be part of every shape; the font is held as a style table ID.
+    const size_t TEXT_ONLY_BYTES = sizeof(int) + sizeof(std::string) + sizeof(Qt::AlignmentFlag);
+
+    //! Writes one row of the report.
+    /*! \param oss the stream the row is written to
+     * \param type the shape type
+     * \param current the number of bytes one object of the shape type occupies now
+     * \param legacy the number of bytes one object of the shape type occupied with the former layout
+     */
+    void writeRow(std::ostringstream &oss, ShapeLabels::eShapes type, size_t current, size_t legacy)
+    {
+        oss << std::left << std::setw(12) << ShapeLabels::SHAPES_LIST[type]
+            << std::right << std::setw(8) << legacy
+            << std::setw(8) << current << std::endl;
+    }
+
+    //! Computes the former size of a derived shape from its current size.
+    /*! \param current sizeof() the derived shape
+     * \param ownsTextData whether the derived shape is a Text object holding the data that used to live in the base class
+     */
+    size_t legacySize(size_t current, bool ownsTextData)
+    {
+        size_t derivedOnly = current - sizeof(Shape) - (ownsTextData ? TEXT_ONLY_BYTES : 0);
+
+        return sizeof(LegacyShapeLayout) + derivedOnly;
+    }
+}
+
+//! Builds the per shape type memory report.
+std::string shapeMemoryReport()
+{
+    using namespace ShapeLabels;
+
+    std::ostringstream oss;
+
+    oss << "Bytes per shape (sizeof, excluding heap data)" << std::endl;
+    oss << std::left << std::setw(12) << "Type" << std::right << std::setw(8) << "Before" << std::setw(8) << "After" << std::endl;
+
+    writeRow(oss, LINE,      sizeof(Line),      legacySize(sizeof(Line), false));
+    writeRow(oss, POLYLINE,  sizeof(Polyline),  legacySize(sizeof(Polyline), false));
+    writeRow(oss, POLYGON,   sizeof(Polygon),   legacySize(sizeof(Polygon), false));
+    writeRow(oss, RECTANGLE, sizeof(Rectangle), legacySize(sizeof(Rectangle), false));
+    writeRow(oss, SQUARE,    sizeof(Square),    legacySize(sizeof(Square), false));
+    writeRow(oss, ELLIPSE,   sizeof(Ellipse),   legacySize(sizeof(Ellipse), false));
+    writeRow(oss, CIRCLE,    sizeof(Circle),    legacySize(sizeof(Circle), false));
+    writeRow(oss, TEXT,      sizeof(Text),      legacySize(sizeof(Text), true));
+
+    oss << "Before, every shape also owned the private heap data of its own QPainter;"
+        << " shapes now share the painter of the rendering area." << std::endl;
+
+    const StyleTable &styles = StyleTable::shared();
+
+    oss << "Pens, brushes, and fonts are shared through the style table: "
+        << styles.getPenCount() << " pens, "
+        << styles.getBrushCount() << " brushes, "
+        << styles.getFontCount() << " fonts." << std::endl;
+
+    return oss.str();
+}
+
+void MemoryReport::add(const std::string &category, const std::string &name, long long count, std::size_t bytes, bool evictable)
+{
+    MemoryEntry entry;
+    entry.category = category;
+    entry.name = name;
+    entry.count = count;
+    entry.bytes = bytes;
+    entry.evictable = evictable;
+
+    entries.push_back(entry);
+}
+
+/*! A 200 point polygon shows up here at its real cost: the object, its spilled dimension array, and its vector of points. */
+void MemoryReport::addShapes(const myVector::vector<Shape*> &shapes)
+{
+    long long counts[NUM_SHAPES]{};
+    std::size_t bytes[NUM_SHAPES]{};
+
+    for(int i = 0; i < shapes.size(); ++i)
+    {
+        ++counts[shapes[i] -> getShapeType()];
+        bytes[shapes[i] -> getShapeType()] += footprintBytes(shapes[i]);
+    }
+
+    for(int type = 0; type < NUM_SHAPES; ++type)
+    {
+        add("shapes", ShapeLabels::SHAPES_LIST[type], counts[type], bytes[type]);
+    }
+
+    add("shapes", "shape vector", shapes.size(), std::size_t(shapes.capacity()) * sizeof(Shape*));
+}
+
+void MemoryReport::addStyles()
+{
+    const StyleTable &styles = StyleTable::shared();
+
+    add("styles", "pens", styles.getPenCount(), styles.getPenBytes());
+    add("styles", "brushes", styles.getBrushCount(), styles.getBrushBytes());
+    add("styles", "fonts", styles.getFontCount(), styles.getFontBytes());
+}
+
+std::size_t MemoryReport::totalBytes() const
+{
+    std::size_t total{0};
+
+    for(const MemoryEntry &entry : entries)
+    {
+        total += entry.bytes;
+    }
+
+    return total;
+}
+
+std::size_t MemoryReport::evictableBytes() const
+{
+    std::size_t total{0};
+
+    for(const MemoryEntry &entry : entries)
+    {
+        total += entry.evictable ? entry.bytes : 0;
+    }
+
+    return total;
+}
+
+std::string MemoryReport::toString() const
+{
+    std::ostringstream oss;
+
+    oss << std::left << std::setw(9) << "Category" << std::setw(24) << "Name"
+        << std::right << std::setw(10) << "Count" << std::setw(14) << "Bytes" << std::setw(10) << "Per item" << std::endl;
+
+    for(const MemoryEntry &entry : entries)
+    {
+        oss << std::left << std::setw(9) << entry.category << std::setw(24) << (entry.name + (entry.evictable ? " *" : ""))
+            << std::right << std::setw(10) << entry.count << std::setw(14) << entry.bytes << std::setw(10);
+
+        if(entry.count > 0)
+        {
+            oss << std::fixed << std::setprecision(1) << double(entry.bytes) / double(entry.count);
+        }
+        else
+        {
+            oss << "-";
+        }
+
+        oss << std::endl;
+    }
+
+    oss << "Total " << totalBytes() << " bytes (" << std::fixed << std::setprecision(2) << double(totalBytes()) / 1048576.0
+        << " MiB); entries marked * can be evicted: " << evictableBytes() << " bytes." << std::endl
+        << "Counts sizeof() and container capacities; allocator overhead and Qt private data are not included." << std::endl;
+
+    return oss.str();
+}
+
+std::string MemoryReport::toJson() const
+{
+    std::ostringstream json;
+
+    json << "{\n  \"total_bytes\": " << totalBytes() << ",\n  \"evictable_bytes\": " << evictableBytes() << ",\n  \"entries\": [";
+
+    for(std::size_t i = 0; i < entries.size(); ++i)
+    {
+        const MemoryEntry &entry = entries[i];
+
+        json << (i == 0 ? "\n" : ",\n") << "    {\"category\": \"" << entry.category << "\", \"name\": \"" << entry.name
+             << "\", \"count\": " << entry.count << ", \"bytes\": " << entry.bytes
+             << ", \"evictable\": " << (entry.evictable ? "true" : "false") << "}";
+    }
+
+    json << "\n  ]\n}\n";
+
+    return json.str();
+}
@@ -0,0 +1,110 @@
+/*!
+ * \file    memoryreport.h
+ * \brief   Reports how many bytes one object of each shape type occupies, and how many bytes the shapes, style tables, caches, and indexes of a document use.
+*/
+
+#ifndef MEMORYREPORT_H
+#define MEMORYREPORT_H
+
+#include "vector.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class Shape;
+
+//! Builds a report of the bytes used by one object of every shape type.
+/*! Lists sizeof() for each derived shape next to the size the same shape had with the former Shape layout,
+ * which stored a QPainter, a QFont, a text string, an alignment flag, and a shape type string in every shape.
+ * Heap blocks owned by Qt objects (such as the private data a QPainter allocates) are not part of sizeof() and are listed separately.
+ * \returns The report as a multi-line string.
+ */
+std::string shapeMemoryReport();
+
+/*! \struct MemoryEntry
+ * \brief The bytes used by one shape type, style table, cache, or index.
+ */
+struct MemoryEntry
+{
+    std::string category;   /*!< the kind of memory: "shapes", "styles", "caches", "indexes", or "history" */
+    std::string name;       /*!< what uses the memory */
+    long long count{0};     /*!< the number of items held, such as shapes, styles, or pages */
+    std::size_t bytes{0};   /*!< the bytes requested from the heap, plus the size of the objects themselves */
+    bool evictable{false};  /*!< TRUE if the memory can be freed and rebuilt when it is needed again */
+};
+
+/*! The bytes of a document by subsystem, as gathered by AllShapes::getMemoryReport().
+ * Sizes are computed from sizeof() and container capacities; allocator overhead and the private data of Qt objects
+ * are not counted, so the figures are a lower bound of what the process uses.
+ * \sa AllShapes::enforceMemoryBudget()
+ */
+class MemoryReport
+{
+public:
+
+    //! Adds an entry.
+    /*! \param category the kind of memory: "shapes", "styles", "caches", "indexes", or "history"
+     * \param name what uses the memory
+     * \param count the number of items held
+     * \param bytes the bytes used
+     * \param evictable TRUE if the memory can be freed and rebuilt when it is needed again
+     */
+    void add(const std::string &category, const std::string &name, long long count, std::size_t bytes, bool evictable = false);
+
+    //! Adds one entry per shape type, and one for the vector holding the shapes.
+    /*! \param shapes the shapes of the document
+     * \sa footprintBytes()
+     */
+    void addShapes(const myVector::vector<Shape*> &shapes);
+
+    //! Adds one entry per table of the shared style table.
+    /*! \sa StyleTable
+     */
+    void addStyles();
+
+    //! Gets every entry, in the order they were added.
+    const std::vector<MemoryEntry> &getEntries() const {return entries;}
+
+    //! Gets the bytes of every entry.
+    std::size_t totalBytes() const;
+
+    //! Gets the bytes of the entries that can be freed.
+    std::size_t evictableBytes() const;
+
+    //! Formats the report as a table.
+    /*! \returns The report as a multi-line string.
+     */
+    std::string toString() const;
+
+    //! Formats the report as a JSON object.
+    /*! \returns The JSON text.
+     */
+    std::string toJson() const;
+
+private:
+    std::vector<MemoryEntry> entries;   /*!< the entries, in the order they were added */
+};
+
+//! Estimates the bytes of a std::map or std::set.
+/*! Each element lives in its own tree node holding three links and a color next to the value.
+ * \param tree the container
+ * \returns The bytes of all nodes.
+ */
+template<typename Tree>
+std::size_t treeBytes(const Tree &tree)
+{
+    return tree.size() * (sizeof(typename Tree::value_type) + 4 * sizeof(void*));
+}
+
+//! Estimates the bytes of a std::unordered_map or std::unordered_set.
+/*! Each element lives in its own node holding a link and a cached hash next to the value, and every bucket holds one link.
+ * \param table the container
+ * \returns The bytes of all nodes and the bucket array.
+ */
+template<typename Table>
+std::size_t hashTableBytes(const Table &table)
+{
+    return table.size() * (sizeof(typename Table::value_type) + 2 * sizeof(void*)) + table.bucket_count() * sizeof(void*);
+}
+
+#endif // MEMORYREPORT_H
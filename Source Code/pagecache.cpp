@@ -0,0 +1,377 @@
+#include "pagecache.h"
+#include "shapevariant.h"
+#include "tracing.h"
+#include <algorithm>
+
+PageCache::PageCache(int maxResidentPages)
+    : device{nullptr}, maxResidentPages{std::max(1, maxResidentPages)}, stopping{false}
+{}
+
+PageCache::~PageCache()
+{
+    close();
+}
+
+bool PageCache::open(const std::string &pagedFileName, QPaintDevice *device)
+{
+    close();
+
+    if(!pages.open(pagedFileName))
+    {
+        return false;
+    }
+
+    file.open(pagedFileName, std::ios::in | std::ios::binary);
+
+    if(!file.is_open())
+    {
+        pages = PagedShapeFile();
+        return false;
+    }
+
+    fileName = pagedFileName;
+    this -> device = device;
+    stats = PageCacheStats();
+    parseReport = ParseReport();
+
+    stopping = false;
+    prefetcher = std::thread(&PageCache::prefetchLoop, this);
+
+    return true;
+}
+
+void PageCache::close()
+{
+    stopPrefetching();
+
+    while(!residents.empty())
+    {
+        dropPage(residents.begin());
+    }
+
+    recency.clear();
+    visiblePages.clear();
+    visibleShapes.clear();
+    prefetchQueue.clear();
+    prefetched.clear();
+
+    if(file.is_open())
+    {
+        file.close();
+    }
+
+    pages = PagedShapeFile();
+    fileName.clear();
+}
+
+void PageCache::setViewport(const QRect &viewport)
+{
+    TRACE_SCOPE("pages", "setViewport");
+
+    if(!isOpen())
+    {
+        return;
+    }
+
+    visiblePages = pages.query(viewport);
+    visibleShapes.clear();
+
+    for(int page : visiblePages)
+    {
+        std::unordered_map<int, ResidentPage>::iterator it = residents.find(page);
+
+        if(it != residents.end())
+        {
+            ++stats.hits;
+            recency.splice(recency.begin(), recency, it -> second.position);
+        }
+        else
+        {
+            ++stats.misses;
+            loadPage(page);
+            it = residents.find(page);
+        }
+
+        visibleShapes.insert(visibleShapes.end(), it -> second.shapes.begin(), it -> second.shapes.end());
+    }
+
+    evict(maxResidentPages);
+    queueNeighbours();
+}
+
+void PageCache::setMaxResidentPages(int pageCount)
+{
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+        maxResidentPages = std::max(1, pageCount);
+    }
+
+    evict(maxResidentPages);
+}
+
+/*! The resident page limit is left as it is, so pages scrolled into view later are kept again. */
+void PageCache::trim()
+{
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+        prefetchQueue.clear();
+        std::unordered_map<int, std::string>().swap(prefetched);
+    }
+
+    evict(0);
+}
+
+std::size_t PageCache::getResidentBytes() const
+{
+    std::size_t bytes = visibleShapes.capacity() * sizeof(Shape*);
+
+    for(const std::pair<const int, ResidentPage> &resident : residents)
+    {
+        bytes += resident.second.shapes.capacity() * sizeof(Shape*);
+
+        for(Shape *p_Shape : resident.second.shapes)
+        {
+            bytes += footprintBytes(p_Shape);
+        }
+    }
+
+    return bytes;
+}
+
+std::size_t PageCache::getPrefetchedBytes() const
+{
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    std::size_t bytes{0};
+
+    for(const std::pair<const int, std::string> &page : prefetched)
+    {
+        bytes += page.second.capacity();
+    }
+
+    return bytes;
+}
+
+PageCacheStats PageCache::getStats() const
+{
+    PageCacheStats current = stats;
+
+    current.residentPages = int(residents.size());
+    current.residentShapes = 0;
+
+    for(const std::pair<const int, ResidentPage> &resident : residents)
+    {
+        current.residentShapes += int(resident.second.shapes.size());
+    }
+
+    return current;
+}
+
+void PageCache::resetStats()
+{
+    stats = PageCacheStats();
+}
+
+/*! Bytes already read by the prefetch thread are taken over; otherwise the page is read here. */
+void PageCache::loadPage(int page)
+{
+    TRACE_SCOPE("pages", "loadPage");
+
+    std::string bytes;
+    bool found{false};
+
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+        std::unordered_map<int, std::string>::iterator it = prefetched.find(page);
+
+        if(it != prefetched.end())
+        {
+            bytes.swap(it -> second);
+            prefetched.erase(it);
+            found = true;
+        }
+    }
+
+    if(found)
+    {
+        ++stats.prefetchHits;
+    }
+    else
+    {
+        readPage(file, page, bytes);
+    }
+
+    recency.push_front(page);
+
+    ResidentPage &resident = residents[page];
+    resident.position = recency.begin();
+
+    parsePage(bytes, pages.at(page).shapeCount, resident.shapes);
+}
+
+bool PageCache::readPage(std::ifstream &in, int page, std::string &bytes) const
+{
+    const ShapePage &entry = pages.at(page);
+
+    bytes.resize(std::size_t(entry.length));
+
+    in.clear();
+    in.seekg(entry.offset);
+    in.read(&bytes[0], std::streamsize(entry.length));
+    bytes.resize(std::size_t(in.gcount()));
+
+    return !bytes.empty();
+}
+
+/*! The records of a page are separated by empty lines, as in a file read by Parser::parseShapes(). Records with errors are left out of the page. */
+void PageCache::parsePage(const std::string &bytes, int shapeCount, std::vector<Shape*> &shapes)
+{
+    shapes.reserve(shapeCount);
+
+    parser.parseText(bytes, shapes, device, parseReport, shapeCount);
+}
+
+/*! Visible pages are at the front of the recency list, so they are only evicted when more pages are visible than the limit allows, and not even then. */
+void PageCache::evict(int pageLimit)
+{
+    std::list<int>::iterator it = recency.end();
+
+    while(int(residents.size()) > pageLimit && it != recency.begin())
+    {
+        --it;
+
+        if(std::find(visiblePages.begin(), visiblePages.end(), *it) != visiblePages.end())
+        {
+            continue;
+        }
+
+        dropPage(residents.find(*it));
+        it = recency.erase(it);
+        ++stats.evictions;
+    }
+}
+
+void PageCache::dropPage(std::unordered_map<int, ResidentPage>::iterator resident)
+{
+    for(Shape *p_Shape : resident -> second.shapes)
+    {
+        delete p_Shape;
+    }
+
+    residents.erase(resident);
+}
+
+/*! Requests left over from an earlier viewport are dropped, and so are prefetched bytes of pages that are no longer neighbours. */
+void PageCache::queueNeighbours()
+{
+    std::vector<int> neighbours;
+
+    for(int page : visiblePages)
+    {
+        const ShapePage &entry = pages.at(page);
+
+        for(int row = entry.row - 1; row <= entry.row + 1; ++row)
+        {
+            for(int column = entry.column - 1; column <= entry.column + 1; ++column)
+            {
+                int neighbour = pages.find(column, row);
+
+                if(neighbour >= 0 && residents.count(neighbour) == 0
+                   && std::find(neighbours.begin(), neighbours.end(), neighbour) == neighbours.end())
+                {
+                    neighbours.push_back(neighbour);
+                }
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+
+        prefetchQueue.clear();
+
+        for(std::unordered_map<int, std::string>::iterator it = prefetched.begin(); it != prefetched.end();)
+        {
+            if(std::find(neighbours.begin(), neighbours.end(), it -> first) == neighbours.end())
+            {
+                it = prefetched.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        for(int neighbour : neighbours)
+        {
+            if(prefetched.count(neighbour) == 0)
+            {
+                prefetchQueue.push_back(neighbour);
+                ++stats.prefetchesIssued;
+            }
+        }
+    }
+
+    prefetchWake.notify_one();
+}
+
+/*! The thread has its own file stream; it only touches shared state while holding the prefetch mutex. */
+void PageCache::prefetchLoop()
+{
+    TRACE_THREAD_NAME("Page prefetch");
+
+    std::ifstream in(fileName, std::ios::in | std::ios::binary);
+    std::string bytes;
+
+    while(true)
+    {
+        int page;
+
+        {
+            std::unique_lock<std::mutex> lock(prefetchMutex);
+            prefetchWake.wait(lock, [this]{return stopping || !prefetchQueue.empty();});
+
+            if(stopping)
+            {
+                return;
+            }
+
+            page = prefetchQueue.front();
+            prefetchQueue.pop_front();
+        }
+
+        bool read;
+
+        {
+            TRACE_SCOPE("pages", "prefetchPage");
+            read = readPage(in, page, bytes);
+        }
+
+        if(!read)
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+
+        if(!stopping && int(prefetched.size()) < maxResidentPages)
+        {
+            prefetched[page].swap(bytes);
+        }
+    }
+}
+
+void PageCache::stopPrefetching()
+{
+    if(!prefetcher.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+        stopping = true;
+    }
+
+    prefetchWake.notify_one();
+    prefetcher.join();
+}
@@ -0,0 +1,183 @@
+/*!
+ * \class   PageCache
+ * \brief   Keeps the pages of a paged shape file that the viewport shows resident, and prefetches their neighbours.
+*/
+
+#ifndef PAGECACHE_H
+#define PAGECACHE_H
+
+#include "parser.h"
+#include "pagedshapefile.h"
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*! \struct PageCacheStats
+ * \brief The counters of a page cache since it was opened or its counters were last reset.
+ * \sa PageCache::getStats()
+ */
+struct PageCacheStats
+{
+    long long hits{0};              /*!< visible pages that were already resident */
+    long long misses{0};            /*!< visible pages that had to be loaded */
+    long long prefetchHits{0};      /*!< misses whose bytes had already been read by the prefetch thread */
+    long long prefetchesIssued{0};  /*!< pages queued for the prefetch thread */
+    long long evictions{0};         /*!< pages whose shapes were deleted */
+    int residentPages{0};           /*!< the number of resident pages */
+    int residentShapes{0};          /*!< the number of shapes in resident pages */
+};
+
+/*! The layer between AllShapes and the Parser for documents too large to keep in memory.
+ * setViewport() makes every page whose bounds intersect the viewport resident, parsing the page's records if needed,
+ * and evicts the least recently visible pages once more than the resident page limit are held.
+ * The pages in the grid cells around the visible ones are handed to a background thread, which reads their bytes from disk
+ * so a later miss only has to parse them. Shapes are always constructed on the thread that calls setViewport(),
+ * since the shared StyleTable is not synchronized.
+ * \sa PagedShapeFile
+ * \sa canvas::setPageCache()
+ */
+class PageCache
+{
+public:
+
+    static constexpr int DEFAULT_MAX_RESIDENT_PAGES = 64;   /*!< The resident page limit used when none is given */
+
+    //! Constructor
+    /*! \param maxResidentPages the number of pages kept resident when more are not visible
+     */
+    explicit PageCache(int maxResidentPages = DEFAULT_MAX_RESIDENT_PAGES);
+
+    //! Destructor
+    /*! Stops the prefetch thread and deletes every resident shape.
+     */
+    ~PageCache();
+
+    //! Removes functionality of a copy constructor.
+    PageCache(const PageCache &otherCache) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    PageCache& operator=(const PageCache &otherCache) = delete;
+
+    //! Opens a paged shape file and starts the prefetch thread.
+    /*! Closes the current file first.
+     * \param pagedFileName the path of a file written by PagedShapeFile::paginate()
+     * \param device the pointer to the QPaintDevice shapes are created for
+     * \returns FALSE if the file or its page table cannot be read.
+     */
+    bool open(const std::string &pagedFileName, QPaintDevice *device);
+
+    //! Stops the prefetch thread, deletes every resident shape, and forgets the current file.
+    void close();
+
+    //! Checks whether a paged file is open.
+    bool isOpen() const {return file.is_open();}
+
+    //! Gets the page table of the open file.
+    const PagedShapeFile &getPages() const {return pages;}
+
+    //! Moves the viewport.
+    /*! Loads the pages it shows, evicts pages over the limit, and queues the neighbouring pages for prefetching.
+     * \param viewport the visible region, in canvas coordinates
+     */
+    void setViewport(const QRect &viewport);
+
+    //! Gets the shapes of the pages shown by the viewport.
+    /*! The pointers stay valid until the next call to setViewport().
+     * \returns The shapes, page by page, in file order.
+     */
+    const std::vector<Shape*> &getVisibleShapes() const {return visibleShapes;}
+
+    //! Changes the resident page limit and evicts pages over it.
+    void setMaxResidentPages(int pageCount);
+
+    //! Frees every page that is not visible and every prefetched page.
+    /*! \sa AllShapes::enforceMemoryBudget()
+     */
+    void trim();
+
+    //! Gets the number of bytes used by the shapes of the resident pages.
+    /*! \sa footprintBytes()
+     */
+    std::size_t getResidentBytes() const;
+
+    //! Gets the number of bytes read ahead by the prefetch thread and not yet parsed.
+    std::size_t getPrefetchedBytes() const;
+
+    //! Gets the counters.
+    PageCacheStats getStats() const;
+
+    //! Sets the hit, miss, prefetch, and eviction counters to 0.
+    void resetStats();
+
+    //! Gets the errors found in the pages parsed since the file was opened.
+    /*! Line numbers count from the start of the page holding the record.
+     */
+    const ParseReport &getParseReport() const {return parseReport;}
+
+private:
+
+    /*! \struct ResidentPage
+     * \brief The shapes of a page held in memory and the page's place in the recency list.
+     */
+    struct ResidentPage
+    {
+        std::vector<Shape*> shapes;         /*!< the shapes of the page, owned by the cache */
+        std::list<int>::iterator position;  /*!< the page's place in the recency list */
+    };
+
+    //! Makes a page resident, from prefetched bytes or from disk.
+    void loadPage(int page);
+
+    //! Reads the bytes of a page.
+    /*! \returns FALSE if the bytes cannot be read.
+     */
+    bool readPage(std::ifstream &in, int page, std::string &bytes) const;
+
+    //! Parses every record of a page.
+    void parsePage(const std::string &bytes, int shapeCount, std::vector<Shape*> &shapes);
+
+    //! Deletes the least recently visible pages that are not visible, until at most pageLimit are resident.
+    void evict(int pageLimit);
+
+    //! Deletes the shapes of a resident page.
+    void dropPage(std::unordered_map<int, ResidentPage>::iterator resident);
+
+    //! Queues the pages around the visible ones that are neither resident nor prefetched.
+    void queueNeighbours();
+
+    //! Runs on the prefetch thread: reads queued pages until the cache is closed.
+    void prefetchLoop();
+
+    //! Stops and joins the prefetch thread.
+    void stopPrefetching();
+
+    PagedShapeFile pages;           /*!< the page table of the open file */
+    std::string fileName;           /*!< the path of the open paged file */
+    std::ifstream file;             /*!< the open paged file, read by the viewport thread */
+    QPaintDevice *device;           /*!< the pointer to the QPaintDevice shapes are created for */
+    Parser parser;                  /*!< the parser of records; also caches style lookups */
+
+    std::unordered_map<int, ResidentPage> residents;    /*!< the resident pages by page position */
+    std::list<int> recency;                             /*!< the resident pages, most recently visible first */
+    int maxResidentPages;                               /*!< the number of pages kept resident when more are not visible */
+    std::vector<int> visiblePages;                      /*!< the pages shown by the viewport */
+    std::vector<Shape*> visibleShapes;                  /*!< the shapes of the visible pages */
+
+    std::thread prefetcher;                             /*!< the thread reading neighbouring pages ahead of time */
+    mutable std::mutex prefetchMutex;                   /*!< guards the prefetch queue, the prefetched bytes, and stopping */
+    std::condition_variable prefetchWake;               /*!< wakes the prefetch thread when pages are queued or the cache closes */
+    std::deque<int> prefetchQueue;                      /*!< the pages waiting to be read by the prefetch thread */
+    std::unordered_map<int, std::string> prefetched;    /*!< the bytes read by the prefetch thread, by page position */
+    bool stopping;                                      /*!< TRUE when the prefetch thread must exit */
+
+    PageCacheStats stats;       /*!< the counters; the resident counts are filled in by getStats() */
+    ParseReport parseReport;    /*!< the errors found in the pages parsed since the file was opened */
+};
+
+#endif // PAGECACHE_H
@@ -0,0 +1,249 @@
+#include "pagedshapefile.h"
+#include "memoryreport.h"
+#include "shapewriter.h"
+#include <algorithm>
+#include <fstream>
+
+using sidecar::readValue;
+using sidecar::writeValue;
+
+namespace
+{
+    const std::uint32_t PAGE_TABLE_MAGIC = 0x53475053;  // "SPGS"
+    const std::uint32_t PAGE_TABLE_VERSION = 1;
+}
+
+/*! Records are copied byte for byte, minus trailing white space, and separated by one empty line as AllShapes::printAll() does. */
+bool PagedShapeFile::paginate(const std::string &sourceFileName, const std::string &pagedFileName, int pageSize)
+{
+    ShapeIndex index;
+
+    if(pageSize <= 0 || !index.open(sourceFileName))
+    {
+        return false;
+    }
+
+    std::ifstream in(sourceFileName, std::ios::in | std::ios::binary);
+    std::ofstream out(pagedFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if(!in.is_open() || !out.is_open())
+    {
+        return false;
+    }
+
+    /*! Orders the records by page, row by row, keeping the file order inside each page */
+    std::vector<int> order(index.size());
+    std::vector<std::pair<int, int>> cells(index.size());
+
+    for(int i = 0; i < index.size(); ++i)
+    {
+        const QRect &box = index.at(i).boundingBox;
+
+        order[i] = i;
+        cells[i] = {cellOf(box.y(), pageSize), cellOf(box.x(), pageSize)};
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&cells](int a, int b){return cells[a] < cells[b];});
+
+    PagedShapeFile paged;
+    paged.pageSize = pageSize;
+
+    std::string record;
+
+    {
+        ShapeWriter writer(out);
+
+        for(int i = 0; i < int(order.size()); ++i)
+        {
+            const ShapeIndexEntry &entry = index.at(order[i]);
+            int row = cells[order[i]].first;
+            int column = cells[order[i]].second;
+
+            if(paged.pages.empty() || paged.pages.back().row != row || paged.pages.back().column != column)
+            {
+                if(!paged.pages.empty())
+                {
+                    paged.pages.back().length = writer.getBytesWritten() - paged.pages.back().offset;
+                }
+
+                ShapePage page;
+
+                page.column = column;
+                page.row = row;
+                page.offset = writer.getBytesWritten();
+                page.bounds = entry.boundingBox;
+
+                paged.pages.push_back(page);
+            }
+
+            record.resize(std::size_t(entry.length));
+            in.clear();
+            in.seekg(entry.offset);
+            in.read(&record[0], std::streamsize(entry.length));
+            record.resize(std::size_t(in.gcount()));
+
+            std::string::size_type end = record.find_last_not_of(" \t\r\n");
+            record.resize(end == std::string::npos ? 0 : end + 1);
+
+            writer.write(record);
+            writer.newline();
+
+            if(i < int(order.size()) - 1)
+            {
+                writer.newline();
+            }
+
+            ShapePage &page = paged.pages.back();
+
+            page.shapeCount++;
+            page.bounds = page.bounds.united(entry.boundingBox);
+        }
+
+        if(!paged.pages.empty())
+        {
+            paged.pages.back().length = writer.getBytesWritten() - paged.pages.back().offset;
+        }
+    }
+
+    out.close();
+
+    if(!out)
+    {
+        return false;
+    }
+
+    return paged.save(pagedFileName);
+}
+
+bool PagedShapeFile::open(const std::string &pagedFileName)
+{
+    unsigned long long size;
+    long long time;
+
+    if(!ShapeIndex::readFileStamp(pagedFileName, size, time))
+    {
+        return false;
+    }
+
+    std::ifstream in(pageTableName(pagedFileName), std::ios::in | std::ios::binary);
+
+    std::uint32_t magic{0};
+    std::uint32_t version{0};
+    std::uint64_t storedSize{0};
+    std::int64_t storedTime{0};
+    std::int32_t storedPageSize{0};
+    std::int32_t count{0};
+
+    if(!readValue(in, magic) || !readValue(in, version) || !readValue(in, storedSize) || !readValue(in, storedTime)
+       || !readValue(in, storedPageSize) || !readValue(in, count)
+       || magic != PAGE_TABLE_MAGIC || version != PAGE_TABLE_VERSION || storedSize != size || storedTime != time
+       || storedPageSize <= 0 || count < 0)
+    {
+        return false;
+    }
+
+    std::vector<ShapePage> loaded(count);
+
+    for(ShapePage &page : loaded)
+    {
+        std::int32_t column, row, shapeCount, x, y, w, h;
+        std::int64_t offset, length;
+
+        if(!readValue(in, column) || !readValue(in, row) || !readValue(in, offset) || !readValue(in, length) || !readValue(in, shapeCount)
+           || !readValue(in, x) || !readValue(in, y) || !readValue(in, w) || !readValue(in, h))
+        {
+            return false;
+        }
+
+        page.column = column;
+        page.row = row;
+        page.offset = offset;
+        page.length = length;
+        page.shapeCount = shapeCount;
+        page.bounds = QRect(x, y, w, h);
+    }
+
+    pages.swap(loaded);
+    pageSize = storedPageSize;
+    rebuildLookup();
+
+    return true;
+}
+
+int PagedShapeFile::find(int column, int row) const
+{
+    std::unordered_map<long long, int>::const_iterator it = pageOfCell.find(cellKey(column, row));
+
+    return it == pageOfCell.end() ? -1 : it -> second;
+}
+
+std::vector<int> PagedShapeFile::query(const QRect &region) const
+{
+    std::vector<int> found;
+
+    for(int i = 0; i < int(pages.size()); ++i)
+    {
+        if(pages[i].bounds.intersects(region))
+        {
+            found.push_back(i);
+        }
+    }
+
+    return found;
+}
+
+std::size_t PagedShapeFile::memoryBytes() const
+{
+    return pages.capacity() * sizeof(ShapePage) + hashTableBytes(pageOfCell);
+}
+
+bool PagedShapeFile::save(const std::string &pagedFileName) const
+{
+    unsigned long long size;
+    long long time;
+
+    if(!ShapeIndex::readFileStamp(pagedFileName, size, time))
+    {
+        return false;
+    }
+
+    std::ofstream out(pageTableName(pagedFileName), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if(!out.is_open())
+    {
+        return false;
+    }
+
+    writeValue(out, PAGE_TABLE_MAGIC);
+    writeValue(out, PAGE_TABLE_VERSION);
+    writeValue(out, std::uint64_t(size));
+    writeValue(out, std::int64_t(time));
+    writeValue(out, std::int32_t(pageSize));
+    writeValue(out, std::int32_t(pages.size()));
+
+    for(const ShapePage &page : pages)
+    {
+        writeValue(out, std::int32_t(page.column));
+        writeValue(out, std::int32_t(page.row));
+        writeValue(out, std::int64_t(page.offset));
+        writeValue(out, std::int64_t(page.length));
+        writeValue(out, std::int32_t(page.shapeCount));
+        writeValue(out, std::int32_t(page.bounds.x()));
+        writeValue(out, std::int32_t(page.bounds.y()));
+        writeValue(out, std::int32_t(page.bounds.width()));
+        writeValue(out, std::int32_t(page.bounds.height()));
+    }
+
+    return bool(out);
+}
+
+void PagedShapeFile::rebuildLookup()
+{
+    pageOfCell.clear();
+    pageOfCell.reserve(pages.size());
+
+    for(int i = 0; i < int(pages.size()); ++i)
+    {
+        pageOfCell[cellKey(pages[i].column, pages[i].row)] = i;
+    }
+}
@@ -0,0 +1,113 @@
+/*!
+ * \class   PagedShapeFile
+ * \brief   A shape file whose records are grouped into square spatial pages, and the table locating each page.
+*/
+
+#ifndef PAGEDSHAPEFILE_H
+#define PAGEDSHAPEFILE_H
+
+#include "shapeindex.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/*! \struct ShapePage
+ * \brief Locates one page of a paged shape file.
+ */
+struct ShapePage
+{
+    int column{0};          /*!< the page's column in the page grid */
+    int row{0};             /*!< the page's row in the page grid */
+    long long offset{0};    /*!< the byte position of the page's first record */
+    long long length{0};    /*!< the number of bytes of the page's records */
+    int shapeCount{0};      /*!< the number of shapes in the page */
+    QRect bounds;           /*!< the union of the bounding boxes of the page's shapes */
+};
+
+/*! The canvas is divided into a grid of square cells, pageSize units wide.
+ * Each shape belongs to the cell holding the top left corner of its bounding box, and the shapes of one cell form a page.
+ * paginate() rewrites a shape file with the records of every page stored next to each other, so a page is read with one seek and one read.
+ * The paged file is an ordinary shape file that Parser::parseShapes() can read; only the record order differs.
+ * The page table is kept in a sidecar (the paged file name followed by ".pages"), stamped like the ShapeIndex sidecar.
+ * A shape may extend past its cell, so each page records the bounds of its shapes, and pages are chosen by those bounds.
+ * \sa PageCache
+ */
+class PagedShapeFile
+{
+public:
+
+    static constexpr int DEFAULT_PAGE_SIZE = 1024;  /*!< The page width and height used when none is given, in canvas units */
+
+    //! Default constructor
+    PagedShapeFile() : pageSize{DEFAULT_PAGE_SIZE} {}
+
+    //! Writes a paged copy of a shape file and its page table.
+    /*! Pages are written row by row; inside a page, records keep their order from the source file.
+     * \param sourceFileName the path of the shape file
+     * \param pagedFileName the path of the paged file to be written; an existing file is replaced
+     * \param pageSize the width and height of a page, in canvas units
+     * \returns FALSE if a file cannot be read or written.
+     */
+    static bool paginate(const std::string &sourceFileName, const std::string &pagedFileName, int pageSize = DEFAULT_PAGE_SIZE);
+
+    //! Reads the page table of a paged file.
+    /*! \param pagedFileName the path of the paged file
+     * \returns FALSE if the page table is missing, damaged, or was written for a different version of the paged file.
+     */
+    bool open(const std::string &pagedFileName);
+
+    //! Gets the path of the page table of a paged file.
+    static std::string pageTableName(const std::string &pagedFileName) {return pagedFileName + ".pages";}
+
+    //! Gets the width and height of a page, in canvas units.
+    int getPageSize() const {return pageSize;}
+
+    //! Gets the number of pages.
+    int size() const {return int(pages.size());}
+
+    //! Gets the number of bytes used by the page table and the map from grid cell to page.
+    std::size_t memoryBytes() const;
+
+    //! Gets a page by position, in file order.
+    const ShapePage &at(int page) const {return pages[page];}
+
+    //! Finds the page of a grid cell.
+    /*! \param column the column of the cell
+     * \param row the row of the cell
+     * \returns The position of the page, or -1 if no shape lies in the cell.
+     */
+    int find(int column, int row) const;
+
+    //! Finds the pages holding shapes that may be visible in a region.
+    /*! \param region the region in canvas coordinates
+     * \returns The positions of the pages whose bounds intersect the region, in file order.
+     */
+    std::vector<int> query(const QRect &region) const;
+
+    //! Gets the grid cell of a canvas coordinate.
+    /*! Rounds toward negative infinity, so negative coordinates fall in negative cells.
+     * \param coordinate an x or y coordinate
+     * \param pageSize the width and height of a page
+     * \returns The column (for x) or row (for y).
+     */
+    static int cellOf(int coordinate, int pageSize) {return coordinate >= 0 ? coordinate / pageSize : -((-coordinate - 1) / pageSize) - 1;}
+
+private:
+
+    //! Combines a column and a row into one key.
+    static long long cellKey(int column, int row) {return (static_cast<long long>(column) << 32) | static_cast<unsigned int>(row);}
+
+    //! Writes the page table of a paged file.
+    /*! \returns FALSE if the page table cannot be written.
+     */
+    bool save(const std::string &pagedFileName) const;
+
+    //! Rebuilds the map from grid cell to page position.
+    void rebuildLookup();
+
+    std::vector<ShapePage> pages;                   /*!< every page, in file order */
+    std::unordered_map<long long, int> pageOfCell;  /*!< the position of the page of each occupied grid cell */
+    int pageSize;                                   /*!< the width and height of a page, in canvas units */
+};
+
+#endif // PAGEDSHAPEFILE_H
@@ -0,0 +1,206 @@
+#include "parallelsaver.h"
+#include "shapewriter.h"
+#include "tracing.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define PARALLEL_SAVER_WRITEV
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <limits.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    //! Gets the milliseconds elapsed since a point in time.
+    double millisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+}
+
+/*! Every shape but the last is followed by an empty line, as in the sequential save, so chunk boundaries need no special case. */
+SaveTimings ParallelSaver::save(const std::string &fileName, const ShapeBatches &shapes, int maxThreads)
+{
+    TRACE_SCOPE("save", "parallelSave");
+
+    Clock::time_point start = Clock::now();
+    SaveTimings timings;
+
+    const int shapeCount = shapes.size();
+
+    if(maxThreads <= 0)
+    {
+        maxThreads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+
+    int maxChunks = std::max(1, (shapeCount + MIN_CHUNK_SHAPES - 1) / MIN_CHUNK_SHAPES);
+    int chunkCount = std::min(maxThreads * CHUNKS_PER_THREAD, maxChunks);
+    int threadCount = std::min(maxThreads, chunkCount);
+    int chunkShapes = (shapeCount + chunkCount - 1) / chunkCount;
+
+    if(int(chunkBuffers.size()) < chunkCount)
+    {
+        chunkBuffers.resize(chunkCount);
+    }
+    chunkSizes.assign(chunkCount, 0);
+
+    std::atomic<int> nextChunk{0};
+
+    auto formatChunks = [&]()
+    {
+        for(int chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+        {
+            TRACE_SCOPE("save", "formatChunk");
+
+            int first = std::min(chunk * chunkShapes, shapeCount);
+            int last = std::min(first + chunkShapes, shapeCount);
+
+            ShapeWriter writer(chunkBuffers[chunk]);
+
+            shapes.forEachInRange(first, last, [&](const auto &shape, int i)
+            {
+                shape.serialize(writer);
+
+                if(i < shapeCount - 1)
+                {
+                    writer.newline();
+                }
+            });
+
+            chunkSizes[chunk] = std::size_t(writer.getBytesWritten());
+        }
+    };
+
+    Clock::time_point formatStart = Clock::now();
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+
+    for(int i = 1; i < threadCount; ++i)
+    {
+        workers.emplace_back(formatChunks);
+    }
+
+    formatChunks();
+
+    for(std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    timings.formatMilliseconds = millisecondsSince(formatStart);
+
+    Clock::time_point writeStart = Clock::now();
+
+    timings.bytesWritten = writeChunks(fileName, chunkCount);
+    timings.writeMilliseconds = millisecondsSince(writeStart);
+
+    timings.parallel = true;
+    timings.threadCount = threadCount;
+    timings.chunkCount = chunkCount;
+    timings.totalMilliseconds = millisecondsSince(start);
+
+    return timings;
+}
+
+std::size_t ParallelSaver::memoryBytes() const
+{
+    std::size_t bytes = chunkBuffers.capacity() * sizeof(std::vector<char>) + chunkSizes.capacity() * sizeof(std::size_t);
+
+    for(const std::vector<char> &buffer : chunkBuffers)
+    {
+        bytes += buffer.capacity();
+    }
+
+    return bytes;
+}
+
+void ParallelSaver::release()
+{
+    std::vector<std::vector<char>>().swap(chunkBuffers);
+    std::vector<std::size_t>().swap(chunkSizes);
+}
+
+/*! Without writev the chunks go through an fstream opened like the sequential save's, so text mode line endings match it. */
+long long ParallelSaver::writeChunks(const std::string &fileName, int chunkCount) const
+{
+    TRACE_SCOPE("save", "writeChunks");
+
+    long long bytesWritten{0};
+
+#ifdef PARALLEL_SAVER_WRITEV
+    int fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if(fd < 0)
+    {
+        return 0;
+    }
+
+    std::vector<iovec> blocks;
+    blocks.reserve(chunkCount);
+
+    for(int chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        if(chunkSizes[chunk] > 0)
+        {
+            blocks.push_back({const_cast<char*>(chunkBuffers[chunk].data()), chunkSizes[chunk]});
+        }
+    }
+
+    std::size_t next{0};
+
+    while(next < blocks.size())
+    {
+        int count = int(std::min<std::size_t>(blocks.size() - next, IOV_MAX));
+        ssize_t written = ::writev(fd, &blocks[next], count);
+
+        if(written < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        bytesWritten += written;
+
+        // Skip the blocks written completely and trim the one written in part.
+        while(next < blocks.size() && std::size_t(written) >= blocks[next].iov_len)
+        {
+            written -= ssize_t(blocks[next].iov_len);
+            ++next;
+        }
+
+        if(next < blocks.size())
+        {
+            blocks[next].iov_base = static_cast<char*>(blocks[next].iov_base) + written;
+            blocks[next].iov_len -= std::size_t(written);
+        }
+    }
+
+    ::close(fd);
+#else
+    std::fstream fout(fileName, std::ios::out);
+
+    for(int chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        fout.write(chunkBuffers[chunk].data(), std::streamsize(chunkSizes[chunk]));
+        bytesWritten += (long long)(chunkSizes[chunk]);
+    }
+
+    fout.close();
+#endif
+
+    return bytesWritten;
+}
@@ -0,0 +1,74 @@
+/*!
+ * \class   ParallelSaver
+ * \brief   Saves a large document by formatting chunks of shapes on several threads and writing the chunks in order.
+*/
+
+#ifndef PARALLELSAVER_H
+#define PARALLELSAVER_H
+
+#include "shapevariant.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/*! \struct SaveTimings
+ * \brief The counters recorded by the last save.
+ * \sa AllShapes::getLastSaveTimings()
+ */
+struct SaveTimings
+{
+    bool parallel{false};               /*!< TRUE if the last save used the parallel mode */
+    int threadCount{0};                 /*!< the number of threads that formatted shapes */
+    int chunkCount{0};                  /*!< the number of chunks the shapes were split into */
+    long long bytesWritten{0};          /*!< the size of the saved file */
+    double formatMilliseconds{0.0};     /*!< the time spent formatting; includes the writes in the sequential mode */
+    double writeMilliseconds{0.0};      /*!< the time spent writing the formatted chunks; 0 in the sequential mode */
+    double totalMilliseconds{0.0};      /*!< the time spent on the whole save, including opening the file */
+};
+
+/*! The ordered shapes are split into contiguous chunks. Worker threads take the next unformatted chunk until none are left,
+ * and serialize it into that chunk's own buffer with a collecting ShapeWriter.
+ * Once every chunk is formatted, the buffers are written to the file in chunk order with vectored I/O (writev) on POSIX systems,
+ * and with one write per chunk elsewhere. The file is byte-identical to the one written by the sequential save.
+ * The chunk buffers are kept between saves, so a repeated save reuses their memory.
+ * \sa AllShapes::printAll()
+ */
+class ParallelSaver
+{
+public:
+
+    static constexpr int MIN_CHUNK_SHAPES = 2048;                   /*!< The smallest number of shapes formatted as one chunk */
+    static constexpr int MIN_PARALLEL_SHAPES = 2 * MIN_CHUNK_SHAPES; /*!< Documents smaller than this are saved sequentially */
+    static constexpr int CHUNKS_PER_THREAD = 4;                     /*!< The number of chunks per thread, so threads that finish early take more work */
+
+    //! Default constructor
+    ParallelSaver() {}
+
+    //! Saves shapes to a file.
+    /*! \param fileName the path of the file to be written; an existing file is replaced
+     * \param shapes the shapes to be saved, in order
+     * \param maxThreads the largest number of threads to use; 0 uses one per hardware thread
+     * \returns The counters of this save.
+     */
+    SaveTimings save(const std::string &fileName, const ShapeBatches &shapes, int maxThreads = 0);
+
+    //! Gets the number of bytes held by the chunk buffers.
+    std::size_t memoryBytes() const;
+
+    //! Frees the chunk buffers; the next save allocates them again.
+    void release();
+
+private:
+
+    //! Writes the formatted chunks to a file in chunk order.
+    /*! \param fileName the path of the file to be written
+     * \param chunkCount the number of formatted chunks
+     * \returns The number of bytes written.
+     */
+    long long writeChunks(const std::string &fileName, int chunkCount) const;
+
+    std::vector<std::vector<char>> chunkBuffers;    /*!< the buffer each chunk is formatted into */
+    std::vector<std::size_t> chunkSizes;            /*!< the number of bytes of each chunk buffer holding text */
+};
+
+#endif // PARALLELSAVER_H
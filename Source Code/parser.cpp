@@ -1,200 +1,701 @@
 #include "parser.h"
+#include "intscanner.h"
+#include "keywordtables.h"
+#include "perfcounters.h"
+#include "tracing.h"
+#include "shapewriter.h"
+#include <charconv>
+#include <memory>
+
+/*! The shape type keywords must map to ShapeLabels::eShapes and match ShapeLabels::SHAPES_LIST */
+static_assert(keywords::SHAPE_TYPE_TABLE.find("Line") == ShapeLabels::LINE && keywords::SHAPE_TYPE_TABLE.find("Text") == ShapeLabels::TEXT,
+              "Shape type keyword values do not match ShapeLabels::eShapes");
+
+namespace
+{
+    //! Gets the position of the first character at or after a position that is not a space or a tab.
+    std::size_t skipSpaces(std::string_view text, std::size_t position)
+    {
+        while(position < text.size() && (text[position] == ' ' || text[position] == '\t'))
+        {
+            ++position;
+        }
+
+        return position;
+    }
+
+    //! Checks whether a line holds nothing but white space.
+    bool isBlank(std::string_view line)
+    {
+        return skipSpaces(line, 0) == line.size();
+    }
+
+    //! Checks whether a line starts a new record.
+    bool isRecordStart(std::string_view line)
+    {
+        return line.substr(0, ShapeFields::SHAPE_ID.size() - 1) == ShapeFields::SHAPE_ID.substr(0, ShapeFields::SHAPE_ID.size() - 1);
+    }
+
+    //! Checks the number of dimensions of a shape type.
+    /*! \param shapeType the type of shape
+     * \param count the number of dimensions read
+     * \param expected set to the number of dimensions the type needs; -1 for polylines and polygons
+     * \returns TRUE if the count is valid: the fixed count, or an even count of at least 4 for polylines and polygons.
+     */
+    bool isValidDimensionCount(ShapeLabels::eShapes shapeType, int count, int &expected)
+    {
+        using namespace ShapeLabels;
+
+        switch(shapeType)
+        {
+        case LINE:      expected = NUM_SHAPE_DIMENSIONS[0]; break;
+        case RECTANGLE: expected = NUM_SHAPE_DIMENSIONS[1]; break;
+        case SQUARE:    expected = NUM_SHAPE_DIMENSIONS[2]; break;
+        case ELLIPSE:   expected = NUM_SHAPE_DIMENSIONS[3]; break;
+        case CIRCLE:    expected = NUM_SHAPE_DIMENSIONS[4]; break;
+        case TEXT:      expected = NUM_SHAPE_DIMENSIONS[5]; break;
+        default:        expected = -1;
+                        return count >= 4 && count % 2 == 0;
+        }
+
+        return count == expected;
+    }
+}
+
+/*! \struct Parser::LineCursor
+ * \brief A position in text being parsed, and the number of the line last read.
+ */
+struct Parser::LineCursor
+{
+    std::string_view text;      /*!< the text being parsed */
+    std::size_t position{0};    /*!< the position of the next line */
+    int line{0};                /*!< the number of the line last read, counted from 1 */
+
+    //! Reads the next line, without its line break or a carriage return before it.
+    /*! \returns FALSE at the end of the text.
+     */
+    bool next(std::string_view &result)
+    {
+        if(position >= text.size())
+        {
+            return false;
+        }
+
+        std::size_t end = text.find('\n', position);
+
+        if(end == std::string_view::npos)
+        {
+            end = text.size();
+        }
+
+        result = text.substr(position, end - position);
+        position = end + 1;
+        ++line;
+
+        if(!result.empty() && result.back() == '\r')
+        {
+            result.remove_suffix(1);
+        }
+
+        return true;
+    }
+};
 
 //! Gets a single string from the input file and extracts the useful information.
 //! Returns this information as a string.
-string Parser::getStringFromFile(fstream &file)
+string Parser::getStringFromFile(istream &file)
 {
     string temp;
 
     file.ignore(numeric_limits<streamsize>::max(), ' ');
     getline(file, temp, '\n');
 
+    if(!temp.empty() && temp.back() == '\r')
+    {
+        temp.pop_back();
+    }
+
     return temp;
 }
 
+//! Splits a line of comma separated dimensions into integers.
+int Parser::readDimensions(std::string_view dimString, std::vector<int> &dims)
+{
+    const char *first = dimString.data();
+    const char *last = first + dimString.size();
+
+    dims.resize(std::size_t(intscan::countFields(first, last)));
+
+    return intscan::parseList(first, last, dims.data(), int(dims.size()));
+}
+
 //! Gets a pointer to a new polymorphic shape depending on the string passed in.
-Shape* Parser::getShapePtr(std::string shapeType, QPaintDevice *device)
+/*! Returns nullptr if the shape type written into the file is not recognized. */
+Shape* Parser::getShapePtr(std::string_view shapeType, QPaintDevice * /*device*/)
+{
+    int type = keywords::SHAPE_TYPE_TABLE.find(shapeType);
+
+    if(type < 0)
+    {
+        return nullptr;
+    }
+
+    return createShape(ShapeLabels::eShapes(type));
+}
+
+//! Creates an empty shape of the type passed in.
+Shape* Parser::createShape(ShapeLabels::eShapes shapeType)
 {
     using namespace ShapeLabels;
 
-    Shape* p_Shape = nullptr;
+    switch(shapeType)
+    {
+    case LINE:      return new Line();
+    case POLYLINE:  return new Polyline();
+    case POLYGON:   return new Polygon();
+    case RECTANGLE: return new Rectangle();
+    case SQUARE:    return new Square();
+    case ELLIPSE:   return new Ellipse();
+    case CIRCLE:    return new Circle();
+    case TEXT:      return new Text();
+    }
+
+    return nullptr;
+}
+
+//! Returns the pen ID matching the pen properties of a shape.
+int Parser::resolvePen(std::string_view color, int width, std::string_view style, std::string_view capStyle, std::string_view joinStyle)
+{
+    styleKey.assign(color);
+    styleKey += '\n';
+    styleKey += std::to_string(width);
+    styleKey += '\n';
+    styleKey += style;
+    styleKey += '\n';
+    styleKey += capStyle;
+    styleKey += '\n';
+    styleKey += joinStyle;
+
+    unordered_map<string, int>::const_iterator it = penIds.find(styleKey);
+
+    if(it != penIds.end())
+    {
+        return it -> second;
+    }
+
+    QPen pen;
+
+    pen.setColor(QColor(convertToGlobalColor(color)));
+    pen.setWidth(width);
+    pen.setStyle(convertToPenStyle(style));
+    pen.setCapStyle(convertToPenCapStyle(capStyle));
+    pen.setJoinStyle(convertToPenJoinStyle(joinStyle));
+
+    int id = StyleTable::shared().internPen(pen);
+    penIds.emplace(styleKey, id);
+
+    return id;
+}
+
+//! Returns the pen ID matching a text color.
+int Parser::resolveTextPen(std::string_view color)
+{
+    styleKey.assign(color);
+
+    unordered_map<string, int>::const_iterator it = textPenIds.find(styleKey);
+
+    if(it != textPenIds.end())
+    {
+        return it -> second;
+    }
+
+    QPen pen;
+
+    pen.setColor(QColor(convertToGlobalColor(color)));
+
+    int id = StyleTable::shared().internPen(pen);
+    textPenIds.emplace(styleKey, id);
+
+    return id;
+}
+
+//! Returns the brush ID matching the brush properties of a shape.
+int Parser::resolveBrush(std::string_view color, std::string_view style)
+{
+    styleKey.assign(color);
+    styleKey += '\n';
+    styleKey += style;
+
+    unordered_map<string, int>::const_iterator it = brushIds.find(styleKey);
+
+    if(it != brushIds.end())
+    {
+        return it -> second;
+    }
+
+    QBrush brush;
+
+    brush.setColor(QColor(convertToGlobalColor(color)));
+    brush.setStyle(convertToBrushStyle(style));
+
+    int id = StyleTable::shared().internBrush(brush);
+    brushIds.emplace(styleKey, id);
+
+    return id;
+}
+
+//! Returns the font ID matching the font properties of a text box.
+int Parser::resolveFont(int pointSize, std::string_view family, std::string_view style, std::string_view weight)
+{
+    styleKey.assign(std::to_string(pointSize));
+    styleKey += '\n';
+    styleKey += family;
+    styleKey += '\n';
+    styleKey += style;
+    styleKey += '\n';
+    styleKey += weight;
+
+    unordered_map<string, int>::const_iterator it = fontIds.find(styleKey);
 
-    /*! Throws an exception if the shape type written into the file is not recognized. */
-    try
+    if(it != fontIds.end())
     {
-        if(shapeType == SHAPES_LIST[eShapes::LINE])
+        return it -> second;
+    }
+
+    QFont font;
+
+    font.setPointSize(pointSize);
+    font.setFamily(QString::fromStdString(std::string(family)));
+    font.setStyle(convertToQFontStyle(style));
+    font.setWeight(convertToQFontWeight(weight));
+
+    int id = StyleTable::shared().internFont(font);
+    fontIds.emplace(styleKey, id);
+
+    return id;
+}
+
+/*! Every field is read and checked before the shape is created, so a bad record leaves nothing behind.
+ * Errors are reported through return values only; nothing here throws.
+ */
+bool Parser::parseNextRecord(LineCursor &cursor, QPaintDevice * /*device*/, ParseReport &report, Shape *&p_Shape)
+{
+    using namespace ShapeFields;
+
+    p_Shape = nullptr;
+
+    std::string_view line;
+
+    /*! Skips the empty lines between records */
+    do
+    {
+        if(!cursor.next(line))
+        {
+            return false;
+        }
+    } while(isBlank(line));
+
+    bool firstLine{true};
+
+    /*! Reports an error and returns FALSE, so field checks can end with "return fail(...)" */
+    auto fail = [&](std::size_t column, std::string_view label, const std::string &message)
+    {
+        report.addError(cursor.line, int(column) + 1, std::string(label.substr(0, label.size() - 2)), message);
+        return false;
+    };
+
+    /*! Reads the next line of the record and checks its label */
+    auto readField = [&](std::string_view label, std::string_view &value, std::size_t &valueColumn)
+    {
+        if(!firstLine)
+        {
+            LineCursor before = cursor;
+
+            if(!cursor.next(line) || isBlank(line))
+            {
+                return fail(0, label, "the record ends before this field");
+            }
+
+            /*! A missing field must not swallow the first line of the next record */
+            if(isRecordStart(line))
+            {
+                cursor = before;
+                report.addError(before.line + 1, 1, std::string(label.substr(0, label.size() - 2)), "the record ends before this field");
+                return false;
+            }
+        }
+
+        firstLine = false;
+
+        if(line.substr(0, label.size()) == label)
         {
-            p_Shape = new Line();
+            value = line.substr(label.size());
+            valueColumn = label.size();
+            return true;
         }
-        else if(shapeType == SHAPES_LIST[eShapes::POLYLINE])
+
+        if(line == label.substr(0, label.size() - 1))
         {
-            p_Shape = new Polyline();
+            value = std::string_view();
+            valueColumn = line.size();
+            return true;
         }
-        else if(shapeType == SHAPES_LIST[eShapes::POLYGON])
+
+        return fail(0, label, "expected \"" + std::string(label.substr(0, label.size() - 1)) + "\"");
+    };
+
+    /*! Reads a field holding one integer */
+    auto readNumber = [&](std::string_view label, int &number)
+    {
+        std::string_view value;
+        std::size_t column;
+
+        if(!readField(label, value, column))
         {
-            p_Shape = new Polygon();
+            return false;
         }
-        else if(shapeType == SHAPES_LIST[eShapes::RECTANGLE])
+
+        std::size_t first = skipSpaces(value, 0);
+        std::size_t last = value.find_last_not_of(" \t");
+
+        if(first == value.size())
         {
-            p_Shape = new Rectangle();
+            return fail(column, label, "missing number");
         }
-        else if(shapeType == SHAPES_LIST[eShapes::SQUARE])
+
+        std::from_chars_result result = std::from_chars(value.data() + first, value.data() + last + 1, number);
+
+        if(result.ec == std::errc::result_out_of_range)
         {
-            p_Shape = new Square();
+            return fail(column + first, label, "number out of range");
         }
-        else if(shapeType == SHAPES_LIST[eShapes::ELLIPSE])
+
+        if(result.ec != std::errc() || result.ptr != value.data() + last + 1)
         {
-            p_Shape = new Ellipse();
+            return fail(column + std::size_t(result.ptr - value.data()), label, "not a number");
         }
-        else if(shapeType == SHAPES_LIST[eShapes::CIRCLE])
+
+        return true;
+    };
+
+    /*! Reads a field holding one keyword of a keyword table */
+    auto readKeyword = [&](std::string_view label, const auto &table, std::string_view &keyword)
+    {
+        std::size_t column;
+
+        if(!readField(label, keyword, column))
         {
-            p_Shape = new Circle();
+            return false;
         }
-        else if(shapeType == SHAPES_LIST[eShapes::TEXT])
+
+        if(table.find(keyword) < 0)
+        {
+            return fail(column, label, "unknown value \"" + std::string(keyword) + "\"");
+        }
+
+        return true;
+    };
+
+    int shapeId;
+    std::string_view typeName;
+    std::string_view dimString;
+    std::size_t column;
+
+    std::string_view color, style, capStyle, joinStyle, brushColor, brushStyle;
+    std::string_view textString, alignment, family, weight;
+    int width{0};
+    int pointSize{0};
+
+    bool valid = readNumber(SHAPE_ID, shapeId)
+                 && readKeyword(SHAPE_TYPE, keywords::SHAPE_TYPE_TABLE, typeName)
+                 && readField(SHAPE_DIMENSIONS, dimString, column);
+
+    ShapeLabels::eShapes shapeType = ShapeLabels::eShapes(keywords::SHAPE_TYPE_TABLE.find(typeName));
+
+    /*! The dimensions are read straight into the new shape, which is deleted again if a later field has an error */
+    std::unique_ptr<Shape> newShape;
+
+    if(valid)
+    {
+        const char *first = dimString.data();
+        const char *last = first + dimString.size();
+        int count = intscan::countFields(first, last);
+        int expected;
+
+        if(!isValidDimensionCount(shapeType, count, expected))
         {
-            p_Shape = new Text();
+            valid = fail(column, SHAPE_DIMENSIONS, expected < 0 ? "expected an even number of at least 4 dimensions, found " + std::to_string(count)
+                                                                : "expected " + std::to_string(expected) + " dimensions, found " + std::to_string(count));
         }
         else
         {
-            throw shapeException("\n***ERROR - NO APPROPRIATE SHAPE TYPE WAS FOUND IN THE INPUT FILE***\n\n");
+            newShape.reset(createShape(shapeType));
+
+            int badPosition = intscan::parseList(first, last, newShape -> resetDimensions(shapeId, count), count);
+
+            if(badPosition >= 0)
+            {
+                valid = fail(column + std::size_t(badPosition), SHAPE_DIMENSIONS, "not a number");
+            }
+        }
+    }
+
+    if(valid && shapeType == ShapeLabels::TEXT)
+    {
+        valid = readField(TEXT_STRING, textString, column)
+                && readKeyword(TEXT_COLOR, keywords::COLOR_TABLE, color)
+                && readKeyword(TEXT_ALIGNMENT, keywords::ALIGNMENT_TABLE, alignment)
+                && readNumber(TEXT_POINT_SIZE, pointSize)
+                && readField(TEXT_FONT_FAMILY, family, column)
+                && readKeyword(TEXT_FONT_STYLE, keywords::FONT_STYLE_TABLE, style)
+                && readKeyword(TEXT_FONT_WEIGHT, keywords::FONT_WEIGHT_TABLE, weight);
+    }
+    else if(valid)
+    {
+        valid = readKeyword(PEN_COLOR, keywords::COLOR_TABLE, color)
+                && readNumber(PEN_WIDTH, width)
+                && readKeyword(PEN_STYLE, keywords::PEN_STYLE_TABLE, style)
+                && readKeyword(PEN_CAP_STYLE, keywords::CAP_STYLE_TABLE, capStyle)
+                && readKeyword(PEN_JOIN_STYLE, keywords::JOIN_STYLE_TABLE, joinStyle);
+
+        if(valid && shapeType != ShapeLabels::LINE && shapeType != ShapeLabels::POLYLINE)
+        {
+            valid = readKeyword(BRUSH_COLOR, keywords::COLOR_TABLE, brushColor)
+                    && readKeyword(BRUSH_STYLE, keywords::BRUSH_STYLE_TABLE, brushStyle);
         }
     }
-    catch(shapeException shapeTypeEx)
+
+    if(!valid)
+    {
+        /*! Skips the rest of the bad record: up to an empty line or the start of the next record */
+        LineCursor before = cursor;
+
+        while(cursor.next(line) && !isBlank(line))
+        {
+            if(isRecordStart(line))
+            {
+                cursor = before;
+                break;
+            }
+
+            before = cursor;
+        }
+
+        ++report.recordsSkipped;
+        return true;
+    }
+
+    p_Shape = newShape.release();
+    p_Shape -> setPosition();
+
+    if(shapeType == ShapeLabels::TEXT)
+    {
+        Text *p_Text = static_cast<Text*>(p_Shape);
+
+        // SETS PEN, FONT, TEXT QUALITIES
+        p_Text -> setText(std::string(textString));
+        p_Text -> setPenId(resolveTextPen(color));
+        p_Text -> setAlignment(convertToAlignmentFlag(alignment));
+        p_Text -> setFontId(resolveFont(pointSize, family, style, weight));
+    }
+    else
+    {
+        p_Shape -> setPenId(resolvePen(color, width, style, capStyle, joinStyle));
+
+        if(shapeType != ShapeLabels::LINE && shapeType != ShapeLabels::POLYLINE)
+        {
+            p_Shape -> setBrushId(resolveBrush(brushColor, brushStyle));
+        } // end if
+    } // end else
+
+    ++report.recordsParsed;
+    return true;
+}
+
+//! Parses every record of a block of text.
+int Parser::parseText(std::string_view text, std::vector<Shape*> &shapes, QPaintDevice *device, ParseReport &report, int maxRecords,
+                      IdAllocator *ids)
+{
+    TRACE_SCOPE("parser", "parseText");
+    PERF_SCOPE(PARSE);
+
+    LineCursor cursor;
+    cursor.text = text;
+
+    int shapeCount{0};
+    int records{0};
+    Shape *p_Shape;
+
+    while((maxRecords < 0 || records < maxRecords) && parseNextRecord(cursor, device, report, p_Shape))
     {
-        shapeTypeEx.what();
+        ++records;
+
+        if(p_Shape != nullptr && ids != nullptr && !ids -> reserve(p_Shape -> getID()))
+        {
+            report.addError(cursor.line, 1, "ShapeId", "shape ID " + std::to_string(p_Shape -> getID()) + " is already used by another record");
+            --report.recordsParsed;
+            ++report.recordsSkipped;
+
+            delete p_Shape;
+            p_Shape = nullptr;
+        }
+
+        if(p_Shape != nullptr)
+        {
+            shapes.push_back(p_Shape);
+            ++shapeCount;
+        }
     }
 
+    PERF_COUNT(SHAPES_PARSED, shapeCount);
+
+    return shapeCount;
+}
+
+//! Parses the first record of a block of text.
+Shape* Parser::parseRecord(std::string_view record, QPaintDevice *device, ParseReport &report)
+{
+    LineCursor cursor;
+    cursor.text = record;
+
+    Shape *p_Shape = nullptr;
+    parseNextRecord(cursor, device, report, p_Shape);
+
     return p_Shape;
 }
 
-//! Parses the entire shape input file and populates the vector.
-int Parser::parseShapes(myVector::vector<Shape*> &v_shapes, QPaintDevice *device)
+//! Parses the entire shape input file, collecting errors, and populates the vector.
+/*! The file is read into memory in one block and parsed from there. */
+int Parser::parseShapes(myVector::vector<Shape*> &v_shapes, QPaintDevice *device, ParseReport &report, IdAllocator *ids)
 {
+    TRACE_SCOPE("parser", "parseShapes");
+
     using std::string;
     string filename = "shapes.txt";
-    std::fstream datafile(filename.c_str(), std::ios::in);
-    string line;
-    int shapeCount{0};
+    std::ifstream datafile(filename.c_str(), std::ios::in | std::ios::binary);
 
-    int tempId;
-    string tempName;
-    string dimString;
-    int tempNumDimensions;
-    int *tempDimensions;
+    if(!datafile.is_open())
+    {
+        report.addError(0, 0, "file", "cannot open " + filename);
+        return 0;
+    }
+
+    string text;
 
-    if(datafile.is_open())
     {
-        while(datafile.good())
-        {
-            tempId = stoi(getStringFromFile(datafile));
+        TRACE_SCOPE("parser", "readFile");
 
-            tempName = getStringFromFile(datafile);
+        datafile.seekg(0, std::ios::end);
+        text.resize(std::size_t(datafile.tellg()));
+        datafile.seekg(0, std::ios::beg);
+        datafile.read(&text[0], std::streamsize(text.size()));
+        datafile.close();
+    }
 
-            Shape *p_Shape = nullptr;
-            p_Shape = getShapePtr(tempName, device);
+    std::vector<Shape*> shapes;
+    int shapeCount = parseText(text, shapes, device, report, -1, ids);
 
-            std::vector<int> v_dims;
-            int dim;
+    for(Shape *p_Shape : shapes)
+    {
+        v_shapes.push_back(p_Shape);
+    }
 
-            /*! Takes in and stores the line from the file */
-            dimString = getStringFromFile(datafile);
-            std::istringstream buffer{dimString};
+    return shapeCount;
+} // end parseShapes(...)
 
-            /*! Parses through the line */
-            while(buffer >> dim)
-            {
-                /*! Adds a dimension to the dimension vector */
-                v_dims.push_back(dim);
+/*! A record starts at a line beginning with "ShapeId:" and ends where the next record starts (or at the end of the file),
+ * so the blank line between two records belongs to the first one.
+ * The bounding box is computed by a dimensions-only shape of the record's type, so it always matches Shape::getBoundingBox().
+ */
+int Parser::indexShapes(istream &file, std::vector<ShapeIndexEntry> &entries)
+{
+    const string ID_LABEL = "ShapeId:";
 
-                /*! Looks ahead for white space + comma, if it sees this, ignores these characters and takes in the next dimension */
-                if((buffer >> std::ws).peek() == ',')
-                {
-                    buffer.ignore();
-                }
-            } // end while
+    string line;
+    std::unique_ptr<Shape> probes[NUM_SHAPES];
+    long long offset{0};
 
-            tempNumDimensions = v_dims.size();
+    /*! Returns the text after the label of a line, as getStringFromFile() does */
+    auto fieldValue = [](const string &text)
+    {
+        string::size_type start = text.find(' ');
+        string::size_type end = text.size();
 
-            tempDimensions = new int[v_dims.size()];
+        if(end > 0 && text[end - 1] == '\r')
+        {
+            --end;
+        }
 
-            for(int i = 0; i < v_dims.size(); ++i)
-            {
-                tempDimensions[i] = v_dims[i];
-            } // end for
+        return start == string::npos || start >= end ? string() : text.substr(start + 1, end - start - 1);
+    };
 
-            p_Shape -> setBaseInfo(tempId, tempName, tempNumDimensions, tempDimensions);
-            p_Shape -> setPosition();
+    entries.clear();
 
-            delete[] tempDimensions;
-            tempDimensions = nullptr;
+    while(getline(file, line))
+    {
+        long long lineStart = offset;
+        offset += (long long)(line.size()) + (file.eof() ? 0 : 1);
 
-            if(tempName == "Text")
-            {
-                QPen pen;
-                QFont font;
-
-                // READS IN DATA, SETS PEN, FONT, TEXT QUALITIES
-                p_Shape -> setText(getStringFromFile(datafile));
-                pen.setColor(QColor(convertToGlobalColor(getStringFromFile(datafile))));
-                p_Shape -> setAlignment(convertToAlignmentFlag((getStringFromFile(datafile))));
-                font.setPointSize(stoi(getStringFromFile(datafile)));
-                font.setFamily(QString::fromStdString(getStringFromFile(datafile)));
-                font.setStyle(convertToQFontStyle(getStringFromFile(datafile)));
-                font.setWeight(convertToQFontWeight(getStringFromFile(datafile)));
-
-                // SETS QPen AND QFont OBJECTS
-                p_Shape -> setPen(pen);
-                p_Shape -> setFont(font);
+        if(line.compare(0, ID_LABEL.size(), ID_LABEL) != 0)
+        {
+            continue;
+        }
 
-            }
-            else
-            {
-                QPen pen;
+        if(!entries.empty())
+        {
+            entries.back().length = lineStart - entries.back().offset;
+        }
 
-                pen.setColor(QColor(convertToGlobalColor(getStringFromFile(datafile))));
-                pen.setWidth(stoi(getStringFromFile(datafile)));
-                pen.setStyle(convertToPenStyle(getStringFromFile(datafile)));
-                pen.setCapStyle(convertToPenCapStyle(getStringFromFile(datafile)));
-                pen.setJoinStyle(convertToPenJoinStyle(getStringFromFile(datafile)));
+        ShapeIndexEntry entry;
 
-                p_Shape -> setPen(pen);
+        std::string_view idText = std::string_view(line).substr(skipSpaces(line, ID_LABEL.size()));
+        std::from_chars_result idResult = std::from_chars(idText.data(), idText.data() + idText.size(), entry.shapeId);
 
-                if(tempName != "Line" && tempName != "Polyline")
-                {
-                    QBrush brush;
+        entry.offset = lineStart;
 
-                    brush.setColor(QColor(convertToGlobalColor(getStringFromFile(datafile))));
-                    brush.setStyle(convertToBrushStyle(getStringFromFile(datafile)));
+        /*! The type and dimensions lines follow the ID line */
+        string typeLine;
+        string dimLine;
 
-                    p_Shape -> setBrush(brush);
-                } // end if
-            } // end else
+        getline(file, typeLine);
+        offset += (long long)(typeLine.size()) + (file.eof() ? 0 : 1);
+        getline(file, dimLine);
+        offset += (long long)(dimLine.size()) + (file.eof() ? 0 : 1);
 
-            v_shapes.push_back(p_Shape);
-            shapeCount++;
+        int shapeType = keywords::SHAPE_TYPE_TABLE.find(fieldValue(typeLine));
+        string dimString = fieldValue(dimLine);
+        const char *first = dimString.data();
+        const char *last = first + dimString.size();
+        int count = intscan::countFields(first, last);
+        int expected;
 
-            datafile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        } // end while
-    } // end if
+        /*! Records that Parser::parseRecord() would reject for their ID, type, or dimensions are left out of the index */
+        if(idResult.ec != std::errc() || shapeType < 0 || !isValidDimensionCount(ShapeLabels::eShapes(shapeType), count, expected))
+        {
+            continue;
+        }
 
-    /*! Attempts to close the input file.
-     * Throws an exception if the file is not open */
-    try
-    {
-        if(datafile.is_open())
+        /*! One probe shape per type is reused for every record of that type */
+        if(!probes[shapeType])
         {
-            datafile.close();
+            probes[shapeType].reset(createShape(ShapeLabels::eShapes(shapeType)));
         }
-        else
+
+        if(intscan::parseList(first, last, probes[shapeType] -> resetDimensions(entry.shapeId, count), count) >= 0)
         {
-            throw shapeException("\n***ERROR - FILE IS NOT OPEN, CANNOT CLOSE FILE***\n\n");
+            continue;
         }
+
+        entry.shapeType = ShapeLabels::eShapes(shapeType);
+        entry.boundingBox = probes[shapeType] -> getBoundingBox();
+
+        entries.push_back(entry);
     }
-    catch(shapeException fileEx)
+
+    if(!entries.empty())
     {
-        cout << fileEx.what();
+        entries.back().length = offset - entries.back().offset;
     }
 
-    return shapeCount;
-} // end addShape(...)
-
+    return int(entries.size());
+}
@@ -10,11 +10,18 @@
 #include "shape_list.h"
 #include "qtconversions.h"
 #include "shapeexception.h"
+#include "shapeindex.h"
+#include "parsereport.h"
+#include "idallocator.h"
 #include <sstream>
+#include <string_view>
+#include <unordered_map>
 
 using namespace std;
 
 /*! This class purely reads in shape information from a text file and populates a vector of Shape pointers to be returned by reference to the controller class, AllShapes.
+ * Parsing never throws: every field is checked (labels, numbers with std::from_chars and intscan, keywords, the number of dimensions),
+ * a record with a problem is skipped, and the problem is added to a ParseReport.
  */
 class Parser
 {
@@ -28,28 +35,121 @@ public:
 
     //! Gets a single line from the input file.
     /*! Reads in each line of the input file as one string, then parses it individually for information.
-     * \param file the input filestream variable
+     * A carriage return left at the end of the line by a file read in binary mode is removed.
+     * \param file the input stream variable
      * \returns The relevant parsed data as a string
      */
-    string getStringFromFile(fstream &file);
+    string getStringFromFile(istream &file);
 
-    //! Reads in shapes and populates the shape vector from a file
-    /*! Reads through the entire file and populates the shape vector with Shape pointers holding shape specifications and properties.
-     * Tracks the number of shapes that are entering the vector.
+    //! Reads a comma separated list of shape dimensions.
+    /*! \param dimString the dimensions as written in the input file
+     * \param dims the vector that receives the dimensions; it is resized to the number of fields first
+     * \sa intscan::parseList()
+     * \returns The position of the first character that is not part of the list, or -1 if the whole string was read.
+     */
+    int readDimensions(std::string_view dimString, std::vector<int> &dims);
+
+    //! Reads in shapes and populates the shape vector from a file, collecting errors.
+    /*! Records with errors are skipped; the rest of the file is still read.
      * \param v_shapes the vector of Shape pointers, passed in by reference
      * \param device the pointer to the QPaintDevice
+     * \param report the report that receives the errors and record counts
+     * \param ids the allocator that reserves the ID of each shape as it is read, or nullptr
+     * \returns The number of shapes added to the vector.
      * \sa AllShapes::addShapesFromFile()
-     * \returns The number of shapes in the vector.
      */
-    int parseShapes(myVector::vector<Shape*> &v_shapes, QPaintDevice *device);
+    int parseShapes(myVector::vector<Shape*> &v_shapes, QPaintDevice *device, ParseReport &report, IdAllocator *ids = nullptr);
+
+    //! Parses shape records held in memory.
+    /*! \param text the records, in the format of the input file
+     * \param shapes the vector that receives the new shapes, owned by the caller
+     * \param device the pointer to the QPaintDevice
+     * \param report the report that receives the errors and record counts; line numbers count from the start of text
+     * \param maxRecords the largest number of records to read, or -1 to read them all
+     * \param ids the allocator that reserves the ID of each shape as it is read, or nullptr;
+     *            a record whose ID is already in use is reported and skipped
+     * \returns The number of shapes added to the vector.
+     * \sa PageCache
+     */
+    int parseText(std::string_view text, std::vector<Shape*> &shapes, QPaintDevice *device, ParseReport &report, int maxRecords = -1,
+                  IdAllocator *ids = nullptr);
+
+    //! Parses the first shape record held in memory.
+    /*! \param record the record, in the format of the input file
+     * \param device the pointer to the QPaintDevice
+     * \param report the report that receives the errors and record counts
+     * \returns The new shape, owned by the caller, or nullptr if the record has an error.
+     * \sa LazyShapeStore::getShape()
+     */
+    Shape* parseRecord(std::string_view record, QPaintDevice *device, ParseReport &report);
+
+    //! Scans a shape file and records where each shape is stored, without keeping any shape.
+    /*! Only the ID, type, and dimensions lines of each record are parsed; the style lines are skipped.
+     * \param file the input stream variable, opened in binary mode so that offsets are byte positions
+     * \param entries the vector that receives one entry per record, in file order; it is cleared first
+     * \returns The number of records found.
+     * \sa ShapeIndex::build()
+     */
+    int indexShapes(istream &file, std::vector<ShapeIndexEntry> &entries);
 
     //! Creates a pointer of type Shape that relates to a specific derived class object via inheritance & polymorphism
     /*! Depending on the type of shape dictated in the file, returns a pointer to that type of shape.
      * \param shapeType the type of shape, as a string
      * \param device the pointer to the QPaintDevice
-     * \returns The Shape pointer to the specific shape dictated by shapeType.
+     * \returns The Shape pointer to the specific shape dictated by shapeType, or nullptr if the type is not recognized.
      */
-    Shape* getShapePtr(std::string shapeType, QPaintDevice *device);
+    Shape* getShapePtr(std::string_view shapeType, QPaintDevice *device);
+
+    //! Creates an empty shape of a type.
+    /*! \param shapeType the type of shape
+     * \returns The new shape, owned by the caller.
+     */
+    Shape* createShape(ShapeLabels::eShapes shapeType);
+
+    //! Resolves the five pen properties of a shape to a pen ID.
+    /*! The property strings are only converted and interned the first time a combination is seen.
+     * The keywords must already be known to be valid.
+     * \returns The ID of the pen in the shared style table.
+     * \sa StyleTable::internPen()
+     */
+    int resolvePen(std::string_view color, int width, std::string_view style, std::string_view capStyle, std::string_view joinStyle);
+
+    //! Resolves the color of a text box to a pen ID.
+    /*! \param color the text color as written in the input file
+     * \returns The ID of the pen in the shared style table.
+     */
+    int resolveTextPen(std::string_view color);
+
+    //! Resolves the two brush properties of a shape to a brush ID.
+    /*! \returns The ID of the brush in the shared style table.
+     * \sa StyleTable::internBrush()
+     */
+    int resolveBrush(std::string_view color, std::string_view style);
+
+    //! Resolves the four font properties of a text box to a font ID.
+    /*! \returns The ID of the font in the shared style table.
+     * \sa StyleTable::internFont()
+     */
+    int resolveFont(int pointSize, std::string_view family, std::string_view style, std::string_view weight);
+
+private:
+    struct LineCursor;
+
+    //! Parses the record at a cursor.
+    /*! Skips empty lines before the record. On an error the rest of the record is skipped.
+     * \param cursor the position in the text being parsed
+     * \param device the pointer to the QPaintDevice
+     * \param report the report that receives the error, if there is one
+     * \param p_Shape set to the new shape, or to nullptr if the record has an error
+     * \returns FALSE if there are no more records.
+     */
+    bool parseNextRecord(LineCursor &cursor, QPaintDevice *device, ParseReport &report, Shape *&p_Shape);
+
+    unordered_map<string, int> penIds;      /*!< the pen ID of each combination of pen property strings already read */
+    unordered_map<string, int> textPenIds;  /*!< the pen ID of each text color string already read */
+    unordered_map<string, int> brushIds;    /*!< the brush ID of each combination of brush property strings already read */
+    unordered_map<string, int> fontIds;     /*!< the font ID of each combination of font property strings already read */
+    string styleKey;                        /*!< the lookup key of the style being resolved, reused between lookups */
 };
 
 #endif // PARSER_H
@@ -0,0 +1,79 @@
+/*!
+ * \file    parsereport.h
+ * \brief   The errors found while parsing a shape file, with the line, column, and field of each.
+*/
+
+#ifndef PARSEREPORT_H
+#define PARSEREPORT_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*! \struct ParseError
+ * \brief One problem found in a shape record.
+ */
+struct ParseError
+{
+    int line{0};            /*!< the line of the problem, counted from 1 */
+    int column{0};          /*!< the column of the problem, counted from 1 */
+    std::string field;      /*!< the label of the field being read, such as "PenWidth" */
+    std::string message;    /*!< what is wrong */
+};
+
+/*! \struct ParseReport
+ * \brief Collects the errors of a parse and counts the records that were read and skipped.
+ * A record with an error is skipped as a whole and only its first error is reported; parsing continues with the next record.
+ * Only the first MAX_STORED_ERRORS errors are kept, so a badly damaged file cannot make the report grow without bound.
+ * \sa Parser::parseText()
+ */
+struct ParseReport
+{
+    static const int MAX_STORED_ERRORS = 1000;  /*!< the number of errors kept in the errors vector */
+
+    std::vector<ParseError> errors; /*!< the first MAX_STORED_ERRORS errors, in file order */
+    int errorCount{0};              /*!< the number of errors found, including those not stored */
+    int recordsParsed{0};           /*!< the number of records that became shapes */
+    int recordsSkipped{0};          /*!< the number of records skipped because of an error */
+
+    //! Checks whether the parse found no errors.
+    bool isClean() const {return errorCount == 0;}
+
+    //! Records an error.
+    /*! \param line the line of the problem
+     * \param column the column of the problem
+     * \param field the label of the field being read
+     * \param message what is wrong
+     */
+    void addError(int line, int column, const std::string &field, const std::string &message)
+    {
+        if(errorCount++ < MAX_STORED_ERRORS)
+        {
+            errors.push_back({line, column, field, message});
+        }
+    }
+
+    //! Formats the report as one line per error, followed by a summary line.
+    /*! \returns The report as a multi-line string.
+     */
+    std::string toString() const
+    {
+        std::ostringstream oss;
+
+        for(const ParseError &error : errors)
+        {
+            oss << "line " << error.line << ", column " << error.column << " (" << error.field << "): " << error.message << std::endl;
+        }
+
+        if(errorCount > int(errors.size()))
+        {
+            oss << "... and " << errorCount - int(errors.size()) << " more errors" << std::endl;
+        }
+
+        oss << recordsParsed << " records parsed, " << recordsSkipped << " skipped" << std::endl;
+
+        return oss.str();
+    }
+};
+
+#endif // PARSEREPORT_H
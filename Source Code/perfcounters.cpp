@@ -0,0 +1,145 @@
+#include "perfcounters.h"
+#include <atomic>
+#include <sstream>
+
+namespace
+{
+    /*! \struct TimerSlot
+     * \brief The atomic storage of one timer.
+     */
+    struct TimerSlot
+    {
+        std::atomic<long long> calls{0};
+        std::atomic<long long> totalNs{0};
+        std::atomic<long long> minNs{0};
+        std::atomic<long long> maxNs{0};
+        std::atomic<long long> lastNs{0};
+    };
+
+    TimerSlot timers[perf::NUM_TIMERS];
+    std::atomic<long long> counters[perf::NUM_COUNTERS];
+
+    const char *const TIMER_NAMES[perf::NUM_TIMERS]
+    {
+        "parse",
+        "updateShapeTables",
+        "sortIDTable",
+        "sortPerimeterTable",
+        "sortAreaTable",
+        "paint",
+        "save",
+        "findShape"
+    };
+
+    const char *const COUNTER_NAMES[perf::NUM_COUNTERS]
+    {
+        "shapesParsed",
+        "shapesDrawn",
+        "shapesCulled",
+        "idLookupsMissed",
+        "metricsCacheHits",
+        "metricsCacheMisses"
+    };
+}
+
+/*! The minimum and maximum are updated with compare and swap loops, so concurrent spans never lose an extreme. A minimum of 0 means no span was recorded yet. */
+void perf::record(eTimer timer, long long nanoseconds)
+{
+    TimerSlot &slot = timers[timer];
+
+    slot.calls.fetch_add(1, std::memory_order_relaxed);
+    slot.totalNs.fetch_add(nanoseconds, std::memory_order_relaxed);
+    slot.lastNs.store(nanoseconds, std::memory_order_relaxed);
+
+    long long current = slot.minNs.load(std::memory_order_relaxed);
+
+    while((current == 0 || nanoseconds < current)
+          && !slot.minNs.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    {}
+
+    current = slot.maxNs.load(std::memory_order_relaxed);
+
+    while(nanoseconds > current && !slot.maxNs.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    {}
+}
+
+void perf::add(eCounter counter, long long amount)
+{
+    counters[counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+perf::TimerStats perf::getTimer(eTimer timer)
+{
+    const TimerSlot &slot = timers[timer];
+    TimerStats stats;
+
+    stats.calls = slot.calls.load(std::memory_order_relaxed);
+    stats.totalNs = slot.totalNs.load(std::memory_order_relaxed);
+    stats.minNs = slot.minNs.load(std::memory_order_relaxed);
+    stats.maxNs = slot.maxNs.load(std::memory_order_relaxed);
+    stats.lastNs = slot.lastNs.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+long long perf::getCounter(eCounter counter)
+{
+    return counters[counter].load(std::memory_order_relaxed);
+}
+
+void perf::reset()
+{
+    for(TimerSlot &slot : timers)
+    {
+        slot.calls.store(0, std::memory_order_relaxed);
+        slot.totalNs.store(0, std::memory_order_relaxed);
+        slot.minNs.store(0, std::memory_order_relaxed);
+        slot.maxNs.store(0, std::memory_order_relaxed);
+        slot.lastNs.store(0, std::memory_order_relaxed);
+    }
+
+    for(std::atomic<long long> &counter : counters)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char *perf::timerName(eTimer timer)
+{
+    return TIMER_NAMES[timer];
+}
+
+const char *perf::counterName(eCounter counter)
+{
+    return COUNTER_NAMES[counter];
+}
+
+std::string perf::toJson()
+{
+    std::ostringstream json;
+    json.precision(6);
+
+    json << "{\n  \"timers\": {";
+
+    for(int i = 0; i < NUM_TIMERS; ++i)
+    {
+        TimerStats stats = getTimer(eTimer(i));
+        double meanNs = stats.calls > 0 ? double(stats.totalNs) / double(stats.calls) : 0.0;
+
+        json << (i == 0 ? "\n" : ",\n") << "    \"" << TIMER_NAMES[i] << "\": {\"calls\": " << stats.calls
+             << ", \"total_ms\": " << double(stats.totalNs) / 1e6 << ", \"mean_ms\": " << meanNs / 1e6
+             << ", \"min_ms\": " << double(stats.minNs) / 1e6 << ", \"max_ms\": " << double(stats.maxNs) / 1e6
+             << ", \"last_ms\": " << double(stats.lastNs) / 1e6 << "}";
+    }
+
+    json << "\n  },\n  \"counters\": {";
+
+    for(int i = 0; i < NUM_COUNTERS; ++i)
+    {
+        json << (i == 0 ? "\n" : ",\n") << "    \"" << COUNTER_NAMES[i] << "\": " << getCounter(eCounter(i));
+    }
+
+    json << "\n  }\n}\n";
+
+    return json.str();
+}
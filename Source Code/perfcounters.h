@@ -0,0 +1,138 @@
+/*!
+ * \file    perfcounters.h
+ * \brief   Scoped timers and counters around the expensive paths of the application, compiled in only when SHAPE_PERF_COUNTERS is defined.
+*/
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <chrono>
+#include <string>
+
+/*! \namespace perf
+ * \brief Holds the timers and counters, and the functions reading them.
+ *
+ * Code is instrumented with the PERF_SCOPE() and PERF_COUNT() macros. Without SHAPE_PERF_COUNTERS both expand to
+ * nothing that is evaluated, so an uninstrumented build carries no code, data, or clock reads for them.
+ * Every timer and counter is a fixed slot of a static array, so recording takes no lookup and no allocation.
+ * The slots are relaxed atomics, so spans recorded on worker threads do not race with the GUI thread.
+ * \sa canvas::setHudVisible()
+ */
+namespace perf
+{
+    //! The enumeration of all timed spans.
+    enum eTimer{
+                PARSE,                  /*!< Parser::parseText(), one call per document, page, or text block */
+                UPDATE_SHAPE_TABLES,    /*!< MainWindow::updateShapeTables(), including the three sorts */
+                SORT_ID_TABLE,          /*!< MainWindow::sortIDTable() */
+                SORT_PERIMETER_TABLE,   /*!< MainWindow::sortPerimeterTable() */
+                SORT_AREA_TABLE,        /*!< MainWindow::sortAreaTable() */
+                PAINT,                  /*!< canvas::paintEvent(), one call per frame */
+                SAVE,                   /*!< AllShapes::printAll() */
+                FIND_SHAPE,             /*!< AllShapes::findShape() and AllShapes::findShapePtr() */
+                NUM_TIMERS              /*!< the number of timers */
+               };
+
+    //! The enumeration of all counters.
+    enum eCounter{
+                  SHAPES_PARSED,        /*!< the shapes created by Parser::parseText() */
+                  SHAPES_DRAWN,         /*!< the shapes painted by canvas::paintEvent() */
+                  SHAPES_CULLED,        /*!< the shapes skipped by canvas::paintEvent() because they lie outside the repainted region */
+                  ID_LOOKUPS_MISSED,    /*!< the ID lookups that found no shape */
+                  METRICS_CACHE_HITS,   /*!< the perimeter, area, and bounding box lookups of MainWindow::updateShapeTables() answered from the shape metrics caches */
+                  METRICS_CACHE_MISSES, /*!< the lookups of MainWindow::updateShapeTables() that recomputed the metrics */
+                  NUM_COUNTERS          /*!< the number of counters */
+                 };
+
+    /*! \struct TimerStats
+     * \brief The calls and times of one timer, in nanoseconds.
+     */
+    struct TimerStats
+    {
+        long long calls{0};         /*!< the number of timed spans */
+        long long totalNs{0};       /*!< the sum of all spans */
+        long long minNs{0};         /*!< the shortest span, or 0 before the first call */
+        long long maxNs{0};         /*!< the longest span */
+        long long lastNs{0};        /*!< the most recent span */
+    };
+
+    //! Adds one span to a timer.
+    /*! \param timer the timer
+     * \param nanoseconds the length of the span
+     */
+    void record(eTimer timer, long long nanoseconds);
+
+    //! Adds to a counter.
+    /*! \param counter the counter
+     * \param amount the amount added
+     */
+    void add(eCounter counter, long long amount);
+
+    //! Gets the calls and times of a timer.
+    TimerStats getTimer(eTimer timer);
+
+    //! Gets the value of a counter.
+    long long getCounter(eCounter counter);
+
+    //! Sets every timer and counter to 0.
+    void reset();
+
+    //! Gets the name of a timer, as used in the JSON dump.
+    const char *timerName(eTimer timer);
+
+    //! Gets the name of a counter, as used in the JSON dump.
+    const char *counterName(eCounter counter);
+
+    //! Formats every timer and counter as a JSON object.
+    /*! Times are given in milliseconds.
+     * \returns The JSON text.
+     */
+    std::string toJson();
+
+    /*! \class ScopedTimer
+     * \brief Records the time from its construction to its destruction in a timer.
+     */
+    class ScopedTimer
+    {
+    public:
+
+        //! Constructor
+        /*! Reads the clock.
+         * \param timer the timer the span is added to
+         */
+        explicit ScopedTimer(eTimer timer) : timer{timer}, start{std::chrono::steady_clock::now()} {}
+
+        //! Destructor
+        /*! Reads the clock again and records the span.
+         */
+        ~ScopedTimer() {record(timer, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());}
+
+        //! Removes functionality of a copy constructor.
+        ScopedTimer(const ScopedTimer &otherTimer) = delete;
+
+        //! Removes functionality of a copy assignment operator.
+        ScopedTimer& operator=(const ScopedTimer &otherTimer) = delete;
+
+    private:
+        eTimer timer;                                   /*!< the timer the span is added to */
+        std::chrono::steady_clock::time_point start;    /*!< the time the span began */
+    };
+}
+
+#define PERF_CONCATENATE_IMPL(a, b) a##b
+#define PERF_CONCATENATE(a, b) PERF_CONCATENATE_IMPL(a, b)
+
+#ifdef SHAPE_PERF_COUNTERS
+    //! Times the rest of the enclosing scope with the named perf::eTimer.
+    #define PERF_SCOPE(timer) perf::ScopedTimer PERF_CONCATENATE(perfScopedTimer, __LINE__)(perf::timer)
+
+    //! Adds an amount to the named perf::eCounter.
+    #define PERF_COUNT(counter, amount) perf::add(perf::counter, (amount))
+#else
+    #define PERF_SCOPE(timer) static_cast<void>(0)
+
+    //! The amount is not evaluated, but still counts as a use of the variables it names.
+    #define PERF_COUNT(counter, amount) static_cast<void>(sizeof(amount))
+#endif
+
+#endif // PERFCOUNTERS_H
@@ -1,13 +1,13 @@
 #include "polygon.h"
 
 //! Sets the QPainter object to draw a polygon according to the Polygon object's specifications.
-void Polygon::draw()
+void Polygon::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawPolygon(&points[0], numDimensions/2);
     painter.setPen(Qt::black);
-    painter.drawText(points[0].x(), points[0].y(), 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the polygon.
@@ -19,6 +19,7 @@ void Polygon::move(const QPoint &shift)
     }
 
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Calculates and returns the perimeter of the polygon.
@@ -35,7 +36,7 @@ dim::perimeter Polygon::calcPerimeter() const
 
     int i;
 
-    for(i = 0; i < numDimensions / 2; i += 2)
+    for(i = 0; i < numDimensions - 2; i += 2)
     {
         perimeter += distance(*(x0 + i), *(x1 + i), *(y0 + i), *(y1 + i));
     }
@@ -91,7 +92,7 @@ void Polygon::setPosition()
 //! Sets the shape dimension array values to their new values after the polygon is moved.
 void Polygon::setShapeDimensions(const QPoint &shift)
 {
-    for(int i = 0; i < numDimensions; i++)
+    for(int i = 0; i < (numDimensions/2); i++)
     {
         shapeDimensions[2*i] += shift.x();
         shapeDimensions[(2*i)+1] += shift.y();
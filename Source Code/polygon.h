@@ -19,23 +19,22 @@ const int NUM_POLYGON_SPECS = -1;
  * Polygons can have an infinite number of sides when written by hand into an input file.
  * When polygons are added via the application, they have a maximum of 10 sides.
  */
-class Polygon: public Shape
+class Polygon final : public Shape
 {
 public:
 
     //! Default constructor
-    Polygon() {}
+    Polygon() : Shape(ShapeLabels::POLYGON) {}
 
     //! Alternate constructor
     /*! Passes in all polygon data to be implemented upon construction.
-     * \sa MainWindow::on_polygonSave_clicked()
+     * \sa MainWindow::polygonSaveClicked()
      * \param shapeId the ID number of the new polygon
-     * \param shapeType the string representing a polygon
      * \param numDimensions the number of dimensions the new polygon has
      * \param *shapeDimensions the pointer to the array of polygon dimensions
      */
-    Polygon(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-        :Shape(shapeId, shapeType, numDimensions, shapeDimensions) {setPosition();}
+    Polygon(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+        :Shape(shapeId, ShapeLabels::POLYGON, numDimensions, shapeDimensions) {setPosition();}
 
     //! Destructor
     /*! Overrides the virtual destructor of base class Shape
@@ -44,8 +43,9 @@ public:
 
     //! Draws the polygon according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a polygon.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the polygon by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a polygon.
@@ -63,6 +63,12 @@ public:
      */
     dim::area calcArea() const override;
 
+    //! Finds the bounding box of the polygon.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: returns the smallest rectangle containing every point.
+     */
+    QRect calcBoundingBox() const override {return calcVertexBoundingBox();}
+
     //! Updates the shape dimensions array with the current polygon dimensions.
     /*! This function is called whenever the polygon is moved to account for shifts in its dimensions.
      * Overrides the virtual function from the base class.
@@ -76,6 +82,12 @@ public:
      */
     void setPosition() override;
 
+    //! Gets the number of heap bytes the polygon owns.
+    /*! Inline function: hides the base class version to add the vector of points.
+     * \returns The bytes of the dimension array and the points.
+     */
+    std::size_t getHeapBytes() const {return Shape::getHeapBytes() + points.capacity() * sizeof(QPoint);}
+
 
 private:
     std::vector<QPoint> points; /*!< the vector containing all points on the polygon */
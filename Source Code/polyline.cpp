@@ -1,15 +1,15 @@
 #include "polyline.h"
 #include "qtconversions.h"
-#include <sstream>
+#include "shapewriter.h"
 
 //! Sets the QPainter object to draw a polyline according to the Polyline object's specifications.
-void Polyline::draw()
+void Polyline::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawPolyline(&points[0], numDimensions/2);
     painter.setPen(Qt::black);
-    painter.drawText(points[0].x(), points[0].y(), 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the polyline.
@@ -21,6 +21,7 @@ void Polyline::move(const QPoint &shift)
     }
 
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Calculates and returns the perimeter/length of the polyline.
@@ -37,7 +38,7 @@ dim::perimeter Polyline::calcPerimeter() const
 
     int i;
 
-    for(i = 0; i < numDimensions / 2; i += 2)
+    for(i = 0; i < numDimensions - 2; i += 2)
     {
         perimeter += distance(*(x0 + i), *(x1 + i), *(y0 + i), *(y1 + i));
     }
@@ -65,40 +66,17 @@ void Polyline::setPosition()
 //! Sets the shape dimension array values to their new values after the polyline is moved.
 void Polyline::setShapeDimensions(const QPoint &shift)
 {
-    for(int i = 0; i < numDimensions; i++)
+    for(int i = 0; i < (numDimensions/2); i++)
     {
         shapeDimensions[2*i] += shift.x();
         shapeDimensions[(2*i)+1] += shift.y();
     }
 }
 
-//! Overrides the print function to print polyline specific information as a string.
+//! Overrides the serialize function to leave out the brush, which a polyline does not use.
 /*! \sa AllShapes::printAll() */
-std::string Polyline::print() const
+void Polyline::serialize(ShapeWriter &writer) const
 {
-    using std::endl;
-
-    std::ostringstream oss;
-
-    oss << "ShapeId: " << shapeId << endl;
-    oss << "ShapeType: " << shapeType << endl;
-    oss << "ShapeDimensions: ";
-    for(int i = 0; i < numDimensions; ++i)
-    {
-        oss << shapeDimensions[i];
-
-        if(i < numDimensions - 1)
-        {
-            oss << ", ";
-        }
-    }
-    oss << endl;
-
-    oss << "PenColor: " << getColorAsString(pen.color()) << endl;
-    oss << "PenWidth: " << pen.width() << endl;
-    oss << "PenStyle: " << getPenStyleAsString(pen.style()) << endl;
-    oss << "PenCapStyle: " << getCapStyleAsString(pen.capStyle()) << endl;
-    oss << "PenJoinStyle: " << getJoinStyleAsString(pen.joinStyle()) << endl;
-
-    return oss.str();
+    serializeHeader(writer);
+    serializePen(writer);
 }
@@ -17,23 +17,22 @@ const int NUM_POLYLINE_SPECS = -1;
  * Polylines can have an infinite number of points when written by hand into an input file.
  * When polylines are added via the application, they have a maximum of 10 points.
  */
-class Polyline: public Shape
+class Polyline final : public Shape
 {
 public:
 
     //! Default constructor
-    Polyline() {}
+    Polyline() : Shape(ShapeLabels::POLYLINE) {}
 
     //! Alternate constructor
     /*! Passes in all polyline data to be implemented upon construction.
-     * \sa MainWindow::on_polylineSave_clicked()
+     * \sa MainWindow::polylineSaveClicked()
      * \param shapeId the ID number of the new polyline
-     * \param shapeType the string representing a polyline
      * \param numDimensions the number of dimensions the new polyline has
      * \param *shapeDimensions the pointer to the array of polyline dimensions
      */
-    Polyline(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-        :Shape(shapeId, shapeType, numDimensions, shapeDimensions) {setPosition();}
+    Polyline(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+        :Shape(shapeId, ShapeLabels::POLYLINE, numDimensions, shapeDimensions) {setPosition();}
 
     //! Destructor
     /*! Overrides the virtual destructor of base class Shape
@@ -42,8 +41,9 @@ public:
 
     //! Draws the polyline according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a polyline.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the polyline by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a polyline.
@@ -61,6 +61,12 @@ public:
      */
     dim::area calcArea() const override {return 0;}
 
+    //! Finds the bounding box of the polyline.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: returns the smallest rectangle containing every point.
+     */
+    QRect calcBoundingBox() const override {return calcVertexBoundingBox();}
+
     //! Updates the shape dimensions array with the current polyline dimensions.
     /*! This function is called whenever the polyline is moved to account for shifts in its dimensions.
      * Overrides the virtual function from the base class.
@@ -74,12 +80,19 @@ public:
      */
     void setPosition() override;
 
-    //! Prints the polyline specifications.
-    /*! Stores the entire set of polyline specifications as a string to be printed to an output file via the AllShapes class.
+    //! Gets the number of heap bytes the polyline owns.
+    /*! Inline function: hides the base class version to add the vector of points.
+     * \returns The bytes of the dimension array and the points.
+     */
+    std::size_t getHeapBytes() const {return Shape::getHeapBytes() + points.capacity() * sizeof(QPoint);}
+
+    //! Writes the polyline specifications.
+    /*! Writes the entire set of polyline specifications to an output file via the AllShapes class.
      * Overrides the virtual function from the base class.
+     * \param writer the writer that receives the fields
      * \sa AllShapes::printAll()
      */
-    std::string print() const override;
+    void serialize(ShapeWriter &writer) const override;
 
 
 private:
@@ -1,226 +1,129 @@
 #include "qtconversions.h"
+#include "keywordtables.h"
 #include <iostream>
 
+/*! The keyword tables are free of Qt, so their values are checked against the Qt enumerations here */
+static_assert(keywords::COLOR_TABLE.find("green") == Qt::darkGreen && keywords::COLOR_TABLE.find("gray") == Qt::gray, "Color keyword values do not match Qt");
+static_assert(keywords::PEN_STYLE_TABLE.find("DashDotDotLine") == Qt::DashDotDotLine, "Pen style keyword values do not match Qt");
+static_assert(keywords::CAP_STYLE_TABLE.find("SquareCap") == Qt::SquareCap && keywords::CAP_STYLE_TABLE.find("RoundCap") == Qt::RoundCap, "Cap style keyword values do not match Qt");
+static_assert(keywords::JOIN_STYLE_TABLE.find("BevelJoin") == Qt::BevelJoin && keywords::JOIN_STYLE_TABLE.find("RoundJoin") == Qt::RoundJoin, "Join style keyword values do not match Qt");
+static_assert(keywords::BRUSH_STYLE_TABLE.find("HorPattern") == Qt::HorPattern && keywords::BRUSH_STYLE_TABLE.find("VerPattern") == Qt::VerPattern, "Brush style keyword values do not match Qt");
+static_assert(keywords::ALIGNMENT_TABLE.find("AlignTop") == Qt::AlignTop && keywords::ALIGNMENT_TABLE.find("AlignCenter") == Qt::AlignCenter, "Alignment keyword values do not match Qt");
+static_assert(keywords::FONT_STYLE_TABLE.find("StyleOblique") == QFont::StyleOblique, "Font style keyword values do not match Qt");
+static_assert(keywords::FONT_WEIGHT_TABLE.find("Light") == QFont::Light && keywords::FONT_WEIGHT_TABLE.find("Bold") == QFont::Bold, "Font weight keyword values do not match Qt");
+
 //! Finds a string in an array of strings and returns its location in the array.
 int findString(const std::string stringAr[], const int AR_SIZE, const std::string theString)
 {
-    int i{0};
-    bool notSame{true};
-
-    notSame = stringAr[i] != theString;
-
-    // EXCEPTION HERE
-    while(i < AR_SIZE && notSame)
+    for(int i = 0; i < AR_SIZE; ++i)
     {
-        ++i;
-        notSame = stringAr[i] != theString;
+        if(stringAr[i] == theString)
+        {
+            return i;
+        }
     }
 
-    if(notSame)
-    {
-        return -1;
-    }
-    else
-    {
-        return i;
-    }
+    return -1;
 }
 
 //! Finds a string in an array of strings and returns its appropriate enum value from Qt.
 int findStringCustom(const std::string stringAr[], const int actualVal[], const int AR_SIZE, const std::string theString)
 {
-    int i{0};
-    bool notSame{true};
-
-    notSame = stringAr[i] != theString;
-
-    // EXCEPTION HERE
-    while(i < AR_SIZE && notSame)
+    for(int i = 0; i < AR_SIZE; ++i)
     {
-        ++i;
-        notSame = stringAr[i] != theString;
+        if(stringAr[i] == theString)
+        {
+            return actualVal[i];
+        }
     }
 
-    if(notSame)
-    {
-        return -1;
-    }
-    else
-    {
-        return actualVal[i];
-    }
+    return -1;
 }
 
 //! Gets a QColor as a string.
-std::string getColorAsString(QColor color)
+const std::string &getColorAsString(QColor color)
 {
-    string colorStr;
-
-    if(color == Qt::white)
-        colorStr = globalColorString[0];    //white
-    else if(color == Qt::black)
-        colorStr = globalColorString[1];    //black
-    else if(color == Qt::red)
-        colorStr = globalColorString[2];    //red
-    else if(color == Qt::green)
-        colorStr = globalColorString[3];    //green
-    else if(color == Qt::darkGreen)
-        colorStr = globalColorString[3];   //other green
-    else if(color == Qt::blue)
-        colorStr = globalColorString[4];    //blue
-    else if(color == Qt::cyan)
-        colorStr = globalColorString[5];    //cyan
-    else if(color == Qt::magenta)
-        colorStr = globalColorString[6];    //magenta
-    else if(color == Qt::yellow)
-        colorStr = globalColorString[7];    //yellow
-    else
-        colorStr = globalColorString[8];    //gray
-
-    return colorStr;
+    int index;
+
+    switch(color.rgba())
+    {
+    case 0xffffffff: index = 0; break;  //white
+    case 0xff000000: index = 1; break;  //black
+    case 0xffff0000: index = 2; break;  //red
+    case 0xff00ff00: index = 3; break;  //green
+    case 0xff008000: index = 3; break;  //other green
+    case 0xff0000ff: index = 4; break;  //blue
+    case 0xff00ffff: index = 5; break;  //cyan
+    case 0xffff00ff: index = 6; break;  //magenta
+    case 0xffffff00: index = 7; break;  //yellow
+    default:         index = 8; break;  //gray
+    }
+
+    return globalColorString[index];
 }
 
 //! Gets a Qt::PenStyle as a string.
-std::string getPenStyleAsString(Qt::PenStyle penStyle)
+const std::string &getPenStyleAsString(Qt::PenStyle penStyle)
 {
-    string penStyleStr;
-
-    if(penStyle == Qt::NoPen)
-        penStyleStr = penStyleString[0];    //NoPen
-    else if(penStyle == Qt::SolidLine)
-        penStyleStr = penStyleString[1];    //SolidLine
-    else if(penStyle == Qt::DashLine)
-        penStyleStr = penStyleString[2];    //DashLine
-    else if(penStyle == Qt::DotLine)
-        penStyleStr = penStyleString[3];    //DotLine
-    else if(penStyle == Qt::DashDotLine)
-        penStyleStr = penStyleString[4];    //DashDotLine
-    else
-        penStyleStr = penStyleString[5];    //DashDotDotLine
-
-    return penStyleStr;
+    return penStyleString[keywords::PEN_STYLE_TABLE.indexOfValue(penStyle, 5)];            //DashDotDotLine otherwise
 }
 
 //! Gets a Qt::PenCapStyle as a string.
-std::string getCapStyleAsString(Qt::PenCapStyle capStyle)
+const std::string &getCapStyleAsString(Qt::PenCapStyle capStyle)
 {
-    string capStyleStr;
-
-    if(capStyle == Qt::FlatCap)
-        capStyleStr = penCapStyleString[0]; //FlatCap
-    else if(capStyle == Qt::SquareCap)
-        capStyleStr = penCapStyleString[1]; //SquareCap
-    else
-        capStyleStr = penCapStyleString[2]; //RoundCap
-
-    return capStyleStr;
+    return penCapStyleString[keywords::CAP_STYLE_TABLE.indexOfValue(capStyle, 2)];         //RoundCap otherwise
 }
 
 //! Gets a Qt::PenJoinStyle as a string.
-std::string getJoinStyleAsString(Qt::PenJoinStyle joinStyle)
+const std::string &getJoinStyleAsString(Qt::PenJoinStyle joinStyle)
 {
-    string joinStyleStr;
-
-    if(joinStyle == Qt::MiterJoin)
-        joinStyleStr = penJoinStyleString[0];   //MiterJoin
-    else if(joinStyle == Qt::BevelJoin)
-        joinStyleStr = penJoinStyleString[1];   //BevelJoin
-    else
-        joinStyleStr = penJoinStyleString[2];   //RoundJoin
-
-    return joinStyleStr;
+    return penJoinStyleString[keywords::JOIN_STYLE_TABLE.indexOfValue(joinStyle, 2)];      //RoundJoin otherwise
 }
 
 //! Gets a Qt::BrushStyle as a string.
-std::string getBrushStyleAsString(Qt::BrushStyle brushStyle)
+const std::string &getBrushStyleAsString(Qt::BrushStyle brushStyle)
 {
-    string brushStyleStr;
-
-    if(brushStyle == Qt::SolidPattern)
-        brushStyleStr = brushStyleString[0];    //SolidPattern
-    else if(brushStyle == Qt::HorPattern)
-        brushStyleStr = brushStyleString[1];    //HorPattern
-    else if(brushStyle == Qt::VerPattern)
-        brushStyleStr = brushStyleString[2];    //VerPattern
-    else
-        brushStyleStr = brushStyleString[3];    //NoBrush
-
-    return brushStyleStr;
+    return brushStyleString[keywords::BRUSH_STYLE_TABLE.indexOfValue(brushStyle, 3)];      //NoBrush otherwise
 }
 
 //! Gets a Qt::Alignment Flag as a string.
-std::string getTextAlignmentAsString(Qt::AlignmentFlag align)
+const std::string &getTextAlignmentAsString(Qt::AlignmentFlag align)
 {
-    string alignStr;
-
-    if(align == Qt::AlignLeft)
-        alignStr = textAlignmentString[0];  //AlignLeft
-    else if(align == Qt::AlignRight)
-        alignStr = textAlignmentString[1];  //AlignRight
-    else if(align == Qt::AlignTop)
-        alignStr = textAlignmentString[2];  //AlignTop
-    else if(align == Qt::AlignBottom)
-        alignStr = textAlignmentString[3];  //AlignBottom
-    else
-        alignStr = textAlignmentString[4];  //AlignCenter
-
-    return alignStr;
+    return textAlignmentString[keywords::ALIGNMENT_TABLE.indexOfValue(align, 4)];          //AlignCenter otherwise
 }
 
 //! Gets a QFont::Style as a string.
-std::string getFontStyleAsString(QFont::Style style)
+const std::string &getFontStyleAsString(QFont::Style style)
 {
-    string styleStr;
-
-    if(style == QFont::StyleNormal)
-        styleStr = textFontStyleString[0];  //StyleNormal
-    else if(style == QFont::StyleItalic)
-        styleStr = textFontStyleString[1];  //StyleItalic
-    else
-        styleStr = textFontStyleString[2];  //StyleOblique
-
-    return styleStr;
+    return textFontStyleString[keywords::FONT_STYLE_TABLE.indexOfValue(style, 2)];         //StyleOblique otherwise
 }
 
 //! Gets a QFont::Weight as a string.
-std::string getFontWeightAsString(QFont::Weight weight)
+const std::string &getFontWeightAsString(QFont::Weight weight)
 {
-    string weightStr;
-
-    if(weight == QFont::Thin)
-        weightStr = textFontWeightString[0];    //Thin
-    else if(weight == QFont::Light)
-        weightStr = textFontWeightString[1];    //Light
-    else if(weight == QFont::Normal)
-        weightStr = textFontWeightString[2];    //Normal
-    else
-        weightStr = textFontWeightString[3];    //Bold
-
-    return weightStr;
+    return textFontWeightString[keywords::FONT_WEIGHT_TABLE.indexOfValue(weight, 3)];      //Bold otherwise
 }
 
-//! Converts a Qt::GlobalColor to a string.
-Qt::GlobalColor convertToGlobalColor(std::string thisString) {return Qt::GlobalColor(findStringCustom(globalColorString, colorsAr, COLORS, thisString));}
-
-//! Converts a Qt::PenStyle to a string.
-Qt::PenStyle convertToPenStyle(std::string thisString) {return Qt::PenStyle(findString(penStyleString, PEN_STYLES, thisString));}
-
-//! Converts a Qt::PenCapStyle to a string.
-Qt::PenCapStyle convertToPenCapStyle(std::string thisString) {return Qt::PenCapStyle(findString(penCapStyleString, CAP_STYLES, thisString));}
+//! Converts a string to a Qt::GlobalColor.
+Qt::GlobalColor convertToGlobalColor(std::string_view thisString) {return Qt::GlobalColor(keywords::COLOR_TABLE.find(thisString));}
 
-//! Converts a Qt::PenJoinStyle to a string.
-Qt::PenJoinStyle convertToPenJoinStyle(std::string thisString) {return Qt::PenJoinStyle(findString(penJoinStyleString, JOIN_STYLES, thisString));}
+//! Converts a string to a Qt::PenStyle.
+Qt::PenStyle convertToPenStyle(std::string_view thisString) {return Qt::PenStyle(keywords::PEN_STYLE_TABLE.find(thisString));}
 
-//! Converts a Qt::BrushStyle to a string.
-Qt::BrushStyle convertToBrushStyle(std::string thisString) {return Qt::BrushStyle(findStringCustom(brushStyleString, brushStylesAr, BRUSH_STYLES, thisString));}
+//! Converts a string to a Qt::PenCapStyle.
+Qt::PenCapStyle convertToPenCapStyle(std::string_view thisString) {return Qt::PenCapStyle(keywords::CAP_STYLE_TABLE.find(thisString));}
 
-//! Converts a Qt::AlignmentFlag to a string.
-Qt::AlignmentFlag convertToAlignmentFlag(std::string thisString) {return Qt::AlignmentFlag(findString(textAlignmentString, TEXT_ALIGNS, thisString));}
+//! Converts a string to a Qt::PenJoinStyle.
+Qt::PenJoinStyle convertToPenJoinStyle(std::string_view thisString) {return Qt::PenJoinStyle(keywords::JOIN_STYLE_TABLE.find(thisString));}
 
-//! Converts a QFont::Style to a string.
-QFont::Style convertToQFontStyle(std::string thisString) {return QFont::Style(findString(textFontStyleString, FONT_STYLES, thisString));}
+//! Converts a string to a Qt::BrushStyle.
+Qt::BrushStyle convertToBrushStyle(std::string_view thisString) {return Qt::BrushStyle(keywords::BRUSH_STYLE_TABLE.find(thisString));}
 
-//! Converts a QFont::Weight to a string.
-QFont::Weight convertToQFontWeight(std::string thisString) {return QFont::Weight(findStringCustom(textFontWeightString, textWeightsAr, FONT_WEIGHTS, thisString));}
+//! Converts a string to a Qt::AlignmentFlag.
+Qt::AlignmentFlag convertToAlignmentFlag(std::string_view thisString) {return Qt::AlignmentFlag(keywords::ALIGNMENT_TABLE.find(thisString));}
 
+//! Converts a string to a QFont::Style.
+QFont::Style convertToQFontStyle(std::string_view thisString) {return QFont::Style(keywords::FONT_STYLE_TABLE.find(thisString));}
 
+//! Converts a string to a QFont::Weight.
+QFont::Weight convertToQFontWeight(std::string_view thisString) {return QFont::Weight(keywords::FONT_WEIGHT_TABLE.find(thisString));}
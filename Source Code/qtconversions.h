@@ -4,6 +4,7 @@
  * \note The constants in this file represent the number of Qt values used in each aspect of shape rendering (QColor, QPen, QBrush, QFont).
  * These values are sizes of string arrays carrying the string equivalent of each relevant Qt value.
  * This allows for quick conversion when retrieving data from the shapes input file.
+ * \note The conversions themselves go through the compile time perfect hash tables in keywordtables.h; each keyword table lists its entries in the same order as the matching string array here.
  * \note The string arrays in this file contain the string equivalents of all Qt pen, brush, and font values that are represented in this application.
  * \note These functions convert between C++ and Qt specific data types and values to allow for easier readability and code coordination.
 */
@@ -15,6 +16,7 @@
 #include <QBrush>
 #include <QFont>
 #include <string>
+#include <string_view>
 using std::string;
 
 
@@ -137,11 +139,12 @@ const int textWeightsAr[FONT_WEIGHTS] =
 };
 
 
-//! Finds the string in the Qt string array and returns its Qt specific enumeration value.
-/*! \param stringAr[] the array of strings related to the string being located
+//! Finds the string in the Qt string array and returns its position in the array.
+/*! Linear search kept for callers with their own string arrays; the conversion functions below use keywordtables.h instead.
+ * \param stringAr[] the array of strings related to the string being located
  * \param AR_SIZE the size of the arrray of strings related to the string being located
  * \param theString the string being located
- * \returns The Qt specific enumeration value of the string being located.
+ * \returns The position of the string being located, or -1 if it is not in the array.
  */
 int findString(const std::string stringAr[], const int AR_SIZE, const std::string theString);
 
@@ -152,7 +155,7 @@ int findString(const std::string stringAr[], const int AR_SIZE, const std::strin
  * \param actualVal[] the array of enumeration values related to the item being located
  * \param AR_SIZE the size of the arrray of strings related to the string being located
  * \param theString the string being located
- * \returns The Qt specific enumeration value of the string being located.
+ * \returns The Qt specific enumeration value of the string being located, or -1 if it is not in the array.
  */
 int findStringCustom(const std::string stringAr[], const int actualVal[], const int AR_SIZE, const std::string theString);
 
@@ -160,96 +163,97 @@ int findStringCustom(const std::string stringAr[], const int actualVal[], const
 /*! \param thisString the string equivalent of a QColor
  * \sa Parser::parseShapes()
  */
-Qt::GlobalColor convertToGlobalColor(string thisString);
+Qt::GlobalColor convertToGlobalColor(std::string_view thisString);
 
 //! Converts a string equivalent of a Qt::PenStyle to an actual Qt::PenStyle type.
 /*! \param thisString the string equivalent of a Qt::PenStyle
  * \sa Parser::parseShapes()
  */
-Qt::PenStyle convertToPenStyle(string thisString);
+Qt::PenStyle convertToPenStyle(std::string_view thisString);
 
 //! Converts a string equivalent of a Qt::PenCapStyle to an actual Qt::PenCapStyle type.
 /*! \param thisString the string equivalent of a Qt::PenCapStyle
  * \sa Parser::parseShapes()
  */
-Qt::PenCapStyle convertToPenCapStyle(string thisString);
+Qt::PenCapStyle convertToPenCapStyle(std::string_view thisString);
 
 //! Converts a string equivalent of a Qt::PenJoinStyle to an actual Qt::PenJoinStyle type.
 /*! \param thisString the string equivalent of a Qt::PenJoinStyle
  * \sa Parser::parseShapes()
  */
-Qt::PenJoinStyle convertToPenJoinStyle(string thisString);
+Qt::PenJoinStyle convertToPenJoinStyle(std::string_view thisString);
 
 //! Converts a string equivalent of a Qt::BrushStyle to an actual Qt::BrushStyle type.
 /*! \param thisString the string equivalent of a Qt::BrushStyle
  * \sa Parser::parseShapes()
  */
-Qt::BrushStyle convertToBrushStyle(string thisString);
+Qt::BrushStyle convertToBrushStyle(std::string_view thisString);
 
 //! Converts a string equivalent of a Qt::AlignmentFlag to an actual Qt::AlignmentFlag type.
 /*! \param thisString the string equivalent of a Qt::AlignmentFlag
  * \sa Parser::parseShapes()
  */
-Qt::AlignmentFlag convertToAlignmentFlag(string thisString);
+Qt::AlignmentFlag convertToAlignmentFlag(std::string_view thisString);
 
 //! Converts a string equivalent of a QFont::Style to an actual QFont::Style type.
 /*! \param thisString the string equivalent of a QFont::PenStyle
  * \sa Parser::parseShapes()
  */
-QFont::Style convertToQFontStyle(string thisString);
+QFont::Style convertToQFontStyle(std::string_view thisString);
 
 //! Converts a string equivalent of a QFont::Weight to an actual QFont::Weight type.
 /*! \param thisString the string equivalent of a QFont::Weight
  * \sa Parser::parseShapes()
  */
-QFont::Weight convertToQFontWeight(string thisString);
+QFont::Weight convertToQFontWeight(std::string_view thisString);
 
 //! Converts a QColor to its string equivalent.
-/*! \param color the QColor value that needs to be converted back to a representative string
- * \sa Shape::print()
+/*! Returns a reference into the matching string array; nothing is allocated. The same holds for all functions below.
+ * \param color the QColor value that needs to be converted back to a representative string
+ * \sa Shape::serialize()
  */
-string getColorAsString(QColor color);
+const string &getColorAsString(QColor color);
 
 //! Converts a Qt::PenStyle to its string equivalent.
 /*! \param penStyle the Qt::PenStyle value that needs to be converted back to a representative string
- * \sa Shape::print()
+ * \sa Shape::serialize()
  */
-string getPenStyleAsString(Qt::PenStyle penStyle);
+const string &getPenStyleAsString(Qt::PenStyle penStyle);
 
 //! Converts a Qt::PenCapStyle to its string equivalent.
 /*! \param capStyle the Qt::PenCapStyle value that needs to be converted back to a representative string
- * \sa Shape::print()
+ * \sa Shape::serialize()
  */
-string getCapStyleAsString(Qt::PenCapStyle capStyle);
+const string &getCapStyleAsString(Qt::PenCapStyle capStyle);
 
 //! Converts a Qt::PenJoinStyle to its string equivalent.
 /*! \param joinStyle the Qt::PenJoinStyle value that needs to be converted back to a representative string
- * \sa Shape::print()
+ * \sa Shape::serialize()
  */
-string getJoinStyleAsString(Qt::PenJoinStyle joinStyle);
+const string &getJoinStyleAsString(Qt::PenJoinStyle joinStyle);
 
 //! Converts a Qt::BrushStyle to its string equivalent.
 /*! \param brushStyle the Qt::BrushStyle value that needs to be converted back to a representative string
- * \sa Shape::print()
+ * \sa Shape::serialize()
  */
-string getBrushStyleAsString(Qt::BrushStyle brushStyle);
+const string &getBrushStyleAsString(Qt::BrushStyle brushStyle);
 
 //! Converts a Qt::AlignmentFlag to its string equivalent.
 /*! \param align the Qt::AlignmentFlag value that needs to be converted back to a representative string
- * \sa Text::print()
+ * \sa Text::serialize()
  */
-string getTextAlignmentAsString(Qt::AlignmentFlag align);
+const string &getTextAlignmentAsString(Qt::AlignmentFlag align);
 
 //! Converts a QFont::Style to its string equivalent.
 /*! \param style the QFont::Style value that needs to be converted back to a representative string
- * \sa Text::print()
+ * \sa Text::serialize()
  */
-string getFontStyleAsString(QFont::Style style);
+const string &getFontStyleAsString(QFont::Style style);
 
 //! Converts a QFont::Weight to its string equivalent.
 /*! \param weight the QFont::Weight value that needs to be converted back to a representative string
- * \sa Text::print()
+ * \sa Text::serialize()
  */
-string getFontWeightAsString(QFont::Weight weight);
+const string &getFontWeightAsString(QFont::Weight weight);
 
 #endif // QTSTRINGS_H
@@ -1,13 +1,13 @@
 #include "rectangle.h"
 
 //! Sets the QPainter object to draw a rectangle according to the Rectangle object's specifications.
-void Rectangle::draw()
+void Rectangle::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawRect(position.x(), position.y(), shapeDimensions[int(Specifications::W)], shapeDimensions[int(Specifications::H)]);
     painter.setPen(Qt::black);
-    painter.drawText(position.x() - 20, position.y() - 20, 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the rectangle.
@@ -15,6 +15,7 @@ void Rectangle::move(const QPoint &shift)
 {
     position += shift;
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Sets the position of the rectangle.
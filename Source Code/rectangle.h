@@ -16,28 +16,27 @@ const int NUM_RECTANGLE_SPECS = 4;
 
 /*! Derived from abstract base class Shape.
  */
-class Rectangle: public Shape
+class Rectangle final : public Shape
 {
 public:
 
     //! Default constructor
     /*! Sets the position of the top left of the rectangle to a default location
      */
-    Rectangle() : position{0,0} {}
+    Rectangle() : Shape(ShapeLabels::RECTANGLE), position{0,0} {}
 
     //! Alternate constructor
     /*! Passes in all rectangle data to be implemented upon construction.
      * Initializes the rectangle and base class data via a base member initialization list.
      * Sets the QPoint value of the top left of the rectangle
-     * \sa MainWindow::on_rectangleSave_clicked()
+     * \sa MainWindow::rectangleSaveClicked()
      * \sa Rectangle::setPosition()
      * \param shapeId the ID number of the new rectangle
-     * \param shapeType the string representing a rectangle
      * \param numDimensions the number of dimensions a rectangle has
      * \param *shapeDimensions the pointer to the array of rectangle dimensions
      */
-    Rectangle(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-          :Shape(shapeId, shapeType, numDimensions, shapeDimensions)
+    Rectangle(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+          :Shape(shapeId, ShapeLabels::RECTANGLE, numDimensions, shapeDimensions)
           {setPosition();}
 
     //! Destructor
@@ -47,8 +46,9 @@ public:
 
     //! Draws the rectangle according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a rectangle.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the rectangle by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a rectangle.
@@ -72,6 +72,13 @@ public:
     dim::area calcArea() const override {return multiply(*(shapeDimensions + int(Specifications::W)),
                                                     *(shapeDimensions + int(Specifications::H)));}
 
+    //! Finds the ID label of the rectangle.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: the label sits diagonally above and to the left of the top left corner.
+     */
+    QRect calcLabelRect() const override {return QRect(shapeDimensions[int(Specifications::X1)] - LABEL_SIZE, shapeDimensions[int(Specifications::Y1)] - LABEL_SIZE,
+                                                       LABEL_SIZE, LABEL_SIZE);}
+
     //! Sets the QPoint data member to the position of the top left corner of the rectangle.
     /*! Overrides the pure virtual function from the base class to set the position of a rectangle.
      */
@@ -0,0 +1,317 @@
+#include "scenegenerator.h"
+#include "qtconversions.h"
+#include "shapewriter.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <climits>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const int NUM_FONT_FAMILIES = 4;
+    const char *const FONT_FAMILIES[NUM_FONT_FAMILIES] {"Comic Sans MS", "Courier", "Helvetica", "Times New Roman"};
+
+    const int MAX_PEN_WIDTH = 12;
+    const int MIN_GENERATED_POINT = 6;
+    const int MAX_GENERATED_POINT = 24;
+}
+
+SceneGenerator::SceneGenerator(const SceneSpec &spec) : spec{spec}, totalWeight{0}
+{
+    SceneSpec &limited = this -> spec;
+
+    limited.shapeCount = std::min<long long>(std::max<long long>(limited.shapeCount, 0), INT_MAX);
+    limited.minVertices = std::max(2, limited.minVertices);
+    limited.maxVertices = std::max(limited.minVertices, limited.maxVertices);
+    limited.width = std::max(1, limited.width);
+    limited.height = std::max(1, limited.height);
+    limited.maxExtent = std::max(1, limited.maxExtent);
+
+    for(int &weight : limited.weights)
+    {
+        weight = std::max(0, weight);
+        totalWeight += weight;
+    }
+
+    if(totalWeight == 0)
+    {
+        std::fill(std::begin(limited.weights), std::end(limited.weights), 1);
+        totalWeight = NUM_SHAPES;
+    }
+}
+
+void SceneGenerator::writeChunk(long long chunk, ShapeWriter &writer) const
+{
+    std::seed_seq seeds{std::uint32_t(spec.seed), std::uint32_t(spec.seed >> 32), std::uint32_t(chunk), std::uint32_t(chunk >> 32)};
+    std::mt19937_64 engine(seeds);
+
+    long long first = chunk * CHUNK_SHAPES;
+    long long last = std::min(first + CHUNK_SHAPES, spec.shapeCount);
+
+    for(long long i = first; i < last; ++i)
+    {
+        writeRecord(writer, i + 1, engine);
+
+        if(i < spec.shapeCount - 1)
+        {
+            writer.newline();
+        }
+    }
+}
+
+std::string SceneGenerator::generate() const
+{
+    std::vector<char> buffer;
+    ShapeWriter writer(buffer);
+
+    for(long long chunk = 0; chunk < chunkCount(); ++chunk)
+    {
+        writeChunk(chunk, writer);
+    }
+
+    return std::string(buffer.data(), std::size_t(writer.getBytesWritten()));
+}
+
+/*! Chunk c is formatted into buffer slot c modulo the number of slots, once chunk c minus the number of slots has been written.
+ * The calling thread writes the chunks in order as they become ready, so formatting and writing overlap.
+ */
+long long SceneGenerator::save(const std::string &fileName, int maxThreads) const
+{
+    std::ofstream out(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if(!out.is_open())
+    {
+        return -1;
+    }
+
+    if(maxThreads <= 0)
+    {
+        maxThreads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+
+    const long long chunks = chunkCount();
+    const int threadCount = int(std::max<long long>(1, std::min<long long>(maxThreads, chunks)));
+    const int slotCount = threadCount * CHUNKS_PER_THREAD;
+
+    std::vector<std::vector<char>> slotBuffers(slotCount);
+    std::vector<long long> slotSizes(slotCount, 0);
+    std::vector<long long> slotChunks(slotCount, -1);
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::atomic<long long> nextChunk{0};
+    long long chunksWritten{0};
+    bool failed{false};
+
+    auto formatChunks = [&]()
+    {
+        for(long long chunk = nextChunk++; chunk < chunks; chunk = nextChunk++)
+        {
+            int slot = int(chunk % slotCount);
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&]{return failed || chunksWritten > chunk - slotCount;});
+
+                if(failed)
+                {
+                    return;
+                }
+            }
+
+            ShapeWriter writer(slotBuffers[slot]);
+            writeChunk(chunk, writer);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slotSizes[slot] = writer.getBytesWritten();
+                slotChunks[slot] = chunk;
+            }
+
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+
+    for(int i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back(formatChunks);
+    }
+
+    long long bytesWritten{0};
+
+    for(long long chunk = 0; chunk < chunks; ++chunk)
+    {
+        int slot = int(chunk % slotCount);
+        long long size;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&]{return slotChunks[slot] == chunk;});
+            size = slotSizes[slot];
+        }
+
+        out.write(slotBuffers[slot].data(), std::streamsize(size));
+        bytesWritten += size;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunksWritten = chunk + 1;
+            failed = !out;
+        }
+
+        changed.notify_all();
+
+        if(!out)
+        {
+            break;
+        }
+    }
+
+    for(std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    out.close();
+
+    return out ? bytesWritten : -1;
+}
+
+bool SceneGenerator::readMix(const std::string &text, int (&weights)[NUM_SHAPES])
+{
+    int read[NUM_SHAPES] {};
+    std::istringstream in(text);
+    std::string item;
+
+    while(std::getline(in, item, ','))
+    {
+        std::string::size_type equals = item.find('=');
+
+        if(equals == std::string::npos)
+        {
+            return false;
+        }
+
+        std::string name = item.substr(0, equals);
+        std::string value = item.substr(equals + 1);
+        int type{-1};
+
+        for(int i = 0; i < NUM_SHAPES; ++i)
+        {
+            const std::string &label = ShapeLabels::SHAPES_LIST[i];
+
+            if(std::equal(name.begin(), name.end(), label.begin(), label.end(),
+                          [](char a, char b){return std::tolower((unsigned char)a) == std::tolower((unsigned char)b);}))
+            {
+                type = i;
+            }
+        }
+
+        if(type < 0 || value.empty() || value.find_first_not_of("0123456789") != std::string::npos)
+        {
+            return false;
+        }
+
+        read[type] = std::atoi(value.c_str());
+    }
+
+    if(std::all_of(std::begin(read), std::end(read), [](int weight){return weight == 0;}))
+    {
+        return false;
+    }
+
+    std::copy(std::begin(read), std::end(read), std::begin(weights));
+
+    return true;
+}
+
+/*! Every shape starts at a point inside the region; its other points lie within maxExtent of that point. */
+void SceneGenerator::writeRecord(ShapeWriter &writer, long long shapeId, std::mt19937_64 &engine) const
+{
+    using namespace ShapeFields;
+    using namespace ShapeLabels;
+
+    int pick = uniform(engine, 0, totalWeight - 1);
+    int type{0};
+
+    while(pick >= spec.weights[type])
+    {
+        pick -= spec.weights[type++];
+    }
+
+    int x = uniform(engine, 0, spec.width - 1);
+    int y = uniform(engine, 0, spec.height - 1);
+
+    writer.writeField(SHAPE_ID, int(shapeId));
+    writer.writeField(SHAPE_TYPE, SHAPES_LIST[type]);
+
+    switch(type)
+    {
+    case LINE:
+    {
+        int dims[4] {x, y, x + uniform(engine, -spec.maxExtent, spec.maxExtent), y + uniform(engine, -spec.maxExtent, spec.maxExtent)};
+        writer.writeList(SHAPE_DIMENSIONS, dims, 4);
+        break;
+    }
+    case POLYLINE:
+    case POLYGON:
+    {
+        int vertices = uniform(engine, spec.minVertices, spec.maxVertices);
+        std::vector<int> dims(std::size_t(2 * vertices));
+
+        for(int i = 0; i < vertices; ++i)
+        {
+            dims[std::size_t(2 * i)] = x + uniform(engine, 0, spec.maxExtent);
+            dims[std::size_t(2 * i + 1)] = y + uniform(engine, 0, spec.maxExtent);
+        }
+
+        writer.writeList(SHAPE_DIMENSIONS, dims.data(), 2 * vertices);
+        break;
+    }
+    case SQUARE:
+    case CIRCLE:
+    {
+        int dims[3] {x, y, uniform(engine, 1, spec.maxExtent)};
+        writer.writeList(SHAPE_DIMENSIONS, dims, 3);
+        break;
+    }
+    default:
+    {
+        int dims[4] {x, y, uniform(engine, 1, spec.maxExtent), uniform(engine, 1, spec.maxExtent)};
+        writer.writeList(SHAPE_DIMENSIONS, dims, 4);
+    }
+    }
+
+    if(type == TEXT)
+    {
+        writer.writeField(TEXT_STRING, "Shape " + std::to_string(shapeId));
+        writer.writeField(TEXT_COLOR, globalColorString[uniform(engine, 0, COLORS - 1)]);
+        writer.writeField(TEXT_ALIGNMENT, textAlignmentString[uniform(engine, 0, TEXT_ALIGNS - 1)]);
+        writer.writeField(TEXT_POINT_SIZE, uniform(engine, MIN_GENERATED_POINT, MAX_GENERATED_POINT));
+        writer.writeField(TEXT_FONT_FAMILY, FONT_FAMILIES[uniform(engine, 0, NUM_FONT_FAMILIES - 1)]);
+        writer.writeField(TEXT_FONT_STYLE, textFontStyleString[uniform(engine, 0, FONT_STYLES - 1)]);
+        writer.writeField(TEXT_FONT_WEIGHT, textFontWeightString[uniform(engine, 0, FONT_WEIGHTS - 1)]);
+        return;
+    }
+
+    writer.writeField(PEN_COLOR, globalColorString[uniform(engine, 0, COLORS - 1)]);
+    writer.writeField(PEN_WIDTH, uniform(engine, 0, MAX_PEN_WIDTH));
+    writer.writeField(PEN_STYLE, penStyleString[uniform(engine, 0, PEN_STYLES - 1)]);
+    writer.writeField(PEN_CAP_STYLE, penCapStyleString[uniform(engine, 0, CAP_STYLES - 1)]);
+    writer.writeField(PEN_JOIN_STYLE, penJoinStyleString[uniform(engine, 0, JOIN_STYLES - 1)]);
+
+    if(type != LINE && type != POLYLINE)
+    {
+        writer.writeField(BRUSH_COLOR, globalColorString[uniform(engine, 0, COLORS - 1)]);
+        writer.writeField(BRUSH_STYLE, brushStyleString[uniform(engine, 0, BRUSH_STYLES - 1)]);
+    }
+}
@@ -0,0 +1,103 @@
+/*!
+ * \class   SceneGenerator
+ * \brief   Writes synthetic shape files of any size, with a chosen mix of shape types, for load and render benchmarks.
+*/
+
+#ifndef SCENEGENERATOR_H
+#define SCENEGENERATOR_H
+
+#include "shape.h"
+#include <cstdint>
+#include <random>
+#include <string>
+
+class ShapeWriter;
+
+/*! \struct SceneSpec
+ * \brief What a generated document holds.
+ */
+struct SceneSpec
+{
+    long long shapeCount{1000};                 /*!< the number of shapes; IDs run from 1 to shapeCount */
+    int weights[NUM_SHAPES]{1, 1, 1, 1, 1, 1, 1, 1};  /*!< the relative frequency of each shape type, indexed by ShapeLabels::eShapes */
+    int minVertices{2};                         /*!< the fewest vertices of a polyline or polygon */
+    int maxVertices{8};                         /*!< the most vertices of a polyline or polygon */
+    int width{1000};                            /*!< the width of the region shapes are placed in, in canvas units */
+    int height{500};                            /*!< the height of the region shapes are placed in, in canvas units */
+    int maxExtent{60};                          /*!< the largest width, height, side, or radius of a shape */
+    std::uint64_t seed{2018};                   /*!< the seed; the same spec always gives the same document */
+};
+
+/*! The shapes are generated in chunks of CHUNK_SHAPES. Every chunk has its own random engine, seeded from the spec's seed
+ * and the chunk's position, so a chunk can be generated without generating the ones before it.
+ * save() uses this to format chunks on several threads while the chunks already formatted are written in order;
+ * only a few chunks per thread are held in memory at once, so files far larger than memory can be written.
+ * The document is the same whatever the number of threads.
+ * Random numbers are taken straight from std::mt19937_64, whose output the standard fixes, instead of from the
+ * standard distributions, whose output differs between libraries; a seed gives the same file on every platform.
+ * Styles are drawn from the full vocabulary of qtconversions.h.
+ * \sa ParallelSaver
+ */
+class SceneGenerator
+{
+public:
+
+    static constexpr int CHUNK_SHAPES = 4096;   /*!< The number of shapes generated from one random engine */
+    static constexpr int CHUNKS_PER_THREAD = 4; /*!< The number of chunk buffers per thread held by save() */
+
+    //! Constructor
+    /*! \param spec what the document holds; a polyline or polygon gets at least 2 vertices, and every type weight below 0 counts as 0
+     */
+    explicit SceneGenerator(const SceneSpec &spec);
+
+    //! Gets the spec, with its limits applied.
+    const SceneSpec &getSpec() const {return spec;}
+
+    //! Gets the number of chunks.
+    long long chunkCount() const {return (spec.shapeCount + CHUNK_SHAPES - 1) / CHUNK_SHAPES;}
+
+    //! Writes the records of one chunk.
+    /*! Every record but the last of the document is followed by an empty line, as in AllShapes::printAll(),
+     * so the chunks can be concatenated in order.
+     * \param chunk the position of the chunk
+     * \param writer the writer receiving the records
+     */
+    void writeChunk(long long chunk, ShapeWriter &writer) const;
+
+    //! Generates the whole document in memory.
+    /*! \returns The text of the document.
+     */
+    std::string generate() const;
+
+    //! Writes the document to a file.
+    /*! \param fileName the path of the file to be written; an existing file is replaced
+     * \param maxThreads the largest number of threads formatting chunks; 0 uses one per hardware thread
+     * \returns The number of bytes written, or -1 if the file cannot be written.
+     */
+    long long save(const std::string &fileName, int maxThreads = 0) const;
+
+    //! Reads a shape type mix.
+    /*! The mix lists type weights as "type=weight" pairs separated by commas, such as "line=2,text=1".
+     * Type names are matched without regard to case; types that are not listed get weight 0.
+     * \param text the mix
+     * \param weights the weights, indexed by ShapeLabels::eShapes
+     * \returns FALSE if a type is unknown, a weight is not a number, or every weight is 0.
+     */
+    static bool readMix(const std::string &text, int (&weights)[NUM_SHAPES]);
+
+private:
+
+    //! Gets a number from lowest to highest, both included.
+    static int uniform(std::mt19937_64 &engine, int lowest, int highest)
+    {
+        return lowest + int(engine() % std::uint64_t(highest - lowest + 1));
+    }
+
+    //! Writes one record.
+    void writeRecord(ShapeWriter &writer, long long shapeId, std::mt19937_64 &engine) const;
+
+    SceneSpec spec;                 /*!< what the document holds */
+    int totalWeight;                /*!< the sum of the type weights */
+};
+
+#endif // SCENEGENERATOR_H
@@ -3,13 +3,13 @@
 //! Compares the current largest perimeter to the perimeter of the current Shape in the vector.
 bool perimeterCompare(Shape* bestShape, Shape* currentShape)
 {
-    return (bestShape -> calcPerimeter() > currentShape -> calcPerimeter());
+    return (bestShape -> getPerimeter() > currentShape -> getPerimeter());
 }
 
 //! Compares the current largest area to the area of the current Shape in the vector.
 bool areaCompare(Shape* bestShape, Shape* currentShape)
 {
-    return (bestShape -> calcArea() > currentShape -> calcArea());
+    return (bestShape -> getArea() > currentShape -> getArea());
 }
 
 //! Compares the current largest ID to the ID of the current Shape in the vector.
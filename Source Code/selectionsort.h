@@ -14,6 +14,7 @@
 //! Compares shape perimeters.
 /*! Used to sort the shape vector from smallest perimeter to largest perimeter.
  * Lines and polylines interpret perimeter as total length. Their lengths are factored into this comparison.
+ * Reads the cached perimeters, so shapes that did not change since the last sort are not recomputed.
  * \param bestShape a pointer to the Shape with the current largest perimeter.
  * \param currentShape a pointer to the current Shape in the vector that is being compared
  * \returns A boolean expression
@@ -26,6 +27,7 @@ bool perimeterCompare(Shape* bestShape, Shape* currentShape);
 //! Compares shape areas.
 /*! Used to sort the shape vector from smallest area to largest area.
  * Lines, polylines, and text boxes are set to area 0.
+ * Reads the cached areas, so shapes that did not change since the last sort are not recomputed.
  * \param bestShape a pointer to the Shape with the current largest area.
  * \param currentShape a pointer to the current Shape in the vector that is being compared
  * \returns A boolean expression
@@ -40,7 +42,7 @@ bool areaCompare(Shape* bestShape, Shape* currentShape);
  * Makes use of two overloaded operators for Shape: == and <
  * If two shapes have the same ID numbers, this function will throw an exception and output an error message.
  * Code to prevent this from happening is included in the AllShapes class. The exception is kept in the case of future modifications and testing.
- * \sa AllShapes::setCurrentID
+ * \sa IdAllocator
  * \param bestShape a pointer to the Shape with the current largest ID.
  * \param currentShape a pointer to the current Shape in the vector that is being compared
  * \returns A boolean expression
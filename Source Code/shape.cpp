@@ -1,13 +1,20 @@
 #include "shape.h"
 #include "qtconversions.h"
+#include "shapewriter.h"
 #include <sstream>
 using std::endl;
 
+#ifdef SHAPE_PERF_COUNTERS
+std::atomic<long long> Shape::metricsCacheHits{0};
+std::atomic<long long> Shape::metricsCacheMisses{0};
+#endif
+
 //! Alternate constructor
-Shape::Shape(int shapeId, std::string shapeType, int numDimensions, dim::specs *shapeDimensions)
-    : shapeId{shapeId}, shapeType{shapeType}, numDimensions{numDimensions}
+Shape::Shape(int shapeId, ShapeLabels::eShapes shapeType, int numDimensions, dim::specs *shapeDimensions)
+    : shapeId{shapeId}, shapeType{shapeType}, numDimensions{numDimensions}, shapeDimensions{inlineDimensions}, penId{0}, brushId{0},
+      cachedPerimeter{0.0}, cachedArea{0.0}, metricsValid{false}
 {
-    this -> shapeDimensions = new dim::specs[numDimensions];
+    allocateDimensions(numDimensions);
 
     for(int i = 0; i < numDimensions; ++i)
     {
@@ -16,25 +23,139 @@ Shape::Shape(int shapeId, std::string shapeType, int numDimensions, dim::specs *
 }
 
 //! Sets shape information
-void Shape::setBaseInfo(int shapeId, std::string shapeType, int numDimensions, dim::specs* otherDimensions)
+void Shape::setBaseInfo(int shapeId, int numDimensions, dim::specs* otherDimensions)
 {
-    /*! Deletes former data if it has to be overriden */
-    if(this -> shapeDimensions != nullptr)
+    dim::specs *dimensions = resetDimensions(shapeId, numDimensions);
+
+    for(int i = 0; i < numDimensions; ++i)
     {
-        delete[] this -> shapeDimensions;
-        shapeDimensions = nullptr;
+        dimensions[i] = otherDimensions[i];
+    }
+}
+
+//! Sets the shape ID and sizes the shape dimensions.
+dim::specs* Shape::resetDimensions(int shapeId, int numDimensions)
+{
+    /*! Only reallocates when the number of dimensions changes; edits of the same shape reuse the existing storage */
+    if(this -> numDimensions != numDimensions)
+    {
+        allocateDimensions(numDimensions);
     }
 
     this -> shapeId = shapeId;
-    this -> shapeType = shapeType;
     this -> numDimensions = numDimensions;
+    invalidateMetrics();
+
+    return shapeDimensions;
+}
 
-    shapeDimensions = new dim::specs[numDimensions];
+//! Points the shape dimensions at inline or dynamic storage.
+void Shape::allocateDimensions(int count)
+{
+    releaseDimensions();
 
-    for(int i = 0; i < numDimensions; ++i)
+    /*! Only large polylines and polygons spill to the heap */
+    if(count > MAX_INLINE_DIMENSIONS)
+    {
+        shapeDimensions = new dim::specs[count];
+    }
+}
+
+//! Releases the dynamic array of shape dimensions.
+void Shape::releaseDimensions()
+{
+    if(shapeDimensions != inlineDimensions)
+    {
+        delete[] shapeDimensions;
+        shapeDimensions = inlineDimensions;
+    }
+}
+
+//! Finds the bounding box from the first four shape dimensions.
+QRect Shape::calcBoundingBox() const
+{
+    return QRect(shapeDimensions[0], shapeDimensions[1], shapeDimensions[2], shapeDimensions[3]);
+}
+
+//! Finds the ID label at the first point of the shape.
+QRect Shape::calcLabelRect() const
+{
+    return QRect(shapeDimensions[0], shapeDimensions[1], LABEL_SIZE, LABEL_SIZE);
+}
+
+//! Finds the area the shape and its ID label may paint into.
+QRect Shape::getPaintBounds() const
+{
+    int margin = getPen().width() + 1;
+
+    return getBoundingBox().normalized().united(calcLabelRect()).adjusted(-margin, -margin, margin, margin);
+}
+
+//! Finds the bounding box of the shape dimensions read as (x, y) points.
+QRect Shape::calcVertexBoundingBox() const
+{
+    if(numDimensions < 2)
+    {
+        return QRect();
+    }
+
+    dim::coord minX = shapeDimensions[0], maxX = shapeDimensions[0];
+    dim::coord minY = shapeDimensions[1], maxY = shapeDimensions[1];
+
+    for(int i = 2; i + 1 < numDimensions; i += 2)
     {
-        shapeDimensions[i] = otherDimensions[i];
+        minX = std::min(minX, shapeDimensions[i]);
+        maxX = std::max(maxX, shapeDimensions[i]);
+        minY = std::min(minY, shapeDimensions[i + 1]);
+        maxY = std::max(maxY, shapeDimensions[i + 1]);
     }
+
+    return QRect(minX, minY, maxX - minX, maxY - minY);
+}
+
+//! Recomputes the cached metrics if the shape changed.
+void Shape::updateMetrics() const
+{
+    if(metricsValid)
+    {
+#ifdef SHAPE_PERF_COUNTERS
+        metricsCacheHits.fetch_add(1, std::memory_order_relaxed);
+#endif
+        return;
+    }
+
+#ifdef SHAPE_PERF_COUNTERS
+    metricsCacheMisses.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+    cachedPerimeter = calcPerimeter();
+    cachedArea = calcArea();
+    cachedBoundingBox = calcBoundingBox();
+    metricsValid = true;
+}
+
+//! Gets the cached perimeter.
+dim::perimeter Shape::getPerimeter() const
+{
+    updateMetrics();
+
+    return cachedPerimeter;
+}
+
+//! Gets the cached area.
+dim::area Shape::getArea() const
+{
+    updateMetrics();
+
+    return cachedArea;
+}
+
+//! Gets the cached bounding box.
+QRect Shape::getBoundingBox() const
+{
+    updateMetrics();
+
+    return cachedBoundingBox;
 }
 
 /*! Sets shape dimensions in the shapeDimensions array after a shape has been moved */
@@ -44,31 +165,44 @@ void Shape::setShapeDimensions(const QPoint &shift)
     shapeDimensions[ShapeLabels::Y1] += shift.y();
 }
 
-/*! Default print method for a shape */
+//! Prints the shape through a small ShapeWriter over a string stream.
 std::string Shape::print() const
 {
      std::ostringstream oss;
-
-     oss << "ShapeId: " << shapeId << endl;
-     oss << "ShapeType: " << shapeType << endl;
-     oss << "ShapeDimensions: ";
-     for(int i = 0; i < numDimensions; ++i)
      {
-         oss << shapeDimensions[i];
-         if(i < numDimensions - 1)
-         {
-             oss << ", ";
-         }
+         ShapeWriter writer(oss, ShapeWriter::MIN_CAPACITY * 8);
+         serialize(writer);
      }
-     oss << endl;
-
-     oss << "PenColor: " << getColorAsString(pen.color()) << endl;
-     oss << "PenWidth: " << pen.width() << endl;
-     oss << "PenStyle: " << getPenStyleAsString(pen.style()) << endl;
-     oss << "PenCapStyle: " << getCapStyleAsString(pen.capStyle()) << endl;
-     oss << "PenJoinStyle: " << getJoinStyleAsString(pen.joinStyle()) << endl;
-     oss << "BrushColor: " << getColorAsString(brush.color()) << endl;
-     oss << "BrushStyle: " << getBrushStyleAsString(brush.style()) << endl;
 
      return oss.str();
 }
+
+/*! Default serialize method for a shape */
+void Shape::serialize(ShapeWriter &writer) const
+{
+     serializeHeader(writer);
+     serializePen(writer);
+
+     const QBrush &brush = getBrush();
+
+     writer.writeField(ShapeFields::BRUSH_COLOR, getColorAsString(brush.color()));
+     writer.writeField(ShapeFields::BRUSH_STYLE, getBrushStyleAsString(brush.style()));
+}
+
+void Shape::serializeHeader(ShapeWriter &writer) const
+{
+     writer.writeField(ShapeFields::SHAPE_ID, shapeId);
+     writer.writeField(ShapeFields::SHAPE_TYPE, getType());
+     writer.writeList(ShapeFields::SHAPE_DIMENSIONS, shapeDimensions, numDimensions);
+}
+
+void Shape::serializePen(ShapeWriter &writer) const
+{
+     const QPen &pen = getPen();
+
+     writer.writeField(ShapeFields::PEN_COLOR, getColorAsString(pen.color()));
+     writer.writeField(ShapeFields::PEN_WIDTH, pen.width());
+     writer.writeField(ShapeFields::PEN_STYLE, getPenStyleAsString(pen.style()));
+     writer.writeField(ShapeFields::PEN_CAP_STYLE, getCapStyleAsString(pen.capStyle()));
+     writer.writeField(ShapeFields::PEN_JOIN_STYLE, getJoinStyleAsString(pen.joinStyle()));
+}
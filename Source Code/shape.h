@@ -10,13 +10,23 @@
 
 #include "libraries.h"
 #include "custommath.h"
+#include "styletable.h"
+#ifdef SHAPE_PERF_COUNTERS
+#include <atomic>
+#endif
+
+class ShapeWriter;
 
 const int NUM_SHAPES = 8;           /*!< The total number of shapes represented in the application: Line, Polyline, Polygon, Rectangle, Square, Ellipse, Circle, Text */
 const int NUM_STATIC_SHAPES = 6;    /*!< The total number of shapes without dynamic shape dimensions: Line, Rectangle, Square, Ellipse, Circle, Text */
 
+const int LABEL_SIZE = 20;          /*!< The width and height of the ID label drawn with every shape */
+
 const int MIN_TEXT_POINT = -1;      /*!< The minimum text point size */
 const int MAX_TEXT_POINT = 50;      /*!< The maximum text point size */
 
+const int MAX_INLINE_DIMENSIONS = 8;    /*!< The number of shape dimensions stored inside the Shape object before spilling to the heap */
+
 
 /*! \namespace ShapeLabels
  * \brief Contains enumerations and arrays that represent locations in QPoints and in arrays of shape dimensions.
@@ -87,36 +97,40 @@ namespace ShapeLabels
 
 /*! This class has five pure virtual functions: draw, move, calcPerimeter, calcArea, and setPosition.
  * These functions are overriden individually throughout all derived classes.
+ * Only the data shared by every shape type lives here; type specific data (such as the font and text of a Text object) lives in the derived classes.
  */
 class Shape
 {
 public:
 
     //! Default constructor
-    /*! Sets the shape specifications to default values.
-     * Creates a new dynamic array of shape dimensions based on the number of dimensions the relevant derived shape has.
+    /*! Sets the shape specifications to default values for the passed in shape type.
+     * The (empty) array of shape dimensions points at the inline dimension buffer until setBaseInfo() is called.
      * \sa Parser::getShapePtr()
+     * \param shapeType the enumeration value representing the derived shape type
      */
-    Shape(): shapeId{0}, shapeType{"Nullbody"}, numDimensions{0}, shapeDimensions{new dim::specs[numDimensions]}, text{"Nullbody"} {}
+    explicit Shape(ShapeLabels::eShapes shapeType): shapeId{0}, shapeType{shapeType}, numDimensions{0}, shapeDimensions{inlineDimensions}, penId{0}, brushId{0},
+                                                     cachedPerimeter{0.0}, cachedArea{0.0}, metricsValid{false} {}
 
     //! Alternate constructor
     /*! Passes in all shape data to be implemented upon construction.
      * Initializes static shape data to passed in values via a base member initialization list.
-     * Creates a dynamic array of shape dimensions and sets each value to the corresponding value from the passed in array.
-     * \sa MainWindow::on_lineSave_clicked()
-     * \sa MainWindow::on_polylineSave_clicked()
-     * \sa MainWindow::on_polygonSave_clicked()
-     * \sa MainWindow::on_rectangleSave_clicked()
-     * \sa MainWindow::on_squareSave_clicked()
-     * \sa MainWindow::on_ellipseSave_clicked()
-     * \sa MainWindow::on_circleSave_clicked()
-     * \sa MainWindow::on_textSave_clicked()
+     * Stores the shape dimensions inline when there are at most MAX_INLINE_DIMENSIONS of them, otherwise creates a dynamic array,
+     * and sets each value to the corresponding value from the passed in array.
+     * \sa MainWindow::lineSaveClicked()
+     * \sa MainWindow::polylineSaveClicked()
+     * \sa MainWindow::polygonSaveClicked()
+     * \sa MainWindow::rectangleSaveClicked()
+     * \sa MainWindow::squareSaveClicked()
+     * \sa MainWindow::ellipseSaveClicked()
+     * \sa MainWindow::circleSaveClicked()
+     * \sa MainWindow::textSaveClicked()
      * \param shapeId the ID number of the new ellipse
-     * \param shapeType the string representing a shape type
+     * \param shapeType the enumeration value representing the derived shape type
      * \param numDimensions the number of dimensions the shape has
      * \param *shapeDimensions the pointer to the array of shape dimensions
      */
-    Shape(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions);
+    Shape(int shapeId, ShapeLabels::eShapes shapeType, int numDimensions, dim::specs* shapeDimensions);
 
     //! Removes functionality of a copy constructor.
     Shape(const Shape &otherShape) = delete;
@@ -126,10 +140,10 @@ public:
 
     //! Virtual destructor.
     /*! Marked virtual since the Shape class has virtual and pure virtual functions.
-     * Deletes the pointer to the dynamic array of shape dimensions upon program termination.
+     * Deletes the dynamic array of shape dimensions upon program termination if the dimensions spilled to the heap.
      * All data that is elected to be saved is printed to the shape input file.
      */
-    virtual ~Shape(){delete[] shapeDimensions;}
+    virtual ~Shape(){releaseDimensions();}
 
     //! Overloaded equality operator.
     /*! Used when comparing shape ID numbers.
@@ -148,15 +162,16 @@ public:
     //! Overloaded greater than operator.
     /*! Used when comparing shape ID numbers.
      * \param shape the Shape object being compared to the invoking object
-     * \sa AllShapes::setCurrentID()
      */
     bool operator>(const Shape& shape) const {return shapeId > shape.shapeId;}
 
     //! Pure virtual function that draws a shape.
     /*! This function is overriden by all derived classes to draw specific shapes with specific dimensions, QPen, and QBrush settings.
+     * One QPainter is shared by every shape drawn during a paint event.
+     * \param painter the active QPainter of the rendering area
      * \sa canvas::paintEvent();
      */
-    virtual void draw() = 0;
+    virtual void draw(QPainter &painter) = 0;
 
     //! Pure virtual function that moves a shape.
     /*! This function is overriden by all derived classes to move specific shapes.
@@ -181,6 +196,73 @@ public:
      */
     virtual dim::area calcArea() const = 0;
 
+    //! Virtual function that finds the bounding box of a shape.
+    /*! Returns the extents the shape is drawn with. The default treats the first four dimensions as x, y, width, and height,
+     * which fits rectangles, ellipses, and text boxes. Overriden by the other shape types.
+     * \returns The bounding box of the shape.
+     */
+    virtual QRect calcBoundingBox() const;
+
+    //! Virtual function that finds where the shape draws its ID label.
+    /*! The default places the label with its top left corner on the first point of the shape, (x1, y1),
+     * which fits lines, polylines, polygons, ellipses, and circles. Overriden by rectangles, squares, and text boxes.
+     * \returns The LABEL_SIZE by LABEL_SIZE rectangle the ID is drawn in.
+     */
+    virtual QRect calcLabelRect() const;
+
+    //! Gets the area the shape may paint into.
+    /*! The bounding box is united with the ID label, which may lie outside the box, then widened by the pen width,
+     * since square caps reach half a width past the end points and miter joins up to a full width past the vertices.
+     * \returns The rectangle holding every pixel the shape's draw() may touch.
+     * \sa canvas::paintEvent()
+     */
+    QRect getPaintBounds() const;
+
+    //! Gets the perimeter of the shape from the metrics cache.
+    /*! Computes the perimeter, area, and bounding box only if the shape changed since they were last computed.
+     * \returns The cached perimeter.
+     * \sa perimeterCompare()
+     * \sa MainWindow::sortPerimeterTable()
+     */
+    dim::perimeter getPerimeter() const;
+
+    //! Gets the area of the shape from the metrics cache.
+    /*! Computes the perimeter, area, and bounding box only if the shape changed since they were last computed.
+     * \returns The cached area.
+     * \sa areaCompare()
+     * \sa MainWindow::sortAreaTable()
+     */
+    dim::area getArea() const;
+
+    //! Gets the bounding box of the shape from the metrics cache.
+    /*! Computes the perimeter, area, and bounding box only if the shape changed since they were last computed.
+     * \returns The cached bounding box.
+     */
+    QRect getBoundingBox() const;
+
+    //! Gets the number of heap bytes the shape owns.
+    /*! Inline function: counts the dimension array when it does not fit inline.
+     * Polylines, polygons, and text boxes hide this function to add their points and text;
+     * call it through the exact derived type, as footprintBytes() does. Pens, brushes, and fonts are shared and not counted.
+     * \returns The bytes requested from the heap for the shape's own data.
+     */
+    std::size_t getHeapBytes() const {return numDimensions > MAX_INLINE_DIMENSIONS ? std::size_t(numDimensions) * sizeof(dim::specs) : 0;}
+
+#ifdef SHAPE_PERF_COUNTERS
+    //! Gets the number of metric lookups answered from the cache since the counters were last reset.
+    /*! The counters only exist in instrumented builds, so the lookups of other builds touch no shared state.
+     * They are relaxed atomics, since the loader thread warms the metrics while the GUI thread may read them.
+     * \sa AllShapes::buildCaches()
+     */
+    static long long getMetricsCacheHits() {return metricsCacheHits.load(std::memory_order_relaxed);}
+
+    //! Gets the number of metric lookups that had to recompute the metrics since the counters were last reset.
+    static long long getMetricsCacheMisses() {return metricsCacheMisses.load(std::memory_order_relaxed);}
+
+    //! Resets the metrics cache hit and miss counters to 0.
+    static void resetMetricsCacheCounters() {metricsCacheHits.store(0, std::memory_order_relaxed); metricsCacheMisses.store(0, std::memory_order_relaxed);}
+#endif
+
     //! Sets the QPoint data member(s) to the position of the shape.
     /*! This function is overriden by all derived classes to set the position of each shape in the rendering area.
      */
@@ -189,26 +271,52 @@ public:
     //! Sets the base shape information.
     /*! Used when populating the shape vector in the parser class.
      * Also used when editing a shape's values via the front end.
+     * The shape type is fixed when the derived object is constructed and is not changed here.
      * \sa AllShapes::editShape()
      * \sa Parser::parseShapes()
      * \param shapeId the shape's ID number
-     * \param shapeType the string literal representing the type of shape being created
      * \param numDimensions the number of dimensions the currently selected shape has
      * \param otherDimensions the pointer to an array of dimensions being copied into this Shape object's array of dimensions
      */
-    void setBaseInfo(int shapeId, std::string shapeType, int numDimensions, dim::specs* otherDimensions);
+    void setBaseInfo(int shapeId, int numDimensions, dim::specs* otherDimensions);
+
+    //! Sets the shape ID and makes room for the shape dimensions, which the caller then writes.
+    /*! Lets the parser read dimensions straight into the shape, with no array in between.
+     * Storage is only reallocated when the number of dimensions changes; the contents of the returned array are unspecified.
+     * \sa Parser::parseShapes()
+     * \param shapeId the shape's ID number
+     * \param numDimensions the number of dimensions the shape will have
+     * \returns The pointer to the array of shape dimensions, to be filled with numDimensions values.
+     */
+    dim::specs* resetDimensions(int shapeId, int numDimensions);
 
     //! Sets the QPen values.
-    /*! Inline function: sets the pen color, width, style, cap style, and join style.
+    /*! Inline function: interns the pen color, width, style, cap style, and join style in the shared style table.
      * \param pen the populated QPen object
+     * \sa StyleTable::internPen()
      */
-    void setPen(const QPen &pen) {this -> pen = pen;}
+    void setPen(const QPen &pen) {penId = StyleTable::shared().internPen(pen);}
 
     //! Sets the QBrush values.
-    /*! Inline function: sets the brush color and style.
+    /*! Inline function: interns the brush color and style in the shared style table.
      * \param brush the populated QBrush object
+     * \sa StyleTable::internBrush()
+     */
+    void setBrush(const QBrush &brush) {brushId = StyleTable::shared().internBrush(brush);}
+
+    //! Sets the pen ID.
+    /*! Inline function: points the shape at a pen already interned in the shared style table.
+     * \param id the ID of the interned pen
+     * \sa Parser::resolvePen()
      */
-    void setBrush(const QBrush &brush) {this -> brush = brush;}
+    void setPenId(int id) {penId = id;}
+
+    //! Sets the brush ID.
+    /*! Inline function: points the shape at a brush already interned in the shared style table.
+     * \param id the ID of the interned brush
+     * \sa Parser::resolveBrush()
+     */
+    void setBrushId(int id) {brushId = id;}
 
     //! Sets the shape ID.
     /*! Inline function: sets the ID of the current shape object.
@@ -221,20 +329,32 @@ public:
      * \param dimensionIndex the location of the specified dimension in the current shape object's dimension array
      * \param newDimension the new dimension to be assigned to the specified location
      */
-    void setShapeDimension(int dimensionIndex, dim::specs newDimension) {shapeDimensions[dimensionIndex] = newDimension;}
+    void setShapeDimension(int dimensionIndex, dim::specs newDimension) {shapeDimensions[dimensionIndex] = newDimension; invalidateMetrics();}
 
     //! Gets the shape type of the current shape object.
     /*! Inline function: returns the string literal representing the current shape object's shape type.
+     * \returns the current shape type, as a reference into ShapeLabels::SHAPES_LIST
+     */
+    const std::string &getType() const {return ShapeLabels::SHAPES_LIST[shapeType];}
+
+    //! Gets the shape type enumeration value of the current shape object.
+    /*! Inline function: returns the ShapeLabels::eShapes value representing the current shape object's shape type.
      * \returns the current shape type
      */
-    std::string getType() {return shapeType;}
+    ShapeLabels::eShapes getShapeType() const {return shapeType;}
 
     //! Gets the QBrush of the current shape object.
     /*! Inline function: returns the QBrush object representing the current shape object.
-     * \returns the current QBrush object by reference
+     * \returns the current QBrush object by constant reference into the shared style table
      * \sa MainWindow::setCurrentShapeInfo()
      */
-    QBrush &getBrush() {return brush;}
+    const QBrush &getBrush() const {return StyleTable::shared().getBrush(brushId);}
+
+    //! Gets the brush ID of the current shape object.
+    /*! Inline function: returns the ID of the current shape object's brush in the shared style table.
+     * \returns the current brush ID
+     */
+    int getBrushId() const {return brushId;}
 
     //! Gets the ID number of the current shape object.
     /*! Inline function: returns the ID number representing the current shape object.
@@ -245,23 +365,22 @@ public:
      */
     int getID() const {return shapeId;}
 
-    //! Gets the QPainter object representing the current shape object.
-    /*! Inline function: returns the QPainter object representing the current shape object.
-     * Allows Qt to draw the shape being rendered onto the promoted canvas widget.
-     * \returns the current QPainter object by reference
-     * \sa canvas::paintEvent()
-     */
-    QPainter &getPainter() {return painter;}
-
     //! Gets the QPen of the current shape object.
     /*! Inline function: returns the QPen object representing the current shape object.
-     * \returns the current QPen object by reference
+     * \returns the current QPen object by constant reference into the shared style table
      * \sa MainWindow::setCurrentShapeInfo()
      */
-    QPen &getPen() {return pen;}
+    const QPen &getPen() const {return StyleTable::shared().getPen(penId);}
+
+    //! Gets the pen ID of the current shape object.
+    /*! Inline function: returns the ID of the current shape object's pen in the shared style table.
+     * \returns the current pen ID
+     */
+    int getPenId() const {return penId;}
 
     //! Gets the pointer to the array of shape dimensions for the current shape object.
     /*! Inline function: returns the pointer to the array of shape dimensions representing the current shape object.
+     * The array lives inside the object for up to MAX_INLINE_DIMENSIONS dimensions and on the heap otherwise.
      * \returns the pointer to the array of shape dimensions.
      * \sa MainWindow::setCurrentShapeInfo()
      */
@@ -281,73 +400,75 @@ public:
      */
     virtual void setShapeDimensions(const QPoint &shift);
 
-    //! Virtual function that prints all shape properties as a single string.
+    //! Prints all shape properties as a single string.
     /*! This function prints all values stored in the shape as a single string in the format of the input file.
+     * The string is produced by serialize(); saving writes straight to a ShapeWriter instead.
+     * \returns The shape properties, one field per line.
+     */
+    std::string print() const;
+
+    //! Virtual function that writes all shape properties in the format of the input file.
+    /*! Writes the shape ID, type, dimensions, pen, and brush.
      * Overriden by Line, Polyline, and Text due to their differences in shape properties.
+     * \param writer the writer that receives the fields
      * \sa AllShapes::printAll()
      */
-    virtual std::string print() const;
+    virtual void serialize(ShapeWriter &writer) const;
 
-    //! This function is specific to the derived class Text.
-    //! Sets the actual text of the text box.
-    /*! Inline function: sets the text of the text box with the passed in string.
-     * \param newText the text to be visible in the Text object
+protected:
+    //! Points shapeDimensions at storage large enough for the passed in number of dimensions.
+    /*! Uses the inline dimension buffer when the dimensions fit, otherwise allocates a dynamic array.
+     * Any previously allocated dynamic array is released first. The contents of the new storage are unspecified.
+     * \param count the number of dimensions that need to be stored
      */
-    void setText(const std::string newText) {text = newText;}
+    void allocateDimensions(int count);
 
-    //! This function is specific to the derived class Text.
-    //! Sets the QFont values.
-    /*! Inline function: sets the font family, style, and weight.
-     * \param font the populated QFont object
-     */
-    void setFont(const QFont &font) {this -> font = font;}
+    //! Releases the dynamic array of shape dimensions, if there is one, and points shapeDimensions back at the inline buffer.
+    void releaseDimensions();
 
-    //! This function is specific to the derived class Text.
-    //! Sets the alignment of the text in the text box.
-    /*! Inline function: sets the alignment of the text in the text box.
-     * \param flag the alignment setting for the text in the text box
+    //! Marks the cached perimeter, area, and bounding box as out of date.
+    /*! Called whenever the shape dimensions change: by setBaseInfo(), setShapeDimension(), and every derived move().
      */
-    void setAlignment(Qt::AlignmentFlag flag) {alignFlag = flag;}
+    void invalidateMetrics() {metricsValid = false;}
 
-    //! This function is specific to the derived class Text.
-    //! Gets the text of the current Text object.
-    /*! Inline function: returns the text that is visible for the Text object.
-     * \returns the current text as a string
-     * \sa MainWindow::setCurrentShapeInfo()
+    //! Finds the bounding box of the shape dimensions read as a chain of (x, y) points.
+    /*! Used by lines, polylines, and polygons.
+     * \returns The smallest rectangle containing every point.
      */
-    std::string getText() {return text;}
+    QRect calcVertexBoundingBox() const;
 
-    //! This function is specific to the derived class Text.
-    //! Gets the QFont of the current shape object.
-    /*! Inline function: returns the QFont object representing the Text object.
-     * \returns the current QFont object by reference
-     * \sa MainWindow::setCurrentShapeInfo()
+    //! Writes the shape ID, type, and dimensions fields shared by every shape.
+    /*! \param writer the writer that receives the fields
      */
-    QFont &getFont() {return font;}
+    void serializeHeader(ShapeWriter &writer) const;
 
-    //! This function is specific to the derived class Text.
-    //! Gets the QFont of the current shape object.
-    /*! Inline function: returns the QFont object representing the Text object.
-     * \returns the current QFont object by reference
-     * \sa MainWindow::setCurrentShapeInfo()
+    //! Writes the pen fields shared by every shape except text.
+    /*! \param writer the writer that receives the fields
      */
-    Qt::AlignmentFlag getFlag() {return alignFlag;}
+    void serializePen(ShapeWriter &writer) const;
 
-
-protected:
     int shapeId;                    /*!< the ID number representing the shape object */
-    std::string shapeType;          /*!< the string representing the shape type */
+    ShapeLabels::eShapes shapeType; /*!< the enumeration value representing the shape type */
     int numDimensions;              /*!< the number of dimensions the shape object has */
-    dim::specs* shapeDimensions;    /*!< the pointer to the dynamic array of shape dimensions */
+    dim::specs* shapeDimensions;    /*!< the pointer to the array of shape dimensions (inlineDimensions or a dynamic array) */
+    dim::specs inlineDimensions[MAX_INLINE_DIMENSIONS]; /*!< the inline buffer holding the shape dimensions of all but large polylines and polygons */
+
+    int penId;          /*!< the ID of the shape's pen in the shared style table */
+    int brushId;        /*!< the ID of the shape's brush in the shared style table */
 
-    QPainter painter;   /*!< the QPainter object holding QPen and QBrush properties */
-    QPen pen;           /*!< the QPen object holding pen properties */
-    QBrush brush;       /*!< the QBrush object holding brush properties */
+private:
+    //! Recomputes the cached metrics if they are out of date; instrumented builds count the lookup as a hit or a miss.
+    void updateMetrics() const;
 
-    QFont font;                     /*!< the QFont object holding font properties */
-    std::string text;               /*!< the string of text displayed by the Text object */
-    Qt::AlignmentFlag alignFlag;    /*!< the alignment setting of the text displayed by the Text object */
+    mutable dim::perimeter cachedPerimeter; /*!< the perimeter computed when the metrics were last updated */
+    mutable dim::area cachedArea;           /*!< the area computed when the metrics were last updated */
+    mutable QRect cachedBoundingBox;        /*!< the bounding box computed when the metrics were last updated */
+    mutable bool metricsValid;              /*!< TRUE while the cached metrics match the shape dimensions */
 
+#ifdef SHAPE_PERF_COUNTERS
+    static std::atomic<long long> metricsCacheHits;     /*!< the number of metric lookups answered from the cache */
+    static std::atomic<long long> metricsCacheMisses;   /*!< the number of metric lookups that recomputed the metrics */
+#endif
 };
 
 #endif /*SHAPE_H_*/
@@ -10,8 +10,6 @@
 using namespace std;
 
 /*! Allows for program-specific error messages to print when an object of type shapeException is caught in a try-throw-catch block.
- * \sa Parser::getShapePtr()
- * \sa Parser::parseShapes()
  * \sa idCompare(Shape* bestShape, Shape* currentShape)
  */
 class shapeException : public exception
@@ -0,0 +1,73 @@
+#include "shapeidmodel.h"
+#include "shape.h"
+#include <algorithm>
+
+void ShapeIdModel::setIds(const myVector::vector<Shape*> &shapes)
+{
+    beginResetModel();
+
+    ids.clear();
+    ids.reserve(shapes.size());
+
+    for(const Shape *shape : shapes)
+    {
+        ids.push_back(shape -> getID());
+    }
+
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    endResetModel();
+}
+
+void ShapeIdModel::insertId(int id)
+{
+    std::vector<int>::iterator position = std::lower_bound(ids.begin(), ids.end(), id);
+
+    if(position != ids.end() && *position == id)
+    {
+        return;
+    }
+
+    int row = int(position - ids.begin());
+
+    beginInsertRows(QModelIndex(), row, row);
+    ids.insert(position, id);
+    endInsertRows();
+}
+
+void ShapeIdModel::removeId(int id)
+{
+    int row = rowOf(id);
+
+    if(row < 0)
+    {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    ids.erase(ids.begin() + row);
+    endRemoveRows();
+}
+
+int ShapeIdModel::rowOf(int id) const
+{
+    std::vector<int>::const_iterator position = std::lower_bound(ids.begin(), ids.end(), id);
+
+    return position != ids.end() && *position == id ? int(position - ids.begin()) : -1;
+}
+
+int ShapeIdModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(ids.size());
+}
+
+QVariant ShapeIdModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= int(ids.size()) || (role != Qt::DisplayRole && role != Qt::EditRole))
+    {
+        return QVariant();
+    }
+
+    return QString::number(ids[index.row()]);
+}
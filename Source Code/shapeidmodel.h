@@ -0,0 +1,68 @@
+/*!
+ * \class   ShapeIdModel
+ * \brief   A list model of every shape ID, shared by the edit and delete selectors and updated one ID at a time.
+*/
+
+#ifndef SHAPEIDMODEL_H
+#define SHAPEIDMODEL_H
+
+#include <QAbstractListModel>
+#include <vector>
+#include "vector.h"
+
+class Shape;
+
+/*! The IDs are kept in ascending order, so an ID is found with a binary search and the type-ahead completer
+ * of each selector lists matching IDs in order. Adding or deleting a shape inserts or removes one row,
+ * which the combo boxes viewing the model pick up without rebuilding their items.
+ * \sa MainWindow::shapesLoaded()
+ * \sa AllShapes::setObserver()
+ */
+class ShapeIdModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+
+    //! Constructor
+    /*! \param parent the owner of the model
+     */
+    explicit ShapeIdModel(QObject *parent = nullptr) : QAbstractListModel(parent) {}
+
+    //! Replaces every ID with the IDs of a shape vector.
+    /*! \param shapes the shapes whose IDs are listed
+     */
+    void setIds(const myVector::vector<Shape*> &shapes);
+
+    //! Adds an ID, keeping the IDs in order.
+    /*! \param id the ID of a new shape; an ID already listed is not added again
+     */
+    void insertId(int id);
+
+    //! Removes an ID.
+    /*! \param id the ID of a deleted shape; nothing happens if it is not listed
+     */
+    void removeId(int id);
+
+    //! Finds the row of an ID.
+    /*! \param id the ID to find
+     * \returns The row, or -1 if the ID is not listed.
+     */
+    int rowOf(int id) const;
+
+    //! Gets the number of IDs.
+    /*! \param parent the parent index; a list has rows only under the invalid index
+     */
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    //! Gets an ID as the text shown in the selectors.
+    /*! \param index the row of the ID
+     * \param role the display or edit role; other roles have no data
+     */
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    std::vector<int> ids;   /*!< every shape ID, in ascending order */
+};
+
+#endif // SHAPEIDMODEL_H
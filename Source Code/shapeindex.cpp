@@ -0,0 +1,189 @@
+#include "shapeindex.h"
+#include "parser.h"
+#include <filesystem>
+#include <fstream>
+
+using sidecar::readValue;
+using sidecar::writeValue;
+
+namespace
+{
+    const std::uint32_t SIDECAR_MAGIC = 0x58444953;    // "SIDX"
+    const std::uint32_t SIDECAR_VERSION = 1;
+}
+
+bool ShapeIndex::open(const std::string &dataFileName)
+{
+    if(load(dataFileName))
+    {
+        return true;
+    }
+
+    if(!build(dataFileName))
+    {
+        return false;
+    }
+
+    save(dataFileName);
+
+    return true;
+}
+
+bool ShapeIndex::load(const std::string &dataFileName)
+{
+    unsigned long long size;
+    long long time;
+
+    if(!readFileStamp(dataFileName, size, time))
+    {
+        return false;
+    }
+
+    std::ifstream in(sidecarName(dataFileName), std::ios::in | std::ios::binary);
+
+    std::uint32_t magic{0};
+    std::uint32_t version{0};
+    std::uint64_t storedSize{0};
+    std::int64_t storedTime{0};
+    std::int32_t count{0};
+
+    if(!readValue(in, magic) || !readValue(in, version) || !readValue(in, storedSize) || !readValue(in, storedTime) || !readValue(in, count)
+       || magic != SIDECAR_MAGIC || version != SIDECAR_VERSION || storedSize != size || storedTime != time || count < 0)
+    {
+        return false;
+    }
+
+    std::vector<ShapeIndexEntry> loaded(count);
+
+    for(ShapeIndexEntry &entry : loaded)
+    {
+        std::int32_t id, type, x, y, w, h;
+        std::int64_t offset, length;
+
+        if(!readValue(in, id) || !readValue(in, type) || !readValue(in, offset) || !readValue(in, length)
+           || !readValue(in, x) || !readValue(in, y) || !readValue(in, w) || !readValue(in, h)
+           || type < 0 || type >= NUM_SHAPES)
+        {
+            return false;
+        }
+
+        entry.shapeId = id;
+        entry.shapeType = ShapeLabels::eShapes(type);
+        entry.offset = offset;
+        entry.length = length;
+        entry.boundingBox = QRect(x, y, w, h);
+    }
+
+    entries.swap(loaded);
+    dataFileSize = size;
+    dataFileTime = time;
+    rebuildLookup();
+
+    return true;
+}
+
+bool ShapeIndex::build(const std::string &dataFileName)
+{
+    unsigned long long size;
+    long long time;
+
+    std::ifstream in(dataFileName, std::ios::in | std::ios::binary);
+
+    if(!in.is_open() || !readFileStamp(dataFileName, size, time))
+    {
+        return false;
+    }
+
+    Parser parser;
+    parser.indexShapes(in, entries);
+
+    dataFileSize = size;
+    dataFileTime = time;
+    rebuildLookup();
+
+    return true;
+}
+
+bool ShapeIndex::save(const std::string &dataFileName) const
+{
+    std::ofstream out(sidecarName(dataFileName), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if(!out.is_open())
+    {
+        return false;
+    }
+
+    writeValue(out, SIDECAR_MAGIC);
+    writeValue(out, SIDECAR_VERSION);
+    writeValue(out, std::uint64_t(dataFileSize));
+    writeValue(out, std::int64_t(dataFileTime));
+    writeValue(out, std::int32_t(entries.size()));
+
+    for(const ShapeIndexEntry &entry : entries)
+    {
+        writeValue(out, std::int32_t(entry.shapeId));
+        writeValue(out, std::int32_t(entry.shapeType));
+        writeValue(out, std::int64_t(entry.offset));
+        writeValue(out, std::int64_t(entry.length));
+        writeValue(out, std::int32_t(entry.boundingBox.x()));
+        writeValue(out, std::int32_t(entry.boundingBox.y()));
+        writeValue(out, std::int32_t(entry.boundingBox.width()));
+        writeValue(out, std::int32_t(entry.boundingBox.height()));
+    }
+
+    return bool(out);
+}
+
+const ShapeIndexEntry *ShapeIndex::find(int shapeId) const
+{
+    std::unordered_map<int, int>::const_iterator it = positionOfId.find(shapeId);
+
+    if(it == positionOfId.end())
+    {
+        return nullptr;
+    }
+
+    return &entries[it -> second];
+}
+
+std::vector<int> ShapeIndex::query(const QRect &region) const
+{
+    std::vector<int> ids;
+
+    for(const ShapeIndexEntry &entry : entries)
+    {
+        if(entry.boundingBox.intersects(region))
+        {
+            ids.push_back(entry.shapeId);
+        }
+    }
+
+    return ids;
+}
+
+bool ShapeIndex::readFileStamp(const std::string &dataFileName, unsigned long long &size, long long &time)
+{
+    std::error_code error;
+
+    size = std::filesystem::file_size(dataFileName, error);
+
+    if(error)
+    {
+        return false;
+    }
+
+    time = (long long)(std::filesystem::last_write_time(dataFileName, error).time_since_epoch().count());
+
+    return !error;
+}
+
+void ShapeIndex::rebuildLookup()
+{
+    positionOfId.clear();
+    positionOfId.reserve(entries.size());
+
+    for(int i = 0; i < int(entries.size()); ++i)
+    {
+        positionOfId[entries[i].shapeId] = i;
+    }
+}
@@ -0,0 +1,131 @@
+/*!
+ * \class   ShapeIndex
+ * \brief   The offset index of a shape file: where each shape's record is stored, its type, and its bounding box.
+*/
+
+#ifndef SHAPEINDEX_H
+#define SHAPEINDEX_H
+
+#include "shape.h"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/*! \namespace sidecar
+ * \brief Reads and writes the fixed size values of sidecar files, in native byte order.
+ * \sa ShapeIndex
+ * \sa PagedShapeFile
+ */
+namespace sidecar
+{
+    //! Writes one value.
+    template<typename T>
+    void writeValue(std::ostream &out, T value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    //! Reads one value.
+    /*! \returns FALSE if the stream ended first.
+     */
+    template<typename T>
+    bool readValue(std::istream &in, T &value)
+    {
+        return bool(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+/*! \struct ShapeIndexEntry
+ * \brief Locates one shape record in a shape file.
+ */
+struct ShapeIndexEntry
+{
+    int shapeId{0};                                     /*!< the ID of the shape */
+    ShapeLabels::eShapes shapeType{ShapeLabels::LINE};  /*!< the type of the shape */
+    long long offset{0};                                /*!< the byte position of the record's ShapeId line */
+    long long length{0};                                /*!< the number of bytes up to the next record */
+    QRect boundingBox;                                  /*!< the bounding box of the shape */
+};
+
+/*! The index is kept in a sidecar file next to the shape file (the shape file name followed by ".idx").
+ * The sidecar records the size and modification time of the shape file it was built from;
+ * load() rejects a sidecar that does not match, and open() then rebuilds it with Parser::indexShapes() and saves it again.
+ * The sidecar is a cache in native byte order, not an exchange format.
+ * \sa LazyShapeStore
+ */
+class ShapeIndex
+{
+public:
+
+    //! Default constructor
+    ShapeIndex() : dataFileSize{0}, dataFileTime{0} {}
+
+    //! Loads the index of a shape file from its sidecar, or builds it by scanning the shape file.
+    /*! A rebuilt index is saved to the sidecar so the next open is fast.
+     * \param dataFileName the path of the shape file
+     * \returns FALSE if the shape file cannot be read.
+     */
+    bool open(const std::string &dataFileName);
+
+    //! Reads the sidecar of a shape file.
+    /*! \param dataFileName the path of the shape file
+     * \returns FALSE if the sidecar is missing, damaged, or was built from a different version of the shape file.
+     */
+    bool load(const std::string &dataFileName);
+
+    //! Scans a shape file and builds its index.
+    /*! \param dataFileName the path of the shape file
+     * \returns FALSE if the shape file cannot be read.
+     * \sa Parser::indexShapes()
+     */
+    bool build(const std::string &dataFileName);
+
+    //! Writes the sidecar of the shape file the index was built from.
+    /*! \param dataFileName the path of the shape file
+     * \returns FALSE if the sidecar cannot be written.
+     */
+    bool save(const std::string &dataFileName) const;
+
+    //! Gets the path of the sidecar of a shape file.
+    static std::string sidecarName(const std::string &dataFileName) {return dataFileName + ".idx";}
+
+    //! Gets the number of indexed shapes.
+    int size() const {return int(entries.size());}
+
+    //! Gets an entry by position, in file order.
+    const ShapeIndexEntry &at(int position) const {return entries[position];}
+
+    //! Finds the entry of a shape.
+    /*! \param shapeId the ID of the shape
+     * \returns The entry, or nullptr if no shape has the ID.
+     */
+    const ShapeIndexEntry *find(int shapeId) const;
+
+    //! Finds the shapes whose bounding boxes intersect a region, without loading any shape.
+    /*! \param region the region in canvas coordinates
+     * \returns The IDs of the shapes, in file order.
+     */
+    std::vector<int> query(const QRect &region) const;
+
+    //! Reads the size and modification time of a shape file.
+    /*! Sidecar files store these to detect that the shape file changed after they were written.
+     * \returns FALSE if the file does not exist.
+     * \sa PagedShapeFile::open()
+     */
+    static bool readFileStamp(const std::string &dataFileName, unsigned long long &size, long long &time);
+
+private:
+
+    //! Rebuilds the map from shape ID to entry position.
+    void rebuildLookup();
+
+    std::vector<ShapeIndexEntry> entries;       /*!< one entry per shape record, in file order */
+    std::unordered_map<int, int> positionOfId;  /*!< the position in entries of each shape ID */
+    unsigned long long dataFileSize;            /*!< the size of the shape file the index was built from */
+    long long dataFileTime;                     /*!< the modification time of the shape file the index was built from */
+};
+
+#endif // SHAPEINDEX_H
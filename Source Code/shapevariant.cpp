@@ -0,0 +1,62 @@
+#include "shapevariant.h"
+#include "shapeexception.h"
+
+//! Converts a Shape pointer to the variant of its derived type.
+ShapeVariant toVariant(Shape *p_Shape)
+{
+    using namespace ShapeLabels;
+
+    switch(p_Shape -> getShapeType())
+    {
+    case LINE:      return static_cast<Line*>(p_Shape);
+    case POLYLINE:  return static_cast<Polyline*>(p_Shape);
+    case POLYGON:   return static_cast<Polygon*>(p_Shape);
+    case RECTANGLE: return static_cast<Rectangle*>(p_Shape);
+    case SQUARE:    return static_cast<Square*>(p_Shape);
+    case ELLIPSE:   return static_cast<Ellipse*>(p_Shape);
+    case CIRCLE:    return static_cast<Circle*>(p_Shape);
+    case TEXT:      return static_cast<Text*>(p_Shape);
+    }
+
+    throw shapeException("\n***ERROR - SHAPE HAS AN UNKNOWN SHAPE TYPE***\n\n");
+}
+
+//! Gets the bytes of a shape and the heap data it owns.
+std::size_t footprintBytes(Shape *p_Shape)
+{
+    return std::visit([](auto *p_Derived){return sizeof(*p_Derived) + p_Derived -> getHeapBytes();}, toVariant(p_Shape));
+}
+
+//! Refills the ordered list and the per type batches.
+void ShapeBatches::rebuild(const myVector::vector<Shape*> &shapes)
+{
+    ordered.clear();
+    ordered.reserve(shapes.size());
+
+    std::apply([](auto &... batch){(batch.clear(), ...);}, batches);
+
+    for(int i = 0; i < shapes.size(); ++i)
+    {
+        ShapeVariant shape = toVariant(shapes[i]);
+
+        ordered.push_back(shape);
+        std::visit([this](auto *p_Shape){std::get<std::vector<std::remove_pointer_t<decltype(p_Shape)>*>>(batches).push_back(p_Shape);}, shape);
+    }
+}
+
+//! Gets the bytes held by the ordered list and the batches.
+std::size_t ShapeBatches::memoryBytes() const
+{
+    std::size_t bytes = ordered.capacity() * sizeof(ShapeVariant);
+
+    std::apply([&bytes](const auto &... batch){((bytes += batch.capacity() * sizeof(batch[0])), ...);}, batches);
+
+    return bytes;
+}
+
+//! Empties the ordered list and the batches and returns their memory.
+void ShapeBatches::release()
+{
+    std::vector<ShapeVariant>().swap(ordered);
+    std::apply([](auto &... batch){(std::remove_reference_t<decltype(batch)>().swap(batch), ...);}, batches);
+}
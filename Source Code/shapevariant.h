@@ -0,0 +1,123 @@
+/*!
+ * \file    shapevariant.h
+ * \brief   A closed set representation of the eight shape types for statically dispatched loops.
+ * \brief   Used by loops that touch every shape, such as painting and printing; the UI keeps using Shape pointers.
+*/
+
+#ifndef SHAPEVARIANT_H
+#define SHAPEVARIANT_H
+
+#include "shape_list.h"
+#include "vector.h"
+#include <variant>
+#include <tuple>
+#include <vector>
+
+/*! \typedef ShapeVariant
+ * a non-owning reference to a shape, holding a pointer of its exact derived type.
+ * All eight derived classes are final, so calls made through these pointers are resolved at compile time and can be inlined. */
+typedef std::variant<Line*, Polyline*, Polygon*, Rectangle*, Square*, Ellipse*, Circle*, Text*> ShapeVariant;
+
+//! Converts a Shape pointer to a ShapeVariant holding a pointer of its exact derived type.
+/*! \param p_Shape the pointer to a shape
+ * \returns The variant referring to the same shape.
+ */
+ShapeVariant toVariant(Shape *p_Shape);
+
+//! Gets the bytes a shape occupies.
+/*! \param p_Shape the pointer to a shape
+ * \returns sizeof() the exact derived type plus the heap data the shape owns, such as spilled dimensions, points, and text.
+ * \sa Shape::getHeapBytes()
+ */
+std::size_t footprintBytes(Shape *p_Shape);
+
+/*! Holds every shape of a shape vector twice: once in the order of the vector, and once grouped into one batch per shape type.
+ * The ordered list is used where order matters (painting, printing); the batches let a loop run over shapes of a single type.
+ * The shapes are not owned; the object must be rebuilt when shapes are added to or removed from the source vector, or when it is reordered.
+ * \sa AllShapes::getBatches()
+ * \sa canvas::paintEvent()
+ */
+class ShapeBatches
+{
+public:
+
+    //! Default constructor
+    ShapeBatches() {}
+
+    //! Refills the ordered list and the batches from a shape vector.
+    /*! \param shapes the vector of Shape pointers
+     */
+    void rebuild(const myVector::vector<Shape*> &shapes);
+
+    //! Gets the number of shapes.
+    int size() const {return int(ordered.size());}
+
+    //! Gets the number of bytes allocated for the ordered list and the batches.
+    std::size_t memoryBytes() const;
+
+    //! Empties the ordered list and the batches and frees their memory.
+    /*! The object holds no shapes afterwards and must be rebuilt before it is used again.
+     */
+    void release();
+
+    //! Calls a function on every shape, in the order of the source vector.
+    /*! \param function called with a reference of the exact derived type of each shape
+     */
+    template<typename Function>
+    void forEachInOrder(Function function) const
+    {
+        for(const ShapeVariant &shape : ordered)
+        {
+            std::visit([&function](auto *p_Shape){function(*p_Shape);}, shape);
+        }
+    }
+
+    //! Calls a function on a contiguous range of shapes, in the order of the source vector.
+    /*! \param first the position of the first shape in the range
+     * \param last the position one past the last shape in the range
+     * \param function called with a reference of the exact derived type of each shape and its position
+     * \sa ParallelSaver
+     */
+    template<typename Function>
+    void forEachInRange(int first, int last, Function function) const
+    {
+        for(int i = first; i < last; ++i)
+        {
+            std::visit([&function, i](auto *p_Shape){function(*p_Shape, i);}, ordered[i]);
+        }
+    }
+
+    //! Calls a function on every shape, one shape type at a time.
+    /*! \param function called with a reference of the exact derived type of each shape
+     */
+    template<typename Function>
+    void forEachByType(Function function) const
+    {
+        std::apply([&function](const auto &... batch){(forEachIn(batch, function), ...);}, batches);
+    }
+
+    //! Gets the batch of one shape type.
+    /*! \returns The pointers to every shape of type T, in the order of the source vector.
+     */
+    template<typename T>
+    const std::vector<T*> &getBatch() const {return std::get<std::vector<T*>>(batches);}
+
+private:
+
+    //! Calls a function on every shape of one batch.
+    template<typename T, typename Function>
+    static void forEachIn(const std::vector<T*> &batch, Function &function)
+    {
+        for(T *p_Shape : batch)
+        {
+            function(*p_Shape);
+        }
+    }
+
+    std::vector<ShapeVariant> ordered;  /*!< every shape, in the order of the source vector */
+
+    std::tuple<std::vector<Line*>, std::vector<Polyline*>, std::vector<Polygon*>, std::vector<Rectangle*>,
+               std::vector<Square*>, std::vector<Ellipse*>, std::vector<Circle*>, std::vector<Text*>> batches;  /*!< one batch per shape type */
+};
+
+#endif // SHAPEVARIANT_H
@@ -0,0 +1,130 @@
+#include "shapewriter.h"
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+//! Allocates the writer's own buffer.
+ShapeWriter::ShapeWriter(std::ostream &out, std::size_t capacity)
+    : out{&out}, ownBuffer(std::max(capacity, MIN_CAPACITY)), buffer{ownBuffer}, used{0}, bytesFlushed{0}, flushCount{0}
+{}
+
+//! Grows the caller's buffer to the requested capacity.
+ShapeWriter::ShapeWriter(std::ostream &out, std::vector<char> &buffer, std::size_t capacity)
+    : out{&out}, buffer{buffer}, used{0}, bytesFlushed{0}, flushCount{0}
+{
+    capacity = std::max(capacity, MIN_CAPACITY);
+
+    if(buffer.size() < capacity)
+    {
+        buffer.resize(capacity);
+    }
+}
+
+//! Keeps whatever capacity the caller's buffer already has.
+ShapeWriter::ShapeWriter(std::vector<char> &buffer)
+    : out{nullptr}, buffer{buffer}, used{0}, bytesFlushed{0}, flushCount{0}
+{
+    if(buffer.size() < MIN_CAPACITY)
+    {
+        buffer.resize(MIN_CAPACITY);
+    }
+}
+
+ShapeWriter::~ShapeWriter()
+{
+    flush();
+}
+
+void ShapeWriter::write(std::string_view text)
+{
+    if(reserve(text.size()))
+    {
+        std::memcpy(buffer.data() + used, text.data(), text.size());
+        used += text.size();
+    }
+    else
+    {
+        out -> write(text.data(), std::streamsize(text.size()));
+        bytesFlushed += (long long)(text.size());
+        ++flushCount;
+    }
+}
+
+void ShapeWriter::write(char character)
+{
+    reserve(1);
+    buffer[used++] = character;
+}
+
+void ShapeWriter::write(int value)
+{
+    const std::size_t MAX_DIGITS = std::numeric_limits<int>::digits10 + 2;   // digits, the extra digit, and the sign
+
+    reserve(MAX_DIGITS);
+
+    char *end = std::to_chars(buffer.data() + used, buffer.data() + used + MAX_DIGITS, value).ptr;
+    used = std::size_t(end - buffer.data());
+}
+
+void ShapeWriter::writeField(std::string_view label, std::string_view value)
+{
+    write(label);
+    write(value);
+    newline();
+}
+
+void ShapeWriter::writeField(std::string_view label, int value)
+{
+    write(label);
+    write(value);
+    newline();
+}
+
+void ShapeWriter::writeList(std::string_view label, const int *values, int count)
+{
+    write(label);
+
+    for(int i = 0; i < count; ++i)
+    {
+        write(values[i]);
+
+        if(i < count - 1)
+        {
+            write(ShapeFields::LIST_SEPARATOR);
+        }
+    }
+
+    newline();
+}
+
+void ShapeWriter::flush()
+{
+    if(out != nullptr && used > 0)
+    {
+        out -> write(buffer.data(), std::streamsize(used));
+        bytesFlushed += (long long)(used);
+        used = 0;
+        ++flushCount;
+    }
+}
+
+/*! A collecting writer doubles its buffer. A flushing writer does not copy text larger than the whole buffer;
+ * the buffer is flushed and the caller writes the text straight to the stream. */
+bool ShapeWriter::reserve(std::size_t size)
+{
+    if(used + size <= buffer.size())
+    {
+        return true;
+    }
+
+    if(out == nullptr)
+    {
+        buffer.resize(std::max(buffer.size() * 2, used + size));
+        return true;
+    }
+
+    flush();
+
+    return size <= buffer.size();
+}
@@ -0,0 +1,154 @@
+/*!
+ * \class   ShapeWriter
+ * \brief   Writes shapes in the input file format into a large reusable buffer and flushes it to a stream in big blocks.
+*/
+
+#ifndef SHAPEWRITER_H
+#define SHAPEWRITER_H
+
+#include <ostream>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+/*! \namespace ShapeFields
+ * \brief Holds the field labels of the shape input file, including the separator after each label.
+ * \sa Shape::serialize()
+ */
+namespace ShapeFields
+{
+    constexpr std::string_view SHAPE_ID          = "ShapeId: ";
+    constexpr std::string_view SHAPE_TYPE        = "ShapeType: ";
+    constexpr std::string_view SHAPE_DIMENSIONS  = "ShapeDimensions: ";
+    constexpr std::string_view PEN_COLOR         = "PenColor: ";
+    constexpr std::string_view PEN_WIDTH         = "PenWidth: ";
+    constexpr std::string_view PEN_STYLE         = "PenStyle: ";
+    constexpr std::string_view PEN_CAP_STYLE     = "PenCapStyle: ";
+    constexpr std::string_view PEN_JOIN_STYLE    = "PenJoinStyle: ";
+    constexpr std::string_view BRUSH_COLOR       = "BrushColor: ";
+    constexpr std::string_view BRUSH_STYLE       = "BrushStyle: ";
+    constexpr std::string_view TEXT_STRING       = "TextString: ";
+    constexpr std::string_view TEXT_COLOR        = "TextColor: ";
+    constexpr std::string_view TEXT_ALIGNMENT    = "TextAlignment: ";
+    constexpr std::string_view TEXT_POINT_SIZE   = "TextPointSize: ";
+    constexpr std::string_view TEXT_FONT_FAMILY  = "TextFontFamily: ";
+    constexpr std::string_view TEXT_FONT_STYLE   = "TextFontStyle: ";
+    constexpr std::string_view TEXT_FONT_WEIGHT  = "TextFontWeight: ";
+    constexpr std::string_view LIST_SEPARATOR    = ", ";
+}
+
+/*! Text is appended to a buffer that is allocated once; numbers are formatted in place with std::to_chars.
+ * The buffer is only handed to the stream when it is full or when flush() is called, so a save issues a few large writes
+ * instead of one small write (and one stream flush, with std::endl) per line.
+ * Nothing is allocated per shape or per line.
+ * \sa AllShapes::printAll()
+ * \sa Shape::serialize()
+ */
+class ShapeWriter
+{
+public:
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 20;   /*!< The buffer size used when none is given: 1 MiB */
+    static constexpr std::size_t MIN_CAPACITY = 64;             /*!< The smallest buffer size; large enough for any formatted integer */
+
+    //! Constructor
+    /*! Writes through a buffer owned by the writer.
+     * \param out the stream that receives the flushed blocks
+     * \param capacity the size of the buffer in bytes
+     */
+    explicit ShapeWriter(std::ostream &out, std::size_t capacity = DEFAULT_CAPACITY);
+
+    //! Constructor
+    /*! Writes through a buffer owned by the caller, so the same memory can be reused across saves.
+     * The buffer is grown to the passed in capacity if it is smaller; its contents are overwritten.
+     * \param out the stream that receives the flushed blocks
+     * \param buffer the buffer to write through
+     * \param capacity the minimum size of the buffer in bytes
+     */
+    ShapeWriter(std::ostream &out, std::vector<char> &buffer, std::size_t capacity = DEFAULT_CAPACITY);
+
+    //! Constructor
+    /*! Collects the text in a buffer owned by the caller instead of writing it to a stream.
+     * The buffer grows as needed and is never flushed; the first getBytesWritten() bytes hold the text.
+     * Used to format several parts of a document at the same time.
+     * \param buffer the buffer to collect the text in; its contents are overwritten
+     * \sa ParallelSaver
+     */
+    explicit ShapeWriter(std::vector<char> &buffer);
+
+    //! Destructor
+    /*! Flushes any buffered text to the stream, if there is one.
+     */
+    ~ShapeWriter();
+
+    //! Removes functionality of a copy constructor.
+    ShapeWriter(const ShapeWriter &otherWriter) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    ShapeWriter& operator=(const ShapeWriter &otherWriter) = delete;
+
+    //! Appends text.
+    /*! \param text the text to be written
+     */
+    void write(std::string_view text);
+
+    //! Appends a single character.
+    /*! \param character the character to be written
+     */
+    void write(char character);
+
+    //! Appends an integer in decimal.
+    /*! \param value the integer to be written
+     */
+    void write(int value);
+
+    //! Appends a line break.
+    void newline() {write('\n');}
+
+    //! Appends one "Label: value" line.
+    /*! \param label the field label, including its separator
+     * \param value the text of the field
+     */
+    void writeField(std::string_view label, std::string_view value);
+
+    //! Appends one "Label: value" line.
+    /*! \param label the field label, including its separator
+     * \param value the integer value of the field
+     */
+    void writeField(std::string_view label, int value);
+
+    //! Appends one "Label: a, b, c" line.
+    /*! \param label the field label, including its separator
+     * \param values the array of integers
+     * \param count the number of integers
+     */
+    void writeList(std::string_view label, const int *values, int count);
+
+    //! Hands all buffered text to the stream in one write.
+    /*! Does nothing when the writer collects into a buffer.
+     */
+    void flush();
+
+    //! Gets the number of bytes written so far, including those still buffered.
+    long long getBytesWritten() const {return bytesFlushed + (long long)(used);}
+
+    //! Gets the number of blocks handed to the stream so far.
+    int getFlushCount() const {return flushCount;}
+
+private:
+
+    //! Makes room for the passed in number of bytes, flushing or growing the buffer if needed.
+    /*! \param size the number of bytes about to be appended
+     * \returns TRUE if the bytes fit in the buffer; FALSE if they are larger than the whole buffer of a flushing writer
+     */
+    bool reserve(std::size_t size);
+
+    std::ostream *out;              /*!< the stream that receives the flushed blocks, or nullptr when collecting into the buffer */
+    std::vector<char> ownBuffer;    /*!< the buffer used when the caller does not pass one in */
+    std::vector<char> &buffer;      /*!< the buffer text is appended to */
+    std::size_t used;               /*!< the number of bytes in the buffer waiting to be flushed */
+    long long bytesFlushed;         /*!< the number of bytes already handed to the stream */
+    int flushCount;                 /*!< the number of blocks already handed to the stream */
+};
+
+#endif // SHAPEWRITER_H
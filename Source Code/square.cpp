@@ -1,13 +1,13 @@
 #include "square.h"
 
 //! Sets the QPainter object to draw a square according to the Square object's specifications.
-void Square::draw()
+void Square::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setBrush(brush);
+    painter.setPen(getPen());
+    painter.setBrush(getBrush());
     painter.drawRect(position.x(), position.y(), shapeDimensions[int(Specifications::L)], shapeDimensions[int(Specifications::L)]);
     painter.setPen(Qt::black);
-    painter.drawText(position.x() - 20, position.y() - 20, 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the square.
@@ -15,6 +15,7 @@ void Square::move(const QPoint &shift)
 {
     position += shift;
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Sets the position of the square.
@@ -16,27 +16,26 @@ const int NUM_SQUARE_SPECS = 3;
 
 /*! Derived from abstract base class Shape.
  */
-class Square: public Shape
+class Square final : public Shape
 {
 public:
     //! Default constructor
     /*! Sets the position of the top left of the square to a default location
      */
-    Square() : position{0,0} {}
+    Square() : Shape(ShapeLabels::SQUARE), position{0,0} {}
 
     //! Alternate constructor
     /*! Passes in all square data to be implemented upon construction.
      * Initializes the square and base class data via a base member initialization list.
      * Sets the QPoint value of the top left of the square
-     * \sa MainWindow::on_squareSave_clicked()
+     * \sa MainWindow::squareSaveClicked()
      * \sa Square::setPosition()
      * \param shapeId the ID number of the new square
-     * \param shapeType the string representing a square
      * \param numDimensions the number of dimensions a square has
      * \param *shapeDimensions the pointer to the array of square dimensions
      */
-    Square(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions)
-          :Shape(shapeId, shapeType, numDimensions, shapeDimensions)
+    Square(int shapeId, int numDimensions, dim::specs* shapeDimensions)
+          :Shape(shapeId, ShapeLabels::SQUARE, numDimensions, shapeDimensions)
           {setPosition();}
 
     //! Destructor
@@ -46,8 +45,9 @@ public:
 
     //! Draws the square according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a square.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the square by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a square.
@@ -68,6 +68,20 @@ public:
     dim::area calcArea() const override {return multiply(*(shapeDimensions + int(Specifications::L)),
                                                          *(shapeDimensions + int(Specifications::L)));}
 
+    //! Finds the bounding box of the square.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: the square is drawn as a rectangle with the side length as its width and height.
+     */
+    QRect calcBoundingBox() const override {return QRect(shapeDimensions[int(Specifications::X1)], shapeDimensions[int(Specifications::Y1)],
+                                                         shapeDimensions[int(Specifications::L)], shapeDimensions[int(Specifications::L)]);}
+
+    //! Finds the ID label of the square.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: the label sits diagonally above and to the left of the top left corner.
+     */
+    QRect calcLabelRect() const override {return QRect(shapeDimensions[int(Specifications::X1)] - LABEL_SIZE, shapeDimensions[int(Specifications::Y1)] - LABEL_SIZE,
+                                                       LABEL_SIZE, LABEL_SIZE);}
+
     //! Sets the QPoint data member to the position of the top left corner of the square.
     /*! Overrides the pure virtual function from the base class to set the position of a square.
      */
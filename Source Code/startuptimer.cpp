@@ -0,0 +1,89 @@
+#include "startuptimer.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+    //! Converts a duration to milliseconds.
+    double toMilliseconds(StartupTimer::clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+}
+
+void StartupTimer::record(const std::string &name, const std::string &thread, clock::time_point start)
+{
+    StartupPhase phase;
+
+    phase.name = name;
+    phase.thread = thread;
+    phase.startMilliseconds = toMilliseconds(start - origin);
+    phase.milliseconds = toMilliseconds(clock::now() - start);
+    phase.residentKilobytes = residentKilobytes();
+
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    phases.push_back(phase);
+}
+
+long StartupTimer::residentKilobytes()
+{
+    std::ifstream status("/proc/self/status");
+    std::string field;
+
+    /*! The line reads "VmRSS:    12345 kB" */
+    while(status >> field)
+    {
+        if(field == "VmRSS:")
+        {
+            long kilobytes = 0;
+
+            status >> kilobytes;
+            return kilobytes;
+        }
+    }
+
+    return 0;
+}
+
+double StartupTimer::elapsedMilliseconds() const
+{
+    return toMilliseconds(clock::now() - origin);
+}
+
+std::vector<StartupPhase> StartupTimer::getPhases() const
+{
+    std::vector<StartupPhase> sorted;
+
+    {
+        std::lock_guard<std::mutex> lock(phasesMutex);
+        sorted = phases;
+    }
+
+    std::stable_sort(sorted.begin(), sorted.end(), [](const StartupPhase &a, const StartupPhase &b)
+    {
+        return a.startMilliseconds < b.startMilliseconds;
+    });
+
+    return sorted;
+}
+
+std::string StartupTimer::toString() const
+{
+    std::ostringstream report;
+
+    report << "Start up phases:" << '\n';
+    report << std::left << std::setw(32) << "phase" << std::setw(10) << "thread"
+           << std::right << std::setw(12) << "start ms" << std::setw(12) << "ms" << std::setw(12) << "RSS kB" << '\n';
+
+    for(const StartupPhase &phase : getPhases())
+    {
+        report << std::left << std::setw(32) << phase.name << std::setw(10) << phase.thread
+               << std::right << std::fixed << std::setprecision(2)
+               << std::setw(12) << phase.startMilliseconds << std::setw(12) << phase.milliseconds
+               << std::setw(12) << phase.residentKilobytes << '\n';
+    }
+
+    return report.str();
+}
@@ -0,0 +1,101 @@
+/*!
+ * \file    startuptimer.h
+ * \brief   Records how long each phase of the application's start up took, on which thread, and the memory in use after it.
+*/
+
+#ifndef STARTUPTIMER_H
+#define STARTUPTIMER_H
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*! \struct StartupPhase
+ * \brief One timed phase of the start up.
+ */
+struct StartupPhase
+{
+    std::string name;               /*!< what the phase did */
+    std::string thread;             /*!< the thread the phase ran on */
+    double startMilliseconds{0.0};  /*!< when the phase began, from the construction of the timer */
+    double milliseconds{0.0};       /*!< how long the phase took */
+    long residentKilobytes{0};      /*!< the resident memory of the process when the phase ended, or 0 if the system does not report it */
+};
+
+/*! The timer starts when it is constructed. Phases may be recorded from any thread, in any order;
+ * the report lists them by start time, so phases that overlapped on the GUI and loader threads show as such.
+ * \sa MainWindow::MainWindow()
+ */
+class StartupTimer
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /*! \class Phase
+     * \brief Records the time from its construction to its destruction as a phase of a StartupTimer.
+     */
+    class Phase
+    {
+    public:
+
+        //! Constructor
+        /*! \param timer the timer the phase is recorded in
+         * \param name what the phase does
+         * \param thread the thread the phase runs on
+         */
+        Phase(StartupTimer &timer, const char *name, const char *thread) : timer(timer), name{name}, thread{thread}, start{clock::now()} {}
+
+        //! Destructor
+        /*! Records the phase.
+         */
+        ~Phase() {timer.record(name, thread, start);}
+
+        //! Removes functionality of a copy constructor.
+        Phase(const Phase &otherPhase) = delete;
+
+        //! Removes functionality of a copy assignment operator.
+        Phase& operator=(const Phase &otherPhase) = delete;
+
+    private:
+        StartupTimer &timer;        /*!< the timer the phase is recorded in */
+        const char *name;           /*!< what the phase does */
+        const char *thread;         /*!< the thread the phase runs on */
+        clock::time_point start;    /*!< when the phase began */
+    };
+
+    //! Default constructor
+    /*! Starts the timer.
+     */
+    StartupTimer() : origin{clock::now()} {}
+
+    //! Records a phase that began at a given time and ends now.
+    /*! \param name what the phase did
+     * \param thread the thread the phase ran on
+     * \param start when the phase began
+     */
+    void record(const std::string &name, const std::string &thread, clock::time_point start);
+
+    //! Gets the resident memory of the process, read from /proc/self/status.
+    /*! \returns The resident set size in kB, or 0 where /proc is not available.
+     */
+    static long residentKilobytes();
+
+    //! Gets the time since the timer started, in milliseconds.
+    double elapsedMilliseconds() const;
+
+    //! Gets every phase recorded so far, ordered by start time.
+    std::vector<StartupPhase> getPhases() const;
+
+    //! Formats the phases as a table.
+    /*! \returns The report as a multi-line string.
+     */
+    std::string toString() const;
+
+private:
+    clock::time_point origin;           /*!< when the timer started */
+    mutable std::mutex phasesMutex;     /*!< guards the phases, which the loader thread records into */
+    std::vector<StartupPhase> phases;   /*!< the phases, in the order they ended */
+};
+
+#endif // STARTUPTIMER_H
@@ -0,0 +1,116 @@
+#include "styletable.h"
+#include "memoryreport.h"
+
+namespace
+{
+    //! Gets the heap bytes of a string, which are 0 while the string holds its characters inside itself.
+    std::size_t stringHeapBytes(const std::string &text)
+    {
+        const char *object = reinterpret_cast<const char*>(&text);
+        bool inlineText = text.data() >= object && text.data() < object + sizeof(text);
+
+        return inlineText ? 0 : text.capacity() + 1;
+    }
+}
+
+//! Gets the shared style table.
+StyleTable &StyleTable::shared()
+{
+    static StyleTable table;
+
+    return table;
+}
+
+//! Constructor
+StyleTable::StyleTable()
+{
+    internPen(QPen());
+    internBrush(QBrush());
+    internFont(QFont());
+}
+
+//! Finds a pen in the table, adding it if it is not there yet.
+int StyleTable::internPen(const QPen &pen)
+{
+    PenKey key{pen.color().rgba(), pen.width(), int(pen.style()), int(pen.capStyle()), int(pen.joinStyle())};
+
+    std::map<PenKey, int>::const_iterator it = penIds.find(key);
+
+    if(it != penIds.end())
+    {
+        return it -> second;
+    }
+
+    int id = int(pens.size());
+
+    pens.push_back(pen);
+    penIds.emplace(key, id);
+
+    return id;
+}
+
+//! Finds a brush in the table, adding it if it is not there yet.
+int StyleTable::internBrush(const QBrush &brush)
+{
+    BrushKey key{brush.color().rgba(), int(brush.style())};
+
+    std::map<BrushKey, int>::const_iterator it = brushIds.find(key);
+
+    if(it != brushIds.end())
+    {
+        return it -> second;
+    }
+
+    int id = int(brushes.size());
+
+    brushes.push_back(brush);
+    brushIds.emplace(key, id);
+
+    return id;
+}
+
+//! Finds a font in the table, adding it if it is not there yet.
+int StyleTable::internFont(const QFont &font)
+{
+    FontKey key{font.family().toStdString(), font.pointSize(), int(font.style()), font.weight()};
+
+    std::map<FontKey, int>::const_iterator it = fontIds.find(key);
+
+    if(it != fontIds.end())
+    {
+        return it -> second;
+    }
+
+    int id = int(fonts.size());
+
+    fonts.push_back(font);
+    fontFamilies.push_back(std::get<0>(key));
+    fontIds.emplace(key, id);
+
+    return id;
+}
+
+//! Gets the bytes of the pens and the pen map.
+std::size_t StyleTable::getPenBytes() const
+{
+    return pens.size() * sizeof(QPen) + treeBytes(penIds);
+}
+
+//! Gets the bytes of the brushes and the brush map.
+std::size_t StyleTable::getBrushBytes() const
+{
+    return brushes.size() * sizeof(QBrush) + treeBytes(brushIds);
+}
+
+//! Gets the bytes of the fonts, their family names, and the font map, whose keys hold the family names again.
+std::size_t StyleTable::getFontBytes() const
+{
+    std::size_t bytes = fonts.size() * sizeof(QFont) + treeBytes(fontIds);
+
+    for(const std::string &family : fontFamilies)
+    {
+        bytes += sizeof(std::string) + 2 * stringHeapBytes(family);
+    }
+
+    return bytes;
+}
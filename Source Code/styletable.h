@@ -0,0 +1,135 @@
+/*!
+ * \class   StyleTable
+ * \brief   The class managing the shared table of pens, brushes, and fonts used by all shapes.
+*/
+
+#ifndef STYLETABLE_H
+#define STYLETABLE_H
+
+#include <QPen>
+#include <QBrush>
+#include <QFont>
+#include <deque>
+#include <map>
+#include <tuple>
+#include <string>
+
+/*! Shapes do not store their own QPen, QBrush, or QFont. They store the ID of an interned style instead,
+ * and every shape drawn with the same pen (or brush, or font) refers to the same entry of this table.
+ * ID 0 of every kind is the default constructed Qt object, so a shape without explicit styles uses the Qt defaults.
+ * Entries are never removed; a document only ever uses a handful of distinct styles.
+ * Entries are held in std::deque containers, so references returned by the get functions stay valid when new styles are interned.
+ * \sa Shape::setPen()
+ * \sa Shape::setBrush()
+ * \sa Text::setFont()
+ */
+class StyleTable
+{
+public:
+
+    //! Gets the style table shared by every shape in the application.
+    /*! \returns The shared style table by reference.
+     */
+    static StyleTable &shared();
+
+    //! Finds or adds a pen.
+    /*! \param pen the pen to be interned
+     * \returns The ID of the equal pen in the table.
+     */
+    int internPen(const QPen &pen);
+
+    //! Finds or adds a brush.
+    /*! \param brush the brush to be interned
+     * \returns The ID of the equal brush in the table.
+     */
+    int internBrush(const QBrush &brush);
+
+    //! Finds or adds a font.
+    /*! \param font the font to be interned
+     * \returns The ID of the equal font in the table.
+     */
+    int internFont(const QFont &font);
+
+    //! Gets an interned pen.
+    /*! Inline function: returns the pen stored under the passed in ID.
+     * \param id the pen ID
+     * \returns The pen by constant reference.
+     */
+    const QPen &getPen(int id) const {return pens[id];}
+
+    //! Gets an interned brush.
+    /*! Inline function: returns the brush stored under the passed in ID.
+     * \param id the brush ID
+     * \returns The brush by constant reference.
+     */
+    const QBrush &getBrush(int id) const {return brushes[id];}
+
+    //! Gets an interned font.
+    /*! Inline function: returns the font stored under the passed in ID.
+     * \param id the font ID
+     * \returns The font by constant reference.
+     */
+    const QFont &getFont(int id) const {return fonts[id];}
+
+    //! Gets the family name of an interned font.
+    /*! Inline function: the name is converted from a QString once, when the font is interned, so saving does not convert it per shape.
+     * \param id the font ID
+     * \returns The font family by constant reference.
+     * \sa Text::serialize()
+     */
+    const std::string &getFontFamily(int id) const {return fontFamilies[id];}
+
+    //! Gets the number of distinct pens in the table.
+    int getPenCount() const {return int(pens.size());}
+
+    //! Gets the number of distinct brushes in the table.
+    int getBrushCount() const {return int(brushes.size());}
+
+    //! Gets the number of distinct fonts in the table.
+    int getFontCount() const {return int(fonts.size());}
+
+    //! Gets the number of bytes used by the pens and their lookup map.
+    std::size_t getPenBytes() const;
+
+    //! Gets the number of bytes used by the brushes and their lookup map.
+    std::size_t getBrushBytes() const;
+
+    //! Gets the number of bytes used by the fonts, their family names, and their lookup map.
+    std::size_t getFontBytes() const;
+
+private:
+
+    //! Constructor
+    /*! Interns the default pen, brush, and font as ID 0.
+     */
+    StyleTable();
+
+    //! Removes functionality of a copy constructor.
+    StyleTable(const StyleTable &otherTable) = delete;
+
+    //! Removes functionality of a copy assignment operator.
+    StyleTable& operator=(const StyleTable &otherTable) = delete;
+
+    /*! \typedef PenKey
+     * the values that make two pens equal: color, width, style, cap style, join style */
+    typedef std::tuple<QRgb, int, int, int, int> PenKey;
+
+    /*! \typedef BrushKey
+     * the values that make two brushes equal: color, style */
+    typedef std::tuple<QRgb, int> BrushKey;
+
+    /*! \typedef FontKey
+     * the values that make two fonts equal: family, point size, style, weight */
+    typedef std::tuple<std::string, int, int, int> FontKey;
+
+    std::deque<QPen> pens;          /*!< the interned pens, indexed by pen ID */
+    std::deque<QBrush> brushes;     /*!< the interned brushes, indexed by brush ID */
+    std::deque<QFont> fonts;        /*!< the interned fonts, indexed by font ID */
+    std::deque<std::string> fontFamilies;   /*!< the family name of each interned font, indexed by font ID */
+
+    std::map<PenKey, int> penIds;       /*!< the pen ID of each distinct pen */
+    std::map<BrushKey, int> brushIds;   /*!< the brush ID of each distinct brush */
+    std::map<FontKey, int> fontIds;     /*!< the font ID of each distinct font */
+};
+
+#endif // STYLETABLE_H
@@ -1,12 +1,12 @@
 #include "text.h"
-#include <sstream>
+#include "shapewriter.h"
 #include <qtconversions.h>
 
 //! Sets the QPainter object to draw a text box according to the Text object's specifications.
-void Text::draw()
+void Text::draw(QPainter &painter)
 {
-    painter.setPen(pen);
-    painter.setFont(font);
+    painter.setPen(getPen());
+    painter.setFont(getFont());
     painter.drawText(position.x(), position.y(), shapeDimensions[int(Specifications::W)], shapeDimensions[int(Specifications::H)], alignFlag, QString::fromStdString(text));
     painter.setPen(Qt::black);
 
@@ -14,7 +14,7 @@ void Text::draw()
     font.setPointSize(8);
     painter.setPen(QFont::Style::StyleNormal);
     painter.setFont(font);
-    painter.drawText(position.x() + shapeDimensions[int(Specifications::W)]/2, position.y() + shapeDimensions[int(Specifications::H)], 20, 20, Qt::AlignLeft, QString::number(shapeId));
+    painter.drawText(calcLabelRect(), Qt::AlignLeft, QString::number(shapeId));
 }
 
 //! Shifts the position of the text box.
@@ -22,6 +22,7 @@ void Text::move(const QPoint &shift)
 {
     position += shift;
     setShapeDimensions(shift);
+    invalidateMetrics();
 }
 
 //! Sets the position of the text box.
@@ -30,32 +31,19 @@ void Text::setPosition()
     position = {shapeDimensions[int(Specifications::X1)], shapeDimensions[int(Specifications::Y1)]};
 }
 
-//! Overrides the default print function for text specific information.
-std::string Text::print() const
+//! Overrides the default serialize function for text specific information.
+void Text::serialize(ShapeWriter &writer) const
 {
-    using std::endl;
-    std::ostringstream oss;
-
-    oss << "ShapeId: " << shapeId << endl;
-    oss << "ShapeType: " << shapeType << endl;
-    oss << "ShapeDimensions: ";
-    for(int i = 0; i < numDimensions; ++i)
-    {
-         oss << shapeDimensions[i];
-
-         if(i < numDimensions - 1)
-         {
-             oss << ", ";
-         }
-    }
-    oss << endl;
-    oss << "TextString: " << text << endl;
-    oss << "TextColor: " << getColorAsString(pen.color()) << endl;
-    oss << "TextAlignment: " << getTextAlignmentAsString(alignFlag) << endl;
-    oss << "TextPointSize: " << font.pointSize() << endl;
-    oss << "TextFontFamily: " << (font.family()).toStdString() << endl;
-    oss << "TextFontStyle: " << getFontStyleAsString(font.style()) << endl;
-    oss << "TextFontWeight: " << getFontWeightAsString(QFont::Weight(font.weight())) << endl;
-
-    return oss.str();
+    serializeHeader(writer);
+
+    const QPen &pen = getPen();
+    const QFont &font = getFont();
+
+    writer.writeField(ShapeFields::TEXT_STRING, text);
+    writer.writeField(ShapeFields::TEXT_COLOR, getColorAsString(pen.color()));
+    writer.writeField(ShapeFields::TEXT_ALIGNMENT, getTextAlignmentAsString(alignFlag));
+    writer.writeField(ShapeFields::TEXT_POINT_SIZE, font.pointSize());
+    writer.writeField(ShapeFields::TEXT_FONT_FAMILY, StyleTable::shared().getFontFamily(fontId));
+    writer.writeField(ShapeFields::TEXT_FONT_STYLE, getFontStyleAsString(font.style()));
+    writer.writeField(ShapeFields::TEXT_FONT_WEIGHT, getFontWeightAsString(QFont::Weight(font.weight())));
 }
@@ -19,31 +19,30 @@ const int NUM_TEXT_SPECS = 4;
 
 /*! Derived from abstract base class Shape.
  */
-class Text: public Shape
+class Text final : public Shape
 {
 public:
 
     //! Default constructor
     /*! Sets the position of the top left of the text box to a default location
      */
-    Text() : position{0,0}{}
+    Text() : Shape(ShapeLabels::TEXT), position{0,0}, fontId{0}, alignFlag{Qt::AlignLeft} {}
 
     //! Alternate constructor
     /*! Passes in all text data to be implemented upon construction.
      * Initializes the text and base class data via a base member initialization list.
      * Sets the QPoint value of the top left of the text box
-     * \sa MainWindow::on_textSave_clicked()
+     * \sa MainWindow::textSaveClicked()
      * \sa Text::setPosition()
      * \param shapeId the ID number of the new text box
-     * \param shapeType the string representing a text box
      * \param numDimensions the number of dimensions a text box has
      * \param *shapeDimensions the pointer to the array of text box dimensions
      * \param newFont the initialized QFont object
      * \param newText the text to be displayed in the text box
      * \param newFlag the alignment of the text in the text box
      */
-    Text(int shapeId, std::string shapeType, int numDimensions, dim::specs* shapeDimensions, QFont newFont, std::string newText, Qt::AlignmentFlag newFlag)
-          :Shape(shapeId, shapeType, numDimensions, shapeDimensions)
+    Text(int shapeId, int numDimensions, dim::specs* shapeDimensions, QFont newFont, std::string newText, Qt::AlignmentFlag newFlag)
+          :Shape(shapeId, ShapeLabels::TEXT, numDimensions, shapeDimensions), fontId{0}
           {setPosition(); setAlignment(newFlag); setFont(newFont); setText(newText);}
 
     //! Destructor
@@ -53,8 +52,9 @@ public:
 
     //! Draws the text box according to stored specifications.
     /*! Overrides the pure virtual function from the base class to draw a text box.
+     * \param painter the active QPainter of the rendering area
      */
-    void draw() override;
+    void draw(QPainter &painter) override;
 
     //! Moves the text box by a certain offset along the x and y axes.
     /*! Overrides the pure virtual function from the base class to move a text box.
@@ -72,21 +72,97 @@ public:
      */
     dim::area calcArea() const override {return 0;}
 
+    //! Finds the ID label of the text box.
+    /*! Overrides the virtual function from the base class.
+     * Inline function: the label hangs below the text box, starting at the middle of its bottom edge.
+     */
+    QRect calcLabelRect() const override {return QRect(shapeDimensions[int(Specifications::X1)] + shapeDimensions[int(Specifications::W)]/2,
+                                                       shapeDimensions[int(Specifications::Y1)] + shapeDimensions[int(Specifications::H)], LABEL_SIZE, LABEL_SIZE);}
+
     //! Sets the QPoint data member to the position of the top left corner of the text box.
     /*! Overrides the pure virtual function from the base class to set the position of a text box.
      */
     void setPosition() override;
 
-    //! Prints the text box specifications.
-    /*! Stores the entire set of text box specifications as a string to be printed to an output file via the AllShapes class.
+    //! Writes the text box specifications.
+    /*! Writes the entire set of text box specifications to an output file via the AllShapes class.
      * Overrides the virtual function from the base class.
+     * \param writer the writer that receives the fields
      * \sa AllShapes::printAll()
      */
-    std::string print() const override;
+    void serialize(ShapeWriter &writer) const override;
+
+    //! Sets the actual text of the text box.
+    /*! Inline function: sets the text of the text box with the passed in string.
+     * \param newText the text to be visible in the Text object
+     */
+    void setText(const std::string &newText) {text = newText;}
+
+    //! Sets the QFont values.
+    /*! Inline function: interns the font family, point size, style, and weight in the shared style table.
+     * \param font the populated QFont object
+     * \sa StyleTable::internFont()
+     */
+    void setFont(const QFont &font) {fontId = StyleTable::shared().internFont(font);}
+
+    //! Sets the font ID.
+    /*! Inline function: points the text box at a font already interned in the shared style table.
+     * \param id the ID of the interned font
+     * \sa Parser::resolveFont()
+     */
+    void setFontId(int id) {fontId = id;}
+
+    //! Sets the alignment of the text in the text box.
+    /*! Inline function: sets the alignment of the text in the text box.
+     * \param flag the alignment setting for the text in the text box
+     */
+    void setAlignment(Qt::AlignmentFlag flag) {alignFlag = flag;}
+
+    //! Gets the text of the current Text object.
+    /*! Inline function: returns the text that is visible for the Text object.
+     * \returns the current text by constant reference
+     * \sa MainWindow::setCurrentShapeInfo()
+     */
+    const std::string &getText() const {return text;}
+
+    //! Gets the QFont of the current Text object.
+    /*! Inline function: returns the QFont object representing the Text object.
+     * \returns the current QFont object by constant reference into the shared style table
+     * \sa MainWindow::setCurrentShapeInfo()
+     */
+    const QFont &getFont() const {return StyleTable::shared().getFont(fontId);}
+
+    //! Gets the font ID of the current Text object.
+    /*! Inline function: returns the ID of the Text object's font in the shared style table.
+     * \returns the current font ID
+     */
+    int getFontId() const {return fontId;}
+
+    //! Gets the alignment of the current Text object.
+    /*! Inline function: returns the alignment setting of the text in the text box.
+     * \returns the current Qt::AlignmentFlag
+     * \sa MainWindow::setCurrentShapeInfo()
+     */
+    Qt::AlignmentFlag getFlag() const {return alignFlag;}
+
+    //! Gets the number of heap bytes the text box owns.
+    /*! Inline function: hides the base class version to add the text, unless the string holds it inside itself.
+     * \returns The bytes of the dimension array and the text.
+     */
+    std::size_t getHeapBytes() const
+    {
+        const char *object = reinterpret_cast<const char*>(&text);
+        bool inlineText = text.data() >= object && text.data() < object + sizeof(text);
+
+        return Shape::getHeapBytes() + (inlineText ? 0 : text.capacity() + 1);
+    }
 
 
 private:
-    QPoint position;    /*!< the position of the top left corner of the text box */
+    QPoint position;                /*!< the position of the top left corner of the text box */
+    int fontId;                     /*!< the ID of the text box font in the shared style table */
+    std::string text;               /*!< the string of text displayed by the text box */
+    Qt::AlignmentFlag alignFlag;    /*!< the alignment setting of the text displayed by the text box */
 
 public:
     //! The enumeration representing the meaning of each slot in the array of text dimensions.
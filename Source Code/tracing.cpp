@@ -0,0 +1,249 @@
+#include "tracing.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    /*! \struct Span
+     * \brief One slot of a ring buffer. The fields are relaxed atomics so the exporter may read a slot while its thread rewrites it.
+     */
+    struct Span
+    {
+        std::atomic<const char*> category{nullptr};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<long long> start{0};
+        std::atomic<long long> duration{0};
+        std::atomic<int> threadId{0};
+    };
+
+    /*! \struct RingBuffer
+     * \brief The spans of one thread. Only the owning thread writes; head counts every span ever written.
+     */
+    struct RingBuffer
+    {
+        std::atomic<unsigned long long> head{0};    /*!< the number of spans written; the next span goes to head modulo RING_CAPACITY */
+        std::atomic<unsigned long long> cleared{0}; /*!< the value of head when the trace was last cleared */
+        int threadId{0};                            /*!< the thread writing the buffer */
+        Span spans[trace::RING_CAPACITY];
+    };
+
+    /*! \struct Registry
+     * \brief Every ring buffer, the buffers of exited threads, and the thread names.
+     */
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<RingBuffer>> buffers;
+        std::vector<RingBuffer*> idle;
+        std::map<int, std::string> threadNames;
+        int nextThreadId{1};
+    };
+
+    //! Gets the registry. It is never destroyed, so threads still running at exit may keep recording.
+    Registry &registry()
+    {
+        static Registry *instance = new Registry;
+        return *instance;
+    }
+
+    /*! \struct ThreadSlot
+     * \brief The calling thread's claim on a ring buffer, returned to the registry when the thread exits.
+     */
+    struct ThreadSlot
+    {
+        RingBuffer *buffer{nullptr};
+
+        ~ThreadSlot()
+        {
+            if(buffer != nullptr)
+            {
+                Registry &shared = registry();
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                shared.idle.push_back(buffer);
+            }
+        }
+    };
+
+    //! Gets the calling thread's ring buffer, claiming one on the thread's first span.
+    RingBuffer &localBuffer()
+    {
+        thread_local ThreadSlot slot;
+
+        if(slot.buffer == nullptr)
+        {
+            Registry &shared = registry();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+
+            if(shared.idle.empty())
+            {
+                shared.buffers.push_back(std::make_unique<RingBuffer>());
+                slot.buffer = shared.buffers.back().get();
+            }
+            else
+            {
+                slot.buffer = shared.idle.back();
+                shared.idle.pop_back();
+            }
+
+            slot.buffer -> threadId = shared.nextThreadId++;
+        }
+
+        return *slot.buffer;
+    }
+
+    //! Writes a string as a JSON string literal.
+    void writeString(std::ostream &out, const char *text)
+    {
+        out << '"';
+
+        for(const char *c = text; *c != '\0'; ++c)
+        {
+            if(*c == '"' || *c == '\\')
+            {
+                out << '\\';
+            }
+
+            out << *c;
+        }
+
+        out << '"';
+    }
+
+    /*! \struct CopiedSpan
+     * \brief A span read out of a ring buffer.
+     */
+    struct CopiedSpan
+    {
+        const char *category;
+        const char *name;
+        long long start;
+        long long duration;
+        int threadId;
+    };
+}
+
+void trace::record(const char *category, const char *name, long long startNs, long long durationNs)
+{
+    RingBuffer &buffer = localBuffer();
+
+    unsigned long long position = buffer.head.load(std::memory_order_relaxed);
+    Span &span = buffer.spans[position % RING_CAPACITY];
+
+    span.category.store(category, std::memory_order_relaxed);
+    span.name.store(name, std::memory_order_relaxed);
+    span.start.store(startNs, std::memory_order_relaxed);
+    span.duration.store(durationNs, std::memory_order_relaxed);
+    span.threadId.store(buffer.threadId, std::memory_order_relaxed);
+
+    buffer.head.store(position + 1, std::memory_order_release);
+}
+
+void trace::setThreadName(const std::string &name)
+{
+    int threadId = localBuffer().threadId;
+
+    Registry &shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.threadNames[threadId] = name;
+}
+
+void trace::clear()
+{
+    Registry &shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    for(std::unique_ptr<RingBuffer> &buffer : shared.buffers)
+    {
+        buffer -> cleared.store(buffer -> head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+/*! A slot being rewritten while it is copied shows up as a head that moved a whole lap past the slot's position,
+ * so spans are kept only if their position is still within the last RING_CAPACITY spans after the copy.
+ */
+int trace::exportChromeTrace(const std::string &fileName)
+{
+    std::vector<CopiedSpan> copied;
+    std::map<int, std::string> threadNames;
+
+    {
+        Registry &shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        threadNames = shared.threadNames;
+
+        for(std::unique_ptr<RingBuffer> &buffer : shared.buffers)
+        {
+            unsigned long long head = buffer -> head.load(std::memory_order_acquire);
+            unsigned long long first = std::max(buffer -> cleared.load(std::memory_order_relaxed),
+                                                head > RING_CAPACITY ? head - RING_CAPACITY : 0ULL);
+            std::size_t copyStart = copied.size();
+
+            for(unsigned long long position = first; position < head; ++position)
+            {
+                const Span &span = buffer -> spans[position % RING_CAPACITY];
+
+                copied.push_back({span.category.load(std::memory_order_relaxed), span.name.load(std::memory_order_relaxed),
+                                  span.start.load(std::memory_order_relaxed), span.duration.load(std::memory_order_relaxed),
+                                  span.threadId.load(std::memory_order_relaxed)});
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            unsigned long long after = buffer -> head.load(std::memory_order_relaxed);
+
+            if(after >= first + RING_CAPACITY)
+            {
+                std::size_t overwritten = std::size_t(std::min(head, after - RING_CAPACITY + 1) - first);
+                copied.erase(copied.begin() + std::ptrdiff_t(copyStart), copied.begin() + std::ptrdiff_t(copyStart + overwritten));
+            }
+        }
+    }
+
+    long long origin{0};
+
+    if(!copied.empty())
+    {
+        origin = std::min_element(copied.begin(), copied.end(), [](const CopiedSpan &a, const CopiedSpan &b){return a.start < b.start;}) -> start;
+    }
+
+    std::ofstream out(fileName, std::ios::out | std::ios::trunc);
+
+    if(!out.is_open())
+    {
+        return -1;
+    }
+
+    out.precision(3);
+    out << std::fixed << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+    bool first{true};
+
+    for(const std::pair<const int, std::string> &thread : threadNames)
+    {
+        out << (first ? "\n" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread.first << ", \"args\": {\"name\": ";
+        writeString(out, thread.second.c_str());
+        out << "}}";
+        first = false;
+    }
+
+    for(const CopiedSpan &span : copied)
+    {
+        out << (first ? "\n" : ",\n") << "{\"name\": ";
+        writeString(out, span.name);
+        out << ", \"cat\": ";
+        writeString(out, span.category);
+        out << ", \"ph\": \"X\", \"ts\": " << double(span.start - origin) / 1000.0 << ", \"dur\": " << double(span.duration) / 1000.0
+            << ", \"pid\": 1, \"tid\": " << span.threadId << "}";
+        first = false;
+    }
+
+    out << "\n]}\n";
+    out.close();
+
+    return out ? int(copied.size()) : -1;
+}
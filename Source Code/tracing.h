@@ -0,0 +1,107 @@
+/*!
+ * \file    tracing.h
+ * \brief   Records nested spans of UI slots and subsystems into per-thread ring buffers and exports them as a Chrome trace,
+ *          compiled in only when SHAPE_TRACING is defined.
+*/
+
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <chrono>
+#include <string>
+
+/*! \namespace trace
+ * \brief Holds the span recorder and the Chrome trace export.
+ *
+ * Code is instrumented with TRACE_SCOPE(category, name), or TRACE_SLOT() at the top of a UI slot.
+ * Every thread writes its spans into its own fixed ring buffer, so recording takes no lock and, after a thread's first span, no allocation:
+ * a span is stored once, when its scope ends, as a Chrome "complete" event, and nesting follows from the start times and durations.
+ * When a buffer is full the oldest spans of that thread are overwritten.
+ * The buffer of a thread that exits is handed to the next new thread, so short-lived worker threads do not add buffers;
+ * each span keeps the ID of the thread that recorded it.
+ * exportChromeTrace() copies the buffers while threads keep recording, and drops any span that was overwritten during the copy.
+ * The file opens in chrome://tracing or https://ui.perfetto.dev.
+ * Names and categories are not copied, so they must be string literals or other strings that live until the export.
+ * Without SHAPE_TRACING the macros expand to nothing.
+ * \sa perf
+ */
+namespace trace
+{
+    constexpr int RING_CAPACITY = 1 << 15;  /*!< The number of spans kept per thread */
+
+    //! Gets the time span starts and durations are measured in.
+    /*! \returns The nanoseconds since the steady clock's epoch.
+     */
+    inline long long now() {return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();}
+
+    //! Stores a finished span in the calling thread's ring buffer.
+    /*! \param category the subsystem, such as "ui" or "parser"
+     * \param name the operation
+     * \param startNs the start of the span, from now()
+     * \param durationNs the length of the span
+     */
+    void record(const char *category, const char *name, long long startNs, long long durationNs);
+
+    //! Names the calling thread in the exported trace.
+    /*! \param name the thread name; copied
+     */
+    void setThreadName(const std::string &name);
+
+    //! Forgets every recorded span.
+    /*! Spans being recorded while the trace is cleared may survive it.
+     */
+    void clear();
+
+    //! Writes every recorded span as Chrome trace-event JSON.
+    /*! \param fileName the path of the file to be written; an existing file is replaced
+     * \returns The number of spans written, or -1 if the file cannot be written.
+     */
+    int exportChromeTrace(const std::string &fileName);
+
+    /*! \class Scope
+     * \brief Records the time from its construction to its destruction as one span.
+     */
+    class Scope
+    {
+    public:
+
+        //! Constructor
+        /*! \param category the subsystem
+         * \param name the operation
+         */
+        Scope(const char *category, const char *name) : category{category}, name{name}, start{now()} {}
+
+        //! Destructor
+        ~Scope() {record(category, name, start, now() - start);}
+
+        //! Removes functionality of a copy constructor.
+        Scope(const Scope &otherScope) = delete;
+
+        //! Removes functionality of a copy assignment operator.
+        Scope& operator=(const Scope &otherScope) = delete;
+
+    private:
+        const char *category;   /*!< the subsystem */
+        const char *name;       /*!< the operation */
+        long long start;        /*!< the start of the span */
+    };
+}
+
+#define TRACE_CONCATENATE_IMPL(a, b) a##b
+#define TRACE_CONCATENATE(a, b) TRACE_CONCATENATE_IMPL(a, b)
+
+#ifdef SHAPE_TRACING
+    //! Records the rest of the enclosing scope as a span.
+    #define TRACE_SCOPE(category, name) trace::Scope TRACE_CONCATENATE(traceScope, __LINE__)(category, name)
+
+    //! Names the calling thread in the exported trace.
+    #define TRACE_THREAD_NAME(name) trace::setThreadName(name)
+#else
+    #define TRACE_SCOPE(category, name) static_cast<void>(0)
+    #define TRACE_THREAD_NAME(name) static_cast<void>(0)
+#endif
+
+//! Records the rest of a UI slot as a span named after the slot.
+#define TRACE_SLOT() TRACE_SCOPE("ui", __func__)
+
+#endif // TRACING_H
@@ -43,7 +43,7 @@ public:
     //! Copy constructor
     /*! Copies elements using the std::copy() algorithm
      * \param src the vector to be copied into the invoking vector, passed by constant reference */
-    vector(const vector &src) : size_v{src.size_v}, elem{new T[src.size_v]}, space{src.space}
+    vector(const vector &src) : size_v{src.size_v}, elem{new T[src.size_v]}, space{src.size_v}
     {
         copy(src.elem, src.elem + size_v, elem);
     }
@@ -64,6 +64,7 @@ public:
         /*! \brief Resets elem */
         elem = p;
         size_v = src.size_v;
+        space = src.size_v;
 
         /*! \brief Returns a self-reference */
         return *this;
@@ -138,6 +139,9 @@ public:
      * \param newalloc the amount of space to be reserved on the heap */
     void reserve(int newalloc)
     {
+        if (newalloc <= space)
+            return;
+
         T *p = new T[newalloc];
 
         /*! \brief Copies old elements */
@@ -147,6 +151,7 @@ public:
         delete[] elem;
 
         elem = p;
+        space = newalloc;
     }
 
     using iterator = T *;